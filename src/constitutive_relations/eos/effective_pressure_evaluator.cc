@@ -13,7 +13,7 @@ namespace Amanzi {
 namespace Relations {
 
 EffectivePressureEvaluator::EffectivePressureEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   if (my_key_ == std::string("")) {
     my_key_ = ep_plist_.get<std::string>("effective pressure key", "effective_pressure");
   }
@@ -39,7 +39,7 @@ EffectivePressureEvaluator::EffectivePressureEvaluator(Teuchos::ParameterList& p
 
 EffectivePressureEvaluator::EffectivePressureEvaluator(
         const EffectivePressureEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pres_key_(other.pres_key_) {}
 
 
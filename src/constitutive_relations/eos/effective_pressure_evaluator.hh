@@ -11,12 +11,12 @@
 #define AMANZI_EFFECTIVE_PRESSURE_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class EffectivePressureEvaluator : public SecondaryVariableFieldEvaluator {
+class EffectivePressureEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
 
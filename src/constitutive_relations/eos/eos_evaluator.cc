@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Relations {
 
 EOSEvaluator::EOSEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist) {
+    TimedSecondaryVariablesFieldEvaluator(plist) {
 
   // Process the list for my provided field.
   std::string mode = plist_.get<std::string>("EOS basis", "molar");
@@ -94,7 +94,7 @@ EOSEvaluator::EOSEvaluator(Teuchos::ParameterList& plist) :
 
 
 EOSEvaluator::EOSEvaluator(const EOSEvaluator& other) :
-    SecondaryVariablesFieldEvaluator(other),
+    TimedSecondaryVariablesFieldEvaluator(other),
     eos_(other.eos_),
     mode_(other.mode_),
     temp_key_(other.temp_key_),
@@ -12,12 +12,12 @@
 
 #include "eos.hh"
 #include "Factory.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class EOSEvaluator : public SecondaryVariablesFieldEvaluator {
+class EOSEvaluator : public TimedSecondaryVariablesFieldEvaluator {
 
  public:
   enum EOSMode { EOS_MODE_MASS, EOS_MODE_MOLAR, EOS_MODE_BOTH };
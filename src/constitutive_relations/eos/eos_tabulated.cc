@@ -0,0 +1,148 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  EOS which tabulates another EOS.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <cmath>
+#include <algorithm>
+
+#include "errors.hh"
+#include "VerboseObject.hh"
+#include "eos_factory.hh"
+#include "eos_tabulated.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+EOSTabulated::EOSTabulated(Teuchos::ParameterList& eos_plist) :
+    eos_plist_(eos_plist) {
+  InitializeFromPlist_();
+};
+
+
+double EOSTabulated::MassDensity(double T, double p) {
+  return InRange_(T,p) ? Value_(mass_, T, p) : eos_->MassDensity(T,p);
+};
+
+double EOSTabulated::DMassDensityDT(double T, double p) {
+  return InRange_(T,p) ? DValueDT_(mass_, T, p) : eos_->DMassDensityDT(T,p);
+};
+
+double EOSTabulated::DMassDensityDp(double T, double p) {
+  return InRange_(T,p) ? DValueDp_(mass_, T, p) : eos_->DMassDensityDp(T,p);
+};
+
+double EOSTabulated::MolarDensity(double T, double p) {
+  return InRange_(T,p) ? Value_(molar_, T, p) : eos_->MolarDensity(T,p);
+};
+
+double EOSTabulated::DMolarDensityDT(double T, double p) {
+  return InRange_(T,p) ? DValueDT_(molar_, T, p) : eos_->DMolarDensityDT(T,p);
+};
+
+double EOSTabulated::DMolarDensityDp(double T, double p) {
+  return InRange_(T,p) ? DValueDp_(molar_, T, p) : eos_->DMolarDensityDp(T,p);
+};
+
+
+int EOSTabulated::PressureInterval_(double p) const {
+  int j = static_cast<int>((p - p0_) / dp_);
+  return std::min(std::max(j, 0), (int) mass_.size() - 2);
+}
+
+double EOSTabulated::Value_(const std::vector<MonotoneCubicTable>& tabs,
+                            double T, double p) const {
+  int j = PressureInterval_(p);
+  double w = (p - (p0_ + j*dp_)) / dp_;
+  return (1.0 - w) * tabs[j](T) + w * tabs[j+1](T);
+}
+
+double EOSTabulated::DValueDT_(const std::vector<MonotoneCubicTable>& tabs,
+                               double T, double p) const {
+  int j = PressureInterval_(p);
+  double w = (p - (p0_ + j*dp_)) / dp_;
+  return (1.0 - w) * tabs[j].Derivative(T) + w * tabs[j+1].Derivative(T);
+}
+
+double EOSTabulated::DValueDp_(const std::vector<MonotoneCubicTable>& tabs,
+                               double T, double p) const {
+  int j = PressureInterval_(p);
+  return (tabs[j+1](T) - tabs[j](T)) / dp_;
+}
+
+
+void EOSTabulated::InitializeFromPlist_() {
+  if (!eos_plist_.isSublist("EOS parameters")) {
+    Errors::Message msg("EOS: tabulated EOS requires a sublist \"EOS parameters\".");
+    Exceptions::amanzi_throw(msg);
+  }
+  EOSFactory fac;
+  eos_ = fac.createEOS(eos_plist_.sublist("EOS parameters"));
+
+  Teuchos::Array<double> T_range =
+      eos_plist_.get<Teuchos::Array<double> >("temperature range [K]");
+  Teuchos::Array<double> p_range =
+      eos_plist_.get<Teuchos::Array<double> >("pressure range [Pa]");
+  int nT = eos_plist_.get<int>("number of temperature points", 1000);
+  int np = eos_plist_.get<int>("number of pressure points", 2);
+  if (T_range.size() != 2 || p_range.size() != 2 || np < 2 || !(p_range[1] > p_range[0])) {
+    Errors::Message msg("EOS: tabulated EOS ranges must be of the form {min, max}, with at least 2 pressure points.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  p0_ = p_range[0];
+  p1_ = p_range[1];
+  dp_ = (p1_ - p0_) / (np - 1);
+
+  EOS* eos = eos_.get();
+  mass_.resize(np);
+  molar_.resize(np);
+  for (int j=0; j!=np; ++j) {
+    double p = j == np-1 ? p1_ : p0_ + j*dp_;
+    mass_[j].Setup(T_range[0], T_range[1], nT,
+                   [eos,p](double T) { return eos->MassDensity(T,p); });
+    molar_[j].Setup(T_range[0], T_range[1], nT,
+                    [eos,p](double T) { return eos->MolarDensity(T,p); });
+  }
+
+  ReportErrors_();
+};
+
+
+void EOSTabulated::ReportErrors_() {
+  Teuchos::RCP<VerboseObject> vo = Teuchos::rcp(new VerboseObject("EOSTabulated", eos_plist_));
+  if (!vo->os_OK(Teuchos::VERB_LOW)) return;
+
+  // sample between temperature nodes, on and between pressure nodes
+  double err = 0., derr_T = 0., derr_p = 0.;
+  int np = mass_.size();
+  int nT = mass_[0].size();
+  double T0 = mass_[0].x0();
+  double dT = (mass_[0].x1() - T0) / (nT - 1);
+  for (int k=0; k!=2*np-1; ++k) {
+    double p = std::min(p0_ + 0.5*k*dp_, p1_);
+    for (int i=0; i!=4*(nT-1); ++i) {
+      double T = T0 + (i + 0.5) * 0.25 * dT;
+      err = std::max(err, std::abs(Value_(mass_, T, p) - eos_->MassDensity(T,p)));
+      derr_T = std::max(derr_T, std::abs(DValueDT_(mass_, T, p) - eos_->DMassDensityDT(T,p)));
+      derr_p = std::max(derr_p, std::abs(DValueDp_(mass_, T, p) - eos_->DMassDensityDp(T,p)));
+    }
+  }
+
+  Teuchos::OSTab tab = vo->getOSTab();
+  *vo->os() << "tabulated \"" << eos_plist_.sublist("EOS parameters").get<std::string>("EOS type")
+            << "\" on T in [" << mass_[0].x0() << ", " << mass_[0].x1() << "], p in ["
+            << p0_ << ", " << p1_ << "] with " << mass_[0].size() << " x " << np
+            << " points:" << std::endl
+            << "  mass density max error = " << err
+            << ", d/dT max error = " << derr_T
+            << ", d/dp max error = " << derr_p << std::endl;
+};
+
+} // namespace
+} // namespace
@@ -0,0 +1,82 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  EOS which tabulates another EOS.
+
+  Mass and molar densities are tabulated with monotone cubic interpolants in
+  temperature on each of a set of uniformly spaced pressures, and linearly
+  interpolated in pressure.  Two pressure points (the default) are exact for
+  EOSs linear in pressure, such as liquid water.  Outside the tabulated
+  range the wrapped EOS is evaluated.  Maximum table errors are reported at
+  startup.
+
+  * "EOS parameters" [EOS-typed-spec] The EOS to tabulate.
+  * "temperature range [K]" [Array(double)] {min, max}
+  * "pressure range [Pa]" [Array(double)] {min, max}
+  * "number of temperature points" [int] 1000
+  * "number of pressure points" [int] 2
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#ifndef AMANZI_RELATIONS_EOS_TABULATED_HH_
+#define AMANZI_RELATIONS_EOS_TABULATED_HH_
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "Factory.hh"
+#include "MonotoneCubicTable.hh"
+#include "eos.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class EOSTabulated : public EOS {
+
+ public:
+  explicit EOSTabulated(Teuchos::ParameterList& eos_plist);
+
+  virtual double MassDensity(double T, double p);
+  virtual double DMassDensityDT(double T, double p);
+  virtual double DMassDensityDp(double T, double p);
+
+  virtual double MolarDensity(double T, double p);
+  virtual double DMolarDensityDT(double T, double p);
+  virtual double DMolarDensityDp(double T, double p);
+
+  virtual bool IsConstantMolarMass() { return eos_->IsConstantMolarMass(); }
+  virtual double MolarMass() { return eos_->MolarMass(); }
+
+ private:
+  void InitializeFromPlist_();
+  void ReportErrors_();
+
+  bool InRange_(double T, double p) const {
+    return p >= p0_ && p <= p1_ && mass_[0].InRange(T);
+  }
+
+  // Linear interpolation in pressure between temperature tables.
+  double Value_(const std::vector<MonotoneCubicTable>& tabs, double T, double p) const;
+  double DValueDT_(const std::vector<MonotoneCubicTable>& tabs, double T, double p) const;
+  double DValueDp_(const std::vector<MonotoneCubicTable>& tabs, double T, double p) const;
+  int PressureInterval_(double p) const;
+
+ private:
+  Teuchos::ParameterList eos_plist_;
+  Teuchos::RCP<EOS> eos_;
+
+  double p0_, p1_, dp_;
+  std::vector<MonotoneCubicTable> mass_;   // one table in T per pressure
+  std::vector<MonotoneCubicTable> molar_;
+
+  static Utils::RegisteredFactory<EOS,EOSTabulated> factory_;
+};
+
+} // namespace
+} // namespace
+
+#endif
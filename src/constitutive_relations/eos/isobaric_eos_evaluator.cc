@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Relations {
 
 IsobaricEOSEvaluator::IsobaricEOSEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist) {
+    TimedSecondaryVariablesFieldEvaluator(plist) {
 
   // Process the list for my provided field.
   std::string mode = plist_.get<std::string>("EOS basis", "molar");
@@ -66,7 +66,7 @@ IsobaricEOSEvaluator::IsobaricEOSEvaluator(Teuchos::ParameterList& plist) :
 
 
 IsobaricEOSEvaluator::IsobaricEOSEvaluator(const IsobaricEOSEvaluator& other) :
-    SecondaryVariablesFieldEvaluator(other),
+    TimedSecondaryVariablesFieldEvaluator(other),
     eos_(other.eos_),
     mode_(other.mode_),
     temp_key_(other.temp_key_),
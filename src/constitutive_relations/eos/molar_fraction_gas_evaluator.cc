@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Relations {
 
 MolarFractionGasEvaluator::MolarFractionGasEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   // set up the actual model
   AMANZI_ASSERT(plist_.isSublist("vapor pressure model parameters"));
@@ -44,7 +44,7 @@ MolarFractionGasEvaluator::MolarFractionGasEvaluator(Teuchos::ParameterList& pli
 
 
 MolarFractionGasEvaluator::MolarFractionGasEvaluator(const MolarFractionGasEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     sat_vapor_model_(other.sat_vapor_model_),
     temp_key_(other.temp_key_) {}
 
@@ -11,13 +11,13 @@
 #define AMANZI_RELATIONSRELATIONS_MOLAR_FRACTION_GAS_
 
 #include "vapor_pressure_relation.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
 // Equation of State model
-class MolarFractionGasEvaluator : public SecondaryVariableFieldEvaluator {
+class MolarFractionGasEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -0,0 +1,200 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Tests of the tabulated EOS and viscosity wrappers against the relations
+  they tabulate.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <cmath>
+#include <iostream>
+#include "UnitTest++.h"
+#include "TestReporterStdout.h"
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "errors.hh"
+#include "eos_water.hh"
+#include "eos_tabulated.hh"
+#include "viscosity_water.hh"
+#include "viscosity_tabulated.hh"
+
+// register the wrapped relations with their factories
+#include "eos_water_reg.hh"
+#include "viscosity_water_reg.hh"
+
+using namespace Amanzi::Relations;
+
+SUITE(TABULATED_EOS) {
+
+struct tabulated_water {
+  tabulated_water() :
+      T0(273.15), T1(373.15), nT(201),
+      p0(101325.), p1(1.e7) {
+    Teuchos::ParameterList plist;
+    water = Teuchos::rcp(new EOSWater(plist));
+
+    Teuchos::ParameterList tab_plist;
+    tab_plist.sublist("EOS parameters").set<std::string>("EOS type", "liquid water");
+    Teuchos::Array<double> T_range(2); T_range[0] = T0; T_range[1] = T1;
+    Teuchos::Array<double> p_range(2); p_range[0] = p0; p_range[1] = p1;
+    tab_plist.set("temperature range [K]", T_range);
+    tab_plist.set("pressure range [Pa]", p_range);
+    tab_plist.set("number of temperature points", nT);
+    tab = Teuchos::rcp(new EOSTabulated(tab_plist));
+  }
+
+  double T0, T1;
+  int nT;
+  double p0, p1;
+  Teuchos::RCP<EOS> water;
+  Teuchos::RCP<EOS> tab;
+};
+
+
+// Exact at temperature nodes; density is linear in pressure, so this holds
+// between the two pressure nodes as well.
+TEST_FIXTURE(tabulated_water, TabulatedEOSNodes) {
+  double dT = (T1 - T0) / (nT - 1);
+  double ps[3] = { p0, 0.5*(p0 + p1), p1 };
+  for (int k=0; k!=3; ++k) {
+    for (int i=0; i!=nT; ++i) {
+      double T = T0 + i*dT;
+      CHECK_CLOSE(water->MassDensity(T,ps[k]), tab->MassDensity(T,ps[k]), 1.e-9);
+      CHECK_CLOSE(water->MolarDensity(T,ps[k]), tab->MolarDensity(T,ps[k]), 1.e-7);
+      CHECK_CLOSE(water->DMassDensityDp(T,ps[k]), tab->DMassDensityDp(T,ps[k]), 1.e-12);
+    }
+  }
+}
+
+
+// Between nodes the values are accurate to a few parts in 10^6 and the
+// temperature derivatives are close.  End intervals use one-sided slopes and
+// are less accurate.
+TEST_FIXTURE(tabulated_water, TabulatedEOSMidpoints) {
+  double dT = (T1 - T0) / (nT - 1);
+  double ps[3] = { p0, 0.37*p0 + 0.63*p1, p1 };
+  for (int k=0; k!=3; ++k) {
+    double p = ps[k];
+    for (int i=0; i!=nT-1; ++i) {
+      double T = T0 + (i + 0.5)*dT;
+      bool end = i == 0 || i == nT-2;
+      double rho = water->MassDensity(T,p);
+      CHECK_CLOSE(rho, tab->MassDensity(T,p), (end ? 5.e-6 : 1.e-6) * rho);
+      double n = water->MolarDensity(T,p);
+      CHECK_CLOSE(n, tab->MolarDensity(T,p), (end ? 5.e-6 : 1.e-6) * n);
+      CHECK_CLOSE(water->DMassDensityDT(T,p), tab->DMassDensityDT(T,p), end ? 1.e-2 : 2.e-3);
+      CHECK_CLOSE(water->DMassDensityDp(T,p), tab->DMassDensityDp(T,p), 1.e-12);
+    }
+  }
+}
+
+
+// Outside the table the wrapped EOS is evaluated directly.
+TEST_FIXTURE(tabulated_water, TabulatedEOSOutOfRange) {
+  double Ts[3] = { T0 - 1., 0.5*(T0 + T1), T1 + 10. };
+  double ps[3] = { p0 - 1000., 0.5*(p0 + p1), 2*p1 };
+  for (int i=0; i!=3; ++i) {
+    for (int k=0; k!=3; ++k) {
+      if (i == 1 && k == 1) continue;
+      double T = Ts[i], p = ps[k];
+      CHECK_EQUAL(water->MassDensity(T,p), tab->MassDensity(T,p));
+      CHECK_EQUAL(water->DMassDensityDT(T,p), tab->DMassDensityDT(T,p));
+      CHECK_EQUAL(water->DMassDensityDp(T,p), tab->DMassDensityDp(T,p));
+      CHECK_EQUAL(water->MolarDensity(T,p), tab->MolarDensity(T,p));
+    }
+  }
+  CHECK_EQUAL(water->MolarMass(), tab->MolarMass());
+  CHECK(tab->IsConstantMolarMass());
+}
+
+
+TEST(TabulatedEOSBadSetup) {
+  Teuchos::ParameterList tab_plist;
+  Teuchos::Array<double> range(2); range[0] = 273.15; range[1] = 373.15;
+  tab_plist.set("temperature range [K]", range);
+  tab_plist.set("pressure range [Pa]", range);
+  CHECK_THROW(EOSTabulated eos(tab_plist), Errors::Message);
+
+  tab_plist.sublist("EOS parameters").set<std::string>("EOS type", "liquid water");
+  tab_plist.set("number of pressure points", 1);
+  CHECK_THROW(EOSTabulated eos(tab_plist), Errors::Message);
+}
+
+} // SUITE
+
+
+SUITE(TABULATED_VISCOSITY) {
+
+struct tabulated_viscosity {
+  // spans the change of branch of the water viscosity at 293.15 K
+  tabulated_viscosity() :
+      T0(273.15), T1(373.15), nT(201) {
+    Teuchos::ParameterList plist;
+    water = Teuchos::rcp(new ViscosityWater(plist));
+
+    Teuchos::ParameterList tab_plist;
+    tab_plist.sublist("viscosity relation parameters")
+        .set<std::string>("viscosity relation type", "liquid water");
+    Teuchos::Array<double> T_range(2); T_range[0] = T0; T_range[1] = T1;
+    tab_plist.set("temperature range [K]", T_range);
+    tab_plist.set("number of temperature points", nT);
+    tab = Teuchos::rcp(new ViscosityTabulated(tab_plist));
+  }
+
+  double T0, T1;
+  int nT;
+  Teuchos::RCP<ViscosityRelation> water;
+  Teuchos::RCP<ViscosityRelation> tab;
+};
+
+
+TEST_FIXTURE(tabulated_viscosity, TabulatedViscosityNodesAndMidpoints) {
+  double dT = (T1 - T0) / (nT - 1);
+  for (int i=0; i!=nT; ++i) {
+    double T = T0 + i*dT;
+    CHECK_CLOSE(water->Viscosity(T), tab->Viscosity(T), 1.e-12 * water->Viscosity(T));
+  }
+  for (int i=0; i!=nT-1; ++i) {
+    double T = T0 + (i + 0.5)*dT;
+    bool end = i == 0 || i == nT-2;
+    double visc = water->Viscosity(T);
+    CHECK_CLOSE(visc, tab->Viscosity(T), (end ? 1.e-4 : 2.e-5) * visc);
+    double dvisc = water->DViscosityDT(T);
+    CHECK_CLOSE(dvisc, tab->DViscosityDT(T), (end ? 2.e-2 : 5.e-3) * std::abs(dvisc));
+  }
+}
+
+
+// Viscosity of water decreases with temperature; so does the table.
+TEST_FIXTURE(tabulated_viscosity, TabulatedViscosityMonotone) {
+  int n = 20 * (nT - 1);
+  double dT = (T1 - T0) / n;
+  double last = tab->Viscosity(T0);
+  for (int i=1; i<=n; ++i) {
+    double visc = tab->Viscosity(T0 + i*dT);
+    CHECK(visc <= last);
+    last = visc;
+  }
+}
+
+
+TEST_FIXTURE(tabulated_viscosity, TabulatedViscosityOutOfRange) {
+  double Ts[2] = { T0 - 1., T1 + 10. };
+  for (int i=0; i!=2; ++i) {
+    CHECK_EQUAL(water->Viscosity(Ts[i]), tab->Viscosity(Ts[i]));
+    CHECK_EQUAL(water->DViscosityDT(Ts[i]), tab->DViscosityDT(Ts[i]));
+  }
+}
+
+} // SUITE
+
+
+int main(int argc, char *argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc,&argv);
+  return UnitTest::RunAllTests ();
+}
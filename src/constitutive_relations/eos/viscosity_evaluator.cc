@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Relations {
 
 ViscosityEvaluator::ViscosityEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   // my keys
   if (my_key_ == std::string("")) {
@@ -37,7 +37,7 @@ ViscosityEvaluator::ViscosityEvaluator(Teuchos::ParameterList& plist) :
 
 
 ViscosityEvaluator::ViscosityEvaluator(const ViscosityEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     visc_(other.visc_),
     temp_key_(other.temp_key_) {}
 
@@ -11,12 +11,12 @@
 #define AMANZI_RELATIONS_VISC_EVALUATOR_HH_
 
 #include "viscosity_relation.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class ViscosityEvaluator : public SecondaryVariableFieldEvaluator {
+class ViscosityEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
 
@@ -0,0 +1,57 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Viscosity which tabulates another viscosity relation.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "errors.hh"
+#include "VerboseObject.hh"
+#include "viscosity_relation_factory.hh"
+#include "viscosity_tabulated.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+ViscosityTabulated::ViscosityTabulated(Teuchos::ParameterList& eos_plist) :
+    eos_plist_(eos_plist) {
+  if (!eos_plist_.isSublist("viscosity relation parameters")) {
+    Errors::Message msg("Viscosity: tabulated viscosity requires a sublist \"viscosity relation parameters\".");
+    Exceptions::amanzi_throw(msg);
+  }
+  Teuchos::ParameterList& sublist = eos_plist_.sublist("viscosity relation parameters");
+  ViscosityRelationFactory fac;
+  visc_ = fac.createViscosity(sublist);
+
+  Teuchos::Array<double> T_range =
+      eos_plist_.get<Teuchos::Array<double> >("temperature range [K]");
+  if (T_range.size() != 2) {
+    Errors::Message msg("Viscosity: tabulated viscosity range must be of the form {min, max}.");
+    Exceptions::amanzi_throw(msg);
+  }
+  int nT = eos_plist_.get<int>("number of temperature points", 1000);
+
+  ViscosityRelation* visc = visc_.get();
+  table_.Setup(T_range[0], T_range[1], nT,
+               [visc](double T) { return visc->Viscosity(T); });
+
+  // report table accuracy
+  Teuchos::RCP<VerboseObject> vo = Teuchos::rcp(new VerboseObject("ViscosityTabulated", eos_plist_));
+  if (vo->os_OK(Teuchos::VERB_LOW)) {
+    Teuchos::OSTab tab = vo->getOSTab();
+    *vo->os() << "tabulated \"" << sublist.get<std::string>("viscosity relation type")
+              << "\" on T in [" << T_range[0] << ", " << T_range[1] << "] with "
+              << nT << " points:" << std::endl
+              << "  viscosity max error = "
+              << table_.MaxError([visc](double T) { return visc->Viscosity(T); })
+              << ", d/dT max error = "
+              << table_.MaxDerivativeError([visc](double T) { return visc->DViscosityDT(T); })
+              << std::endl;
+  }
+};
+
+} // namespace
+} // namespace
@@ -0,0 +1,53 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Viscosity which tabulates another viscosity relation with a monotone cubic
+  interpolant in temperature.  Outside the tabulated range the wrapped
+  relation is evaluated.  The maximum table error is reported at startup.
+
+  * "viscosity relation parameters" [viscosity-typed-spec] The relation to tabulate.
+  * "temperature range [K]" [Array(double)] {min, max}
+  * "number of temperature points" [int] 1000
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#ifndef AMANZI_RELATIONS_VISCOSITY_TABULATED_HH_
+#define AMANZI_RELATIONS_VISCOSITY_TABULATED_HH_
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "Factory.hh"
+#include "MonotoneCubicTable.hh"
+#include "viscosity_relation.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class ViscosityTabulated : public ViscosityRelation {
+
+public:
+  explicit
+  ViscosityTabulated(Teuchos::ParameterList& eos_plist);
+
+  virtual double Viscosity(double T) {
+    return table_.InRange(T) ? table_(T) : visc_->Viscosity(T); }
+  virtual double DViscosityDT(double T) {
+    return table_.InRange(T) ? table_.Derivative(T) : visc_->DViscosityDT(T); }
+
+protected:
+  Teuchos::ParameterList eos_plist_;
+  Teuchos::RCP<ViscosityRelation> visc_;
+  MonotoneCubicTable table_;
+
+private:
+  static Utils::RegisteredFactory<ViscosityRelation,ViscosityTabulated> factory_;
+
+};
+
+} // namespace
+} // namespace
+
+#endif
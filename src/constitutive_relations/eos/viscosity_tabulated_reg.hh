@@ -0,0 +1,20 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Tabulated wrapper of another relation.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "viscosity_tabulated.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+// registry of method
+Utils::RegisteredFactory<ViscosityRelation,ViscosityTabulated> ViscosityTabulated::factory_("tabulated");
+
+} // namespace
+} // namespace
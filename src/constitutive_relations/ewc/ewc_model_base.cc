@@ -397,5 +397,12 @@ int EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_FD_(double T, double
 }
 
 
+bool EWCModelBase::IsSingular_(const WhetStone::Tensor& jac) {
+  double diag = jac(0,0) * jac(1,1);
+  double off = jac(0,1) * jac(1,0);
+  double det = diag - off;
+  return std::abs(det) < 1.e-20 || std::abs(det) <= 1.e-10 * (std::abs(diag) + std::abs(off));
+}
+
 
 } // namespace
@@ -39,6 +39,11 @@ class EWCModelBase : public EWCModel {
 
   int EvaluateEnergyAndWaterContentAndJacobian_FD_(double T, double p,
           AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
+  // True if the 2x2 jac is singular relative to the size of its entries.
+  // Exact Jacobians are singular on plateaus of the model, where the FD
+  // Jacobian, whose increments grow until they see a change, should be used.
+  static bool IsSingular_(const WhetStone::Tensor& jac);
 };
 
 } // namespace
@@ -262,4 +262,104 @@ int LiquidIceModel::EvaluateEnergyAndWaterContent_(double T, double p, AmanziGeo
   return ierr;
 }
 
+// Same model as EvaluateEnergyAndWaterContent_(), differentiated by the chain
+// rule.  jac(i,j) is the derivative of result[i] = {energy, water content}
+// with respect to x_j = {T, p}.
+int LiquidIceModel::EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+        AmanziGeometry::Point& result, WhetStone::Tensor& jac) {
+  if (T < 100.0 || T > 373.0) {
+    return 1; // invalid temperature
+  }
+  int ierr = 0;
+  try {
+    double poro, dporo_dp;
+    if (!poro_leij_) {
+      poro = poro_model_->Porosity(poro_, p, p_atm_);
+      dporo_dp = poro_model_->DPorosityDPressure(poro_, p, p_atm_);
+    } else {
+      poro = poro_leij_model_->Porosity(poro_, p, p_atm_);
+      dporo_dp = poro_leij_model_->DPorosityDPressure(poro_, p, p_atm_);
+    }
+
+    double eff_p = std::max(p_atm_, p);
+    double deff_p_dp = p > p_atm_ ? 1. : 0.;
+
+    double rho_l = liquid_eos_->MolarDensity(T,eff_p);
+    double drho_l_dT = liquid_eos_->DMolarDensityDT(T,eff_p);
+    double drho_l_dp = liquid_eos_->DMolarDensityDp(T,eff_p) * deff_p_dp;
+    double rho_i = ice_eos_->MolarDensity(T,eff_p);
+    double drho_i_dT = ice_eos_->DMolarDensityDT(T,eff_p);
+    double drho_i_dp = ice_eos_->DMolarDensityDp(T,eff_p) * deff_p_dp;
+
+    double pc_i, dpc_i_dT, dpc_i_dp;
+    if (pc_i_->IsMolarBasis()) {
+      pc_i = pc_i_->CapillaryPressure(T, rho_l);
+      double dpc_i_drho = pc_i_->DCapillaryPressureDRho(T, rho_l);
+      dpc_i_dT = pc_i_->DCapillaryPressureDT(T, rho_l) + dpc_i_drho * drho_l_dT;
+      dpc_i_dp = dpc_i_drho * drho_l_dp;
+    } else {
+      double mass_rho_l = liquid_eos_->MassDensity(T,eff_p);
+      double dmass_rho_l_dT = liquid_eos_->DMassDensityDT(T,eff_p);
+      double dmass_rho_l_dp = liquid_eos_->DMassDensityDp(T,eff_p) * deff_p_dp;
+      pc_i = pc_i_->CapillaryPressure(T, mass_rho_l);
+      double dpc_i_drho = pc_i_->DCapillaryPressureDRho(T, mass_rho_l);
+      dpc_i_dT = pc_i_->DCapillaryPressureDT(T, mass_rho_l) + dpc_i_drho * dmass_rho_l_dT;
+      dpc_i_dp = dpc_i_drho * dmass_rho_l_dp;
+    }
+
+    double pc_l = pc_l_->CapillaryPressure(p, p_atm_);
+    double dpc_l_dp = pc_l_->DCapillaryPressureDp(p, p_atm_);
+
+    double sats[3], dsats_dpc_l[3], dsats_dpc_i[3];
+    wrm_->saturations(pc_l, pc_i, sats);
+    wrm_->dsaturations_dpc_liq(pc_l, pc_i, dsats_dpc_l);
+    wrm_->dsaturations_dpc_ice(pc_l, pc_i, dsats_dpc_i);
+    double s_l = sats[1];
+    double s_i = sats[2];
+    double ds_l_dT = dsats_dpc_i[1] * dpc_i_dT;
+    double ds_i_dT = dsats_dpc_i[2] * dpc_i_dT;
+    double ds_l_dp = dsats_dpc_l[1] * dpc_l_dp + dsats_dpc_i[1] * dpc_i_dp;
+    double ds_i_dp = dsats_dpc_l[2] * dpc_l_dp + dsats_dpc_i[2] * dpc_i_dp;
+
+    double u_l = liquid_iem_->InternalEnergy(T);
+    double du_l_dT = liquid_iem_->DInternalEnergyDT(T);
+    double u_i = ice_iem_->InternalEnergy(T);
+    double du_i_dT = ice_iem_->DInternalEnergyDT(T);
+
+    double u_rock = rock_iem_->InternalEnergy(T);
+    double du_rock_dT = rock_iem_->DInternalEnergyDT(T);
+
+    // molar densities of each phase per pore volume
+    double n_l = rho_l * s_l;
+    double dn_l_dT = drho_l_dT * s_l + rho_l * ds_l_dT;
+    double dn_l_dp = drho_l_dp * s_l + rho_l * ds_l_dp;
+    double n_i = rho_i * s_i;
+    double dn_i_dT = drho_i_dT * s_i + rho_i * ds_i_dT;
+    double dn_i_dp = drho_i_dp * s_i + rho_i * ds_i_dp;
+
+    // water content
+    double wc = n_l + n_i;
+    result[1] = poro * wc;
+    jac(1,0) = poro * (dn_l_dT + dn_i_dT);
+    jac(1,1) = dporo_dp * wc + poro * (dn_l_dp + dn_i_dp);
+
+    // energy
+    double e = u_l * n_l + u_i * n_i;
+    result[0] = poro * e + (1.0 - poro_) * (rho_rock_ * u_rock);
+    jac(0,0) = poro * (du_l_dT * n_l + u_l * dn_l_dT + du_i_dT * n_i + u_i * dn_i_dT)
+        + (1.0 - poro_) * (rho_rock_ * du_rock_dT);
+    jac(0,1) = dporo_dp * e + poro * (u_l * dn_l_dp + u_i * dn_i_dp);
+  } catch (const Exceptions::Amanzi_exception& e) {
+    if (e.what() == std::string("Cut time step")) {
+      ierr = 1;
+    }
+  }
+
+  // on a plateau of the model the exact Jacobian is singular
+  if (!ierr && IsSingular_(jac)) {
+    ierr = EvaluateEnergyAndWaterContentAndJacobian_FD_(T, p, result, jac);
+  }
+  return ierr;
+}
+
 }
@@ -142,5 +142,76 @@ SurfaceIceModel::EvaluateEnergyAndWaterContent_(double T, double p,
   return ierr;
 }
 
+// Same model as EvaluateEnergyAndWaterContent_(), differentiated by the chain
+// rule.  jac(i,j) is the derivative of result[i] = {energy, water content}
+// with respect to x_j = {T, p}.
+int
+SurfaceIceModel::EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+        AmanziGeometry::Point& result, WhetStone::Tensor& jac) {
+  if (T < 100) return 1; // invalid temperature
+  int ierr = 0;
+  try {
+    // water content [mol / A]
+    double WC = p < p_atm_ ? 0. : (p - p_atm_) / (gz_ * M_);
+    double dWC_dp = p < p_atm_ ? 0. : 1. / (gz_ * M_);
+
+    // energy [J / A]
+    // -- unfrozen fraction
+    double uf = uf_->UnfrozenFraction(T);
+    double duf_dT = uf_->DUnfrozenFractionDT(T);
+
+    // -- densities
+    double rho_l = liquid_eos_->MassDensity(T,p);
+    double drho_l_dT = liquid_eos_->DMassDensityDT(T,p);
+    double drho_l_dp = liquid_eos_->DMassDensityDp(T,p);
+    double n_l = rho_l / M_;
+    double rho_i = ice_eos_->MassDensity(T,p);
+    double drho_i_dT = ice_eos_->DMassDensityDT(T,p);
+    double drho_i_dp = ice_eos_->DMassDensityDp(T,p);
+    double n_i = rho_i / M_;
+
+    // -- ponded depth
+    double h = pd_->Height(p, uf, rho_l, rho_i, p_atm_, gz_);
+    double dh_drho_l = pd_->DHeightDRho_l(p, uf, rho_l, rho_i, p_atm_, gz_);
+    double dh_drho_i = pd_->DHeightDRho_i(p, uf, rho_l, rho_i, p_atm_, gz_);
+    double dh_dT = pd_->DHeightDEta(p, uf, rho_l, rho_i, p_atm_, gz_) * duf_dT
+        + dh_drho_l * drho_l_dT + dh_drho_i * drho_i_dT;
+    double dh_dp = pd_->DHeightDPressure(p, uf, rho_l, rho_i, p_atm_, gz_)
+        + dh_drho_l * drho_l_dp + dh_drho_i * drho_i_dp;
+
+    // -- internal energies
+    double u_l = liquid_iem_->InternalEnergy(T);
+    double du_l_dT = liquid_iem_->DInternalEnergyDT(T);
+    double u_i = ice_iem_->InternalEnergy(T);
+    double du_i_dT = ice_iem_->DInternalEnergyDT(T);
+
+    // energy per unit depth, and energy
+    double e = uf * n_l * u_l + (1-uf) * n_i * u_i;
+    double de_dT = duf_dT * (n_l * u_l - n_i * u_i)
+        + uf * (drho_l_dT / M_ * u_l + n_l * du_l_dT)
+        + (1-uf) * (drho_i_dT / M_ * u_i + n_i * du_i_dT);
+    double de_dp = uf * drho_l_dp / M_ * u_l + (1-uf) * drho_i_dp / M_ * u_i;
+
+    // store solution
+    result[1] = WC;
+    result[0] = h * e;
+    jac(1,0) = 0.;
+    jac(1,1) = dWC_dp;
+    jac(0,0) = dh_dT * e + h * de_dT;
+    jac(0,1) = dh_dp * e + h * de_dp;
+
+  } catch (const Exceptions::Amanzi_exception& e) {
+    if (e.what() == std::string("Cut time step")) {
+      ierr = 1;
+    }
+  }
+
+  // on a plateau of the model the exact Jacobian is singular
+  if (!ierr && IsSingular_(jac)) {
+    ierr = EvaluateEnergyAndWaterContentAndJacobian_FD_(T, p, result, jac);
+  }
+  return ierr;
+}
+
 
 } // namespace
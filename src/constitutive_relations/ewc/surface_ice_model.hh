@@ -52,6 +52,10 @@ class SurfaceIceModel : public EWCModelBase {
   int EvaluateEnergyAndWaterContent_(double T, double p,
           AmanziGeometry::Point& result);
 
+  // Exact Jacobian by the chain rule through the constitutive models.
+  int EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+          AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
  protected:
   Teuchos::RCP<Flow::IcyHeightModel> pd_;
   Teuchos::RCP<Flow::UnfrozenFractionModel> uf_;
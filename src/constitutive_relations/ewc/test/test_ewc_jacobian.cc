@@ -0,0 +1,202 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Tests the exact Jacobians of the EWC models against their finite
+  difference Jacobians in frozen, thawed, and transition states, and the
+  fall back to finite differences where the exact Jacobian is singular.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <cmath>
+#include <iostream>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "eos_water.hh"
+#include "eos_ice.hh"
+#include "eos_ideal_gas.hh"
+#include "vapor_pressure_water.hh"
+#include "wrm_van_genuchten.hh"
+#include "wrm_fpd_permafrost_model.hh"
+#include "pc_ice_water.hh"
+#include "pc_liq_atm.hh"
+#include "iem_linear.hh"
+#include "iem_water_vapor.hh"
+#include "compressible_porosity_model.hh"
+#include "unfrozen_fraction_model.hh"
+#include "icy_height_model.hh"
+
+#include "permafrost_model.hh"
+#include "liquid_ice_model.hh"
+#include "surface_ice_model.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+const double p_atm = 101325.;
+
+// The models with their relations set directly, without a State, exposing
+// both Jacobians.
+template<class Model>
+class TestSubsurfaceModel : public Model {
+ public:
+  TestSubsurfaceModel() {
+    Teuchos::ParameterList wrm_plist;
+    wrm_plist.set("van Genuchten m", 0.5);
+    wrm_plist.set("van Genuchten alpha", 1.5e-4);
+    wrm_plist.set("van Genuchten residual saturation", 0.1);
+    wrm_plist.set("van Genuchten smoothing interval width", 0.0);
+    Teuchos::ParameterList perm_plist;
+    this->wrm_ = Teuchos::rcp(new Flow::WRMFPDPermafrostModel(perm_plist));
+    this->wrm_->set_WRM(Teuchos::rcp(new Flow::WRMVanGenuchten(wrm_plist)));
+
+    Teuchos::ParameterList plist;
+    this->liquid_eos_ = Teuchos::rcp(new Relations::EOSWater(plist));
+    this->ice_eos_ = Teuchos::rcp(new Relations::EOSIce(plist));
+    this->pc_i_ = Teuchos::rcp(new Flow::PCIceWater(plist));
+    this->pc_l_ = Teuchos::rcp(new Flow::PCLiqAtm(plist));
+
+    Teuchos::ParameterList liq_plist;
+    liq_plist.set("heat capacity [J/mol-K]", 76.0);
+    this->liquid_iem_ = Teuchos::rcp(new Energy::IEMLinear(liq_plist));
+    Teuchos::ParameterList ice_plist;
+    ice_plist.set("heat capacity [J/mol-K]", 37.7);
+    ice_plist.set("latent heat [J/mol]", -6007.86);
+    this->ice_iem_ = Teuchos::rcp(new Energy::IEMLinear(ice_plist));
+    Teuchos::ParameterList rock_plist;
+    rock_plist.set("heat capacity [J/kg-K]", 620.0);
+    this->rock_iem_ = Teuchos::rcp(new Energy::IEMLinear(rock_plist));
+
+    Teuchos::ParameterList poro_plist;
+    poro_plist.set("pore compressibility [Pa^-1]", 1.e-9);
+    this->poro_model_ = Teuchos::rcp(new Flow::CompressiblePorosityModel(poro_plist));
+    this->poro_leij_ = false;
+
+    this->p_atm_ = p_atm;
+    this->poro_ = 0.4;
+    this->rho_rock_ = 2600.;
+  }
+
+  using Model::EvaluateEnergyAndWaterContentAndJacobian_;
+  using Model::EvaluateEnergyAndWaterContentAndJacobian_FD_;
+};
+
+typedef TestSubsurfaceModel<LiquidIceModel> TestLiquidIceModel;
+
+class TestPermafrostModel : public TestSubsurfaceModel<PermafrostModel> {
+ public:
+  TestPermafrostModel() {
+    Teuchos::ParameterList plist;
+    gas_eos_ = Teuchos::rcp(new Relations::EOSIdealGas(plist));
+    vpr_ = Teuchos::rcp(new Relations::VaporPressureWater(plist));
+    gas_iem_ = Teuchos::rcp(new Energy::IEMWaterVapor(plist));
+    AMANZI_ASSERT(IsSetUp_());
+  }
+};
+
+class TestSurfaceIceModel : public SurfaceIceModel {
+ public:
+  TestSurfaceIceModel() {
+    Teuchos::ParameterList plist;
+    pd_ = Teuchos::rcp(new Flow::IcyHeightModel(plist));
+    uf_ = Teuchos::rcp(new Flow::UnfrozenFractionModel(plist));
+    liquid_eos_ = Teuchos::rcp(new Relations::EOSWater(plist));
+    ice_eos_ = Teuchos::rcp(new Relations::EOSIce(plist));
+
+    Teuchos::ParameterList liq_plist;
+    liq_plist.set("heat capacity [J/mol-K]", 76.0);
+    liquid_iem_ = Teuchos::rcp(new Energy::IEMLinear(liq_plist));
+    Teuchos::ParameterList ice_plist;
+    ice_plist.set("heat capacity [J/mol-K]", 37.7);
+    ice_plist.set("latent heat [J/mol]", -6007.86);
+    ice_iem_ = Teuchos::rcp(new Energy::IEMLinear(ice_plist));
+
+    p_atm_ = p_atm;
+    gz_ = 9.80665;
+    M_ = 0.0180153;
+    AMANZI_ASSERT(IsSetUp_());
+  }
+
+  using SurfaceIceModel::EvaluateEnergyAndWaterContentAndJacobian_;
+  using SurfaceIceModel::EvaluateEnergyAndWaterContentAndJacobian_FD_;
+};
+
+
+// Exact and FD Jacobians agree to the truncation and round-off error of the
+// FD, whose T increment is 1e-7 and p increment is 1e-3.
+template<class Model>
+void CheckJacobian(Model& m, double T, double p) {
+  AmanziGeometry::Point res(2), res_fd(2);
+  WhetStone::Tensor jac(2,2), jac_fd(2,2);
+  CHECK_EQUAL(0, m.EvaluateEnergyAndWaterContentAndJacobian_(T, p, res, jac));
+  CHECK_EQUAL(0, m.EvaluateEnergyAndWaterContentAndJacobian_FD_(T, p, res_fd, jac_fd));
+
+  for (int i=0; i!=2; ++i) {
+    CHECK_CLOSE(res_fd[i], res[i], 1.e-12 * std::abs(res_fd[i]));
+    for (int j=0; j!=2; ++j) {
+      double tol = 1.e-4 * (std::abs(jac_fd(i,j)) + std::abs(jac(i,j)))
+          + 1.e-8 * (std::abs(res[i]) + 1.) / (j == 0 ? 1. : 1.e3);
+      CHECK_CLOSE(jac_fd(i,j), jac(i,j), tol);
+    }
+  }
+}
+
+// T in frozen, transition (partially frozen), and thawed states.
+const double Ts[3] = { 263.15, 273.1, 278.15 };
+
+} // namespace
+
+
+SUITE(EWC_JACOBIAN) {
+
+TEST(PermafrostModelJacobian) {
+  TestPermafrostModel m;
+  double ps[2] = { 9.e4, 2.e5 }; // unsaturated, saturated
+  for (int i=0; i!=3; ++i) {
+    for (int k=0; k!=2; ++k) {
+      CheckJacobian(m, Ts[i], ps[k]);
+    }
+  }
+}
+
+TEST(LiquidIceModelJacobian) {
+  TestLiquidIceModel m;
+  double ps[2] = { 9.e4, 2.e5 };
+  for (int i=0; i!=3; ++i) {
+    for (int k=0; k!=2; ++k) {
+      CheckJacobian(m, Ts[i], ps[k]);
+    }
+  }
+}
+
+TEST(SurfaceIceModelJacobian) {
+  TestSurfaceIceModel m;
+  // transition of the unfrozen fraction is [273.05, 273.25]
+  double Ts_surf[3] = { 263.15, 273.12, 278.15 };
+  for (int i=0; i!=3; ++i) {
+    CheckJacobian(m, Ts_surf[i], p_atm + 1000.);
+  }
+}
+
+// Without ponded water the exact Jacobian of the surface model is zero and
+// the FD Jacobian is used instead.
+TEST(SurfaceIceModelJacobianFallback) {
+  TestSurfaceIceModel m;
+  for (int i=0; i!=3; ++i) {
+    AmanziGeometry::Point res(2), res_fd(2);
+    WhetStone::Tensor jac(2,2), jac_fd(2,2);
+    CHECK_EQUAL(0, m.EvaluateEnergyAndWaterContentAndJacobian_(Ts[i], p_atm - 1000., res, jac));
+    CHECK_EQUAL(0, m.EvaluateEnergyAndWaterContentAndJacobian_FD_(Ts[i], p_atm - 1000., res_fd, jac_fd));
+    for (int k=0; k!=2; ++k) {
+      CHECK_EQUAL(res_fd[k], res[k]);
+      for (int j=0; j!=2; ++j) CHECK_EQUAL(jac_fd(k,j), jac(k,j));
+    }
+  }
+}
+
+} // SUITE
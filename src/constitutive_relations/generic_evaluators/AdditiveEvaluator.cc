@@ -10,7 +10,7 @@ namespace Amanzi {
 namespace Relations {
 
 AdditiveEvaluator::AdditiveEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::Array<std::string> names;
   if (!plist.isParameter("evaluator dependencies")) {
@@ -39,7 +39,7 @@ AdditiveEvaluator::AdditiveEvaluator(Teuchos::ParameterList& plist) :
 
 
 AdditiveEvaluator::AdditiveEvaluator(const AdditiveEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     coefs_(other.coefs_) {}
 
 Teuchos::RCP<FieldEvaluator>
@@ -11,7 +11,7 @@ namespace Amanzi {
 namespace Relations {
 
 MultiplicativeEvaluator::MultiplicativeEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   if (!plist.isParameter("evaluator dependencies")) {
     if (plist.isParameter("evaluator dependency suffixes")) {
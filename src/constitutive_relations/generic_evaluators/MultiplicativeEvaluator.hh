@@ -8,12 +8,12 @@
 #define AMANZI_RELATIONS_MULTIPLICATIVE_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class MultiplicativeEvaluator : public SecondaryVariableFieldEvaluator {
+class MultiplicativeEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -28,7 +28,7 @@ namespace Amanzi {
 namespace Relations {
 
 SubgridDisaggregateEvaluator::SubgridDisaggregateEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist),
+    TimedSecondaryVariableFieldEvaluator(plist),
     source_gid_(-1)
 {
   // my_key_ = "surface_column_6-del_max"
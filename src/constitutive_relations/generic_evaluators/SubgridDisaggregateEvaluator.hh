@@ -27,12 +27,12 @@ OR
 #define AMANZI_RELATIONS_SUBGRID_DISAGGREGATOR_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class SubgridDisaggregateEvaluator : public SecondaryVariableFieldEvaluator {
+class SubgridDisaggregateEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -0,0 +1,116 @@
+/*
+  TimedEvaluator is a base for secondary variable evaluators, timing their
+  evaluate and derivative updates.
+
+  Each evaluator has two Teuchos timers, "FieldEvaluator NAME: evaluate" and
+  "FieldEvaluator NAME: derivative", which count the calls of
+  EvaluateField_ and EvaluateFieldPartialDerivative_ through
+  UpdateField_ and UpdateFieldDerivative_.  NAME is the `"timer name`"
+  parameter of the evaluator, by default its (first) key.  Evaluators
+  sharing a timer name share timers, which keeps the timer count down for
+  e.g. one evaluator per column.
+
+  Derive from TimedSecondaryVariableFieldEvaluator or
+  TimedSecondaryVariablesFieldEvaluator in place of the Amanzi base; the
+  Amanzi base is still a base, so casts to it are unchanged.  Evaluators
+  overriding UpdateField_ or UpdateFieldDerivative_ without calling this
+  class's version start the timers themselves.
+
+  Each evaluator also counts its UpdateField_ calls, see VersionedEvaluator,
+  so that the coordinator can tell which fields were written during a
+  timestep without reading their values.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#ifndef AMANZI_RELATIONS_TIMED_EVALUATOR_
+#define AMANZI_RELATIONS_TIMED_EVALUATOR_
+
+#include "Teuchos_TimeMonitor.hpp"
+
+#include "secondary_variable_field_evaluator.hh"
+#include "secondary_variables_field_evaluator.hh"
+
+namespace Amanzi {
+
+// Non-template interface to the update count of a TimedEvaluator.  The
+// version changes whenever the evaluator writes its field(s).
+class VersionedEvaluator {
+ public:
+  VersionedEvaluator() : version_(0) {}
+  virtual ~VersionedEvaluator() = default;
+
+  unsigned long version() const { return version_; }
+
+ protected:
+  unsigned long version_;
+};
+
+
+template<class Base>
+class TimedEvaluator : public Base, public VersionedEvaluator {
+
+ public:
+  explicit
+  TimedEvaluator(Teuchos::ParameterList& plist) : Base(plist) {}
+
+  TimedEvaluator(const TimedEvaluator& other) :
+      Base(other),
+      VersionedEvaluator(other),
+      evaluate_timer_(other.evaluate_timer_),
+      derivative_timer_(other.derivative_timer_) {}
+
+ protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S) override {
+    Teuchos::TimeMonitor monitor(evaluate_timer());
+    Base::UpdateField_(S);
+    ++version_;
+  }
+
+  virtual void UpdateFieldDerivative_(const Teuchos::Ptr<State>& S, Key wrt_key) override {
+    Teuchos::TimeMonitor monitor(derivative_timer());
+    Base::UpdateFieldDerivative_(S, wrt_key);
+  }
+
+  // Timers are created on first use, as many constructors set the keys only
+  // after this one has run.
+  Teuchos::Time& evaluate_timer() {
+    if (evaluate_timer_ == Teuchos::null) evaluate_timer_ = GetTimer_("evaluate");
+    return *evaluate_timer_;
+  }
+
+  Teuchos::Time& derivative_timer() {
+    if (derivative_timer_ == Teuchos::null) derivative_timer_ = GetTimer_("derivative");
+    return *derivative_timer_;
+  }
+
+ private:
+  Key TimerKey_() const;
+
+  Teuchos::RCP<Teuchos::Time> GetTimer_(const std::string& label) {
+    std::string timer_name = this->plist_.template get<std::string>("timer name", TimerKey_());
+    return Teuchos::TimeMonitor::getNewCounter("FieldEvaluator " + timer_name + ": " + label);
+  }
+
+ private:
+  Teuchos::RCP<Teuchos::Time> evaluate_timer_;
+  Teuchos::RCP<Teuchos::Time> derivative_timer_;
+};
+
+
+template<>
+inline Key TimedEvaluator<SecondaryVariableFieldEvaluator>::TimerKey_() const {
+  return my_key_;
+}
+
+template<>
+inline Key TimedEvaluator<SecondaryVariablesFieldEvaluator>::TimerKey_() const {
+  return my_keys_.size() > 0 ? my_keys_[0] : Key();
+}
+
+typedef TimedEvaluator<SecondaryVariableFieldEvaluator> TimedSecondaryVariableFieldEvaluator;
+typedef TimedEvaluator<SecondaryVariablesFieldEvaluator> TimedSecondaryVariablesFieldEvaluator;
+
+} // namespace
+
+#endif
@@ -14,7 +14,7 @@ namespace Relations {
 
 OverlandSourceFromSubsurfaceFluxEvaluator::OverlandSourceFromSubsurfaceFluxEvaluator(
         Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   if (my_key_ == std::string("")) {
     my_key_ = plist_.get<std::string>("source key", "overland_source_from_subsurface");
   }
@@ -42,7 +42,7 @@ OverlandSourceFromSubsurfaceFluxEvaluator::OverlandSourceFromSubsurfaceFluxEvalu
 
 OverlandSourceFromSubsurfaceFluxEvaluator::OverlandSourceFromSubsurfaceFluxEvaluator(
         const OverlandSourceFromSubsurfaceFluxEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     flux_key_(other.flux_key_),
     dens_key_(other.dens_key_),
     surface_mesh_key_(other.surface_mesh_key_),
@@ -11,13 +11,13 @@
 #define AMANZI_RELATIONS_OVERLAND_SOURCE_FROM_SUBSURFACE_FLUX_EVALUATOR_HH_
 
 #include "FieldEvaluator_Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
 class OverlandSourceFromSubsurfaceFluxEvaluator :
-    public SecondaryVariableFieldEvaluator {
+    public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
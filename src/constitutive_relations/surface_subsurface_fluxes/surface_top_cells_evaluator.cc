@@ -17,7 +17,7 @@ namespace Relations {
 
 
 SurfaceTopCellsEvaluator::SurfaceTopCellsEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   auto domain = Keys::getDomain(my_key_);
   std::string subsurf_domain;
@@ -32,7 +32,7 @@ SurfaceTopCellsEvaluator::SurfaceTopCellsEvaluator(Teuchos::ParameterList& plist
 }
 
 SurfaceTopCellsEvaluator::SurfaceTopCellsEvaluator(const SurfaceTopCellsEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     dependency_key_(other.dependency_key_) {}
 
 Teuchos::RCP<FieldEvaluator>
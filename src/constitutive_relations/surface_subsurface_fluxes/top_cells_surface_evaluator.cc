@@ -14,7 +14,7 @@ namespace Relations {
 
 
 TopCellsSurfaceEvaluator::TopCellsSurfaceEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   auto domain = Keys::getDomain(my_key_);
   std::string surf_domain;
   if (Keys::getDomain(my_key_).empty()) {
@@ -30,7 +30,7 @@ TopCellsSurfaceEvaluator::TopCellsSurfaceEvaluator(Teuchos::ParameterList& plist
 }
 
 TopCellsSurfaceEvaluator::TopCellsSurfaceEvaluator(const TopCellsSurfaceEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     negate_(other.negate_),
     dependency_key_(other.dependency_key_) {}
 
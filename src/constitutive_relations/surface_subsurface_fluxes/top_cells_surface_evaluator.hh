@@ -12,12 +12,12 @@
 
 #include "Factory.hh"
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class TopCellsSurfaceEvaluator : public SecondaryVariableFieldEvaluator {
+class TopCellsSurfaceEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -5,7 +5,7 @@ namespace Relations {
 
   Volumetric_FluxEvaluator::Volumetric_FluxEvaluator(
                                                      Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
     if (my_key_ == std::string("")) {
       my_key_ = plist_.get<std::string>("vol darcy flux key", "vol_darcy_flux");
     }
@@ -21,7 +21,7 @@ namespace Relations {
   }
 
   Volumetric_FluxEvaluator::Volumetric_FluxEvaluator(const Volumetric_FluxEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     flux_key_(other.flux_key_),
     dens_key_(other.dens_key_),
     mesh_key_(other.mesh_key_)
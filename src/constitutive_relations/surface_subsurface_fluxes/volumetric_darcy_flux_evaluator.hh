@@ -9,13 +9,13 @@
 #define AMANZI_RELATIONS_VOL_DARCY_FLUX_HH_
 
 #include "FieldEvaluator_Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
 class Volumetric_FluxEvaluator :
-    public SecondaryVariableFieldEvaluator {
+    public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
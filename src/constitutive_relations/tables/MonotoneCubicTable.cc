@@ -0,0 +1,97 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  A uniformly spaced, monotone cubic lookup table.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <cmath>
+#include <algorithm>
+
+#include "errors.hh"
+#include "MonotoneCubicTable.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+// number of interior samples per interval used in error estimates
+const int TABLE_ERROR_SAMPLES = 4;
+
+void
+MonotoneCubicTable::Setup(double x0, double x1, int npoints,
+                          const std::function<double(double)>& f) {
+  if (npoints < 2 || !(x1 > x0)) {
+    Errors::Message msg("MonotoneCubicTable: requires at least 2 points on a non-empty interval.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  x0_ = x0;
+  x1_ = x1;
+  dx_ = (x1 - x0) / (npoints - 1);
+
+  y_.resize(npoints);
+  for (int i=0; i!=npoints; ++i) {
+    y_[i] = f(i == npoints-1 ? x1 : x0 + i*dx_);
+  }
+
+  // secant slopes
+  std::vector<double> d(npoints-1);
+  for (int i=0; i!=npoints-1; ++i) {
+    d[i] = (y_[i+1] - y_[i]) / dx_;
+  }
+
+  // initial slopes: one-sided at the ends, averaged or zero at extrema
+  m_.resize(npoints);
+  m_[0] = d[0];
+  m_[npoints-1] = d[npoints-2];
+  for (int i=1; i!=npoints-1; ++i) {
+    m_[i] = d[i-1]*d[i] <= 0. ? 0. : 0.5 * (d[i-1] + d[i]);
+  }
+
+  // Fritsch-Carlson limiter keeps each interval monotone
+  for (int i=0; i!=npoints-1; ++i) {
+    if (d[i] == 0.) {
+      m_[i] = 0.;
+      m_[i+1] = 0.;
+    } else {
+      double a = m_[i] / d[i];
+      double b = m_[i+1] / d[i];
+      double r2 = a*a + b*b;
+      if (r2 > 9.) {
+        double tau = 3. / std::sqrt(r2);
+        m_[i] = tau * a * d[i];
+        m_[i+1] = tau * b * d[i];
+      }
+    }
+  }
+}
+
+
+double
+MonotoneCubicTable::MaxError(const std::function<double(double)>& f) const {
+  double err = 0.;
+  for (int i=0; i!=size()-1; ++i) {
+    for (int k=1; k!=TABLE_ERROR_SAMPLES+1; ++k) {
+      double x = x0_ + (i + k / (TABLE_ERROR_SAMPLES + 1.0)) * dx_;
+      err = std::max(err, std::abs((*this)(x) - f(x)));
+    }
+  }
+  return err;
+}
+
+
+double
+MonotoneCubicTable::MaxDerivativeError(const std::function<double(double)>& df) const {
+  double err = 0.;
+  for (int i=0; i!=size()-1; ++i) {
+    for (int k=1; k!=TABLE_ERROR_SAMPLES+1; ++k) {
+      double x = x0_ + (i + k / (TABLE_ERROR_SAMPLES + 1.0)) * dx_;
+      err = std::max(err, std::abs(Derivative(x) - df(x)));
+    }
+  }
+  return err;
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,90 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! MonotoneCubicTable: a uniformly spaced, monotone cubic lookup table.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Tabulates a scalar function of one variable on uniformly spaced nodes and
+interpolates with cubic Hermite polynomials.  Node slopes are the
+Fritsch-Carlson limited slopes, so the interpolant is monotone on every
+interval on which the tabulated data are monotone, and it has a continuous
+first derivative.
+
+Lookup is O(1): no search is needed on a uniform grid.  This is used by the
+"tabulated" WRM, EOS, and viscosity models to replace transcendental
+function evaluations in their hot loops.
+
+*/
+
+#ifndef AMANZI_RELATIONS_MONOTONE_CUBIC_TABLE_HH_
+#define AMANZI_RELATIONS_MONOTONE_CUBIC_TABLE_HH_
+
+#include <functional>
+#include <vector>
+
+namespace Amanzi {
+namespace Relations {
+
+class MonotoneCubicTable {
+
+ public:
+  MonotoneCubicTable() : x0_(0.), x1_(0.), dx_(0.) {}
+
+  // Tabulates f on npoints uniformly spaced nodes in [x0, x1].
+  void Setup(double x0, double x1, int npoints,
+             const std::function<double(double)>& f);
+
+  bool InRange(double x) const { return x >= x0_ && x <= x1_; }
+
+  // Interpolated value and derivative, x must be InRange().
+  double operator()(double x) const {
+    int i = Interval_(x);
+    double t = (x - (x0_ + i*dx_)) / dx_;
+    double omt = 1.0 - t;
+    return (1.0 + 2.0*t) * omt*omt * y_[i]
+        + t * omt*omt * dx_ * m_[i]
+        + t*t * (3.0 - 2.0*t) * y_[i+1]
+        - t*t * omt * dx_ * m_[i+1];
+  }
+
+  double Derivative(double x) const {
+    int i = Interval_(x);
+    double t = (x - (x0_ + i*dx_)) / dx_;
+    return 6.0*t*(t - 1.0) * (y_[i] - y_[i+1]) / dx_
+        + (3.0*t*t - 4.0*t + 1.0) * m_[i]
+        + (3.0*t*t - 2.0*t) * m_[i+1];
+  }
+
+  // Maximum error of the table (or its derivative) against a reference,
+  // sampled at interior points of every interval.
+  double MaxError(const std::function<double(double)>& f) const;
+  double MaxDerivativeError(const std::function<double(double)>& df) const;
+
+  double x0() const { return x0_; }
+  double x1() const { return x1_; }
+  int size() const { return y_.size(); }
+
+ private:
+  int Interval_(double x) const {
+    int i = static_cast<int>((x - x0_) / dx_);
+    int imax = y_.size() - 2;
+    return i < 0 ? 0 : (i > imax ? imax : i);
+  }
+
+ private:
+  double x0_, x1_, dx_;
+  std::vector<double> y_;  // values at the nodes
+  std::vector<double> m_;  // limited slopes at the nodes
+};
+
+} // namespace
+} // namespace
+
+#endif
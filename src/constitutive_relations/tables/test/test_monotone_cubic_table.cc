@@ -0,0 +1,93 @@
+#include <cmath>
+#include <iostream>
+#include "UnitTest++.h"
+
+#include "errors.hh"
+#include "MonotoneCubicTable.hh"
+
+using namespace Amanzi::Relations;
+
+SUITE(MONOTONE_CUBIC_TABLE) {
+
+// The table reproduces the function at its nodes, including both endpoints.
+TEST(TableNodesAndEndpoints) {
+  MonotoneCubicTable table;
+  table.Setup(0.0, 1.0, 11, [](double x) { return std::exp(x); });
+
+  CHECK_EQUAL(11, table.size());
+  CHECK_EQUAL(0.0, table.x0());
+  CHECK_EQUAL(1.0, table.x1());
+  CHECK_EQUAL(std::exp(0.0), table(0.0));
+  CHECK_CLOSE(std::exp(1.0), table(1.0), 1.e-14);
+  for (int i=0; i!=11; ++i) {
+    double x = 0.1 * i;
+    CHECK_CLOSE(std::exp(x), table(x), 1.e-13);
+  }
+}
+
+
+// InRange() covers exactly the closed interval; outside it, callers use the
+// model they tabulated.
+TEST(TableRange) {
+  MonotoneCubicTable table;
+  table.Setup(-2.0, 3.0, 51, [](double x) { return x*x*x; });
+
+  CHECK(table.InRange(-2.0));
+  CHECK(table.InRange(3.0));
+  CHECK(table.InRange(0.5));
+  CHECK(!table.InRange(-2.0 - 1.e-12));
+  CHECK(!table.InRange(3.0 + 1.e-12));
+}
+
+
+TEST(TableBadSetup) {
+  MonotoneCubicTable table;
+  CHECK_THROW(table.Setup(0.0, 1.0, 1, [](double x) { return x; }), Errors::Message);
+  CHECK_THROW(table.Setup(1.0, 1.0, 10, [](double x) { return x; }), Errors::Message);
+  CHECK_THROW(table.Setup(1.0, 0.0, 10, [](double x) { return x; }), Errors::Message);
+}
+
+
+// Monotone data give a monotone interpolant, even where an unlimited cubic
+// would overshoot: a steep front next to flat regions.
+TEST(TableMonotone) {
+  auto f = [](double x) { return x < 0.45 ? 0. : (x > 0.55 ? 1. : 10.*(x - 0.45)); };
+  MonotoneCubicTable table;
+  table.Setup(0.0, 1.0, 21, f);
+
+  double last = table(0.0);
+  for (int i=1; i<=2000; ++i) {
+    double x = i / 2000.;
+    double y = table(x);
+    CHECK(y >= last - 1.e-14);
+    CHECK(table.Derivative(x) >= -1.e-12);
+    last = y;
+  }
+  CHECK(table(0.3) == 0.);
+  CHECK_CLOSE(1., table(0.8), 1.e-14);
+}
+
+
+// Accuracy against a smooth analytic function at the midpoints between
+// nodes.  Interior slopes are second order; the end slopes are one-sided
+// secants, so the end intervals are less accurate.
+TEST(TableAccuracy) {
+  MonotoneCubicTable table;
+  table.Setup(0.0, 1.0, 101, [](double x) { return std::exp(x); });
+
+  for (int i=1; i!=99; ++i) {
+    double x = (i + 0.5) * 0.01;
+    CHECK_CLOSE(std::exp(x), table(x), 1.e-6);
+    CHECK_CLOSE(std::exp(x), table.Derivative(x), 1.e-3);
+  }
+  for (int i=0; i!=100; i+=99) {
+    double x = (i + 0.5) * 0.01;
+    CHECK_CLOSE(std::exp(x), table(x), 5.e-5);
+    CHECK_CLOSE(std::exp(x), table.Derivative(x), 2.e-2);
+  }
+
+  CHECK(table.MaxError([](double x) { return std::exp(x); }) < 5.e-5);
+  CHECK(table.MaxDerivativeError([](double x) { return std::exp(x); }) < 2.e-2);
+}
+
+}
@@ -0,0 +1,304 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/* -------------------------------------------------------------------------
+ATS
+
+License: see $ATS_DIR/COPYRIGHT
+Author: Ethan Coon
+
+Implementation for AggregatedVisualization, which writes all subdomains of a
+domain set into one file per dump with nonblocking MPI-IO.
+------------------------------------------------------------------------- */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+
+#include "boost/algorithm/string/predicate.hpp"
+
+#include "errors.hh"
+#include "Key.hh"
+#include "State.hh"
+
+#include "aggregated_visualization.hh"
+
+namespace ATS {
+
+// -----------------------------------------------------------------------------
+// Gather a string from every rank, in rank order, onto all ranks.
+// -----------------------------------------------------------------------------
+static std::string AllGatherString(const std::string& local, MPI_Comm comm, bool to_all) {
+  int size, rank;
+  MPI_Comm_size(comm, &size);
+  MPI_Comm_rank(comm, &rank);
+
+  int len = local.size();
+  std::vector<int> lens(size), displs(size, 0);
+  if (to_all) {
+    MPI_Allgather(&len, 1, MPI_INT, &lens[0], 1, MPI_INT, comm);
+  } else {
+    MPI_Gather(&len, 1, MPI_INT, &lens[0], 1, MPI_INT, 0, comm);
+  }
+
+  int total = 0;
+  for (int i=0; i!=size; ++i) {
+    displs[i] = total;
+    total += lens[i];
+  }
+
+  std::vector<char> all(total + 1, '\0');
+  if (to_all) {
+    MPI_Allgatherv(const_cast<char*>(local.data()), len, MPI_CHAR,
+                   &all[0], &lens[0], &displs[0], MPI_CHAR, comm);
+  } else {
+    MPI_Gatherv(const_cast<char*>(local.data()), len, MPI_CHAR,
+                &all[0], &lens[0], &displs[0], MPI_CHAR, 0, comm);
+  }
+  return std::string(&all[0], total);
+}
+
+
+AggregatedVisualization::AggregatedVisualization(Teuchos::ParameterList& plist,
+        const std::string& domain_set,
+        const Amanzi::State& S,
+        const Amanzi::Comm_ptr_type& comm) :
+    Amanzi::IOEvent(plist),
+    domain_set_(domain_set),
+    mesh_deformed_(false),
+    file_(MPI_FILE_NULL),
+    writing_(false) {
+  filename_base_ = plist.get<std::string>("file name base", std::string("visdump_")+domain_set);
+
+  Teuchos::RCP<const Amanzi::MpiComm_type> mpi_comm =
+      Teuchos::rcp_dynamic_cast<const Amanzi::MpiComm_type>(comm);
+  comm_ = mpi_comm->Comm();
+
+  // local subdomains, the State's mesh map is sorted by name
+  for (auto m=S.mesh_begin(); m!=S.mesh_end(); ++m) {
+    if (boost::starts_with(m->first, domain_set)) {
+      subdomains_.push_back(m->first);
+      meshes_.push_back(m->second.first);
+      ncells_.push_back(m->second.first->num_entities(Amanzi::AmanziMesh::CELL,
+              Amanzi::AmanziMesh::Parallel_type::OWNED));
+    }
+  }
+
+  ncells_local_ = 0;
+  for (int i=0; i!=ncells_.size(); ++i) ncells_local_ += ncells_[i];
+  offset_ = 0;
+  MPI_Exscan(&ncells_local_, &offset_, 1, MPI_LONG_LONG, MPI_SUM, comm_);
+  int rank;
+  MPI_Comm_rank(comm_, &rank);
+  if (rank == 0) offset_ = 0;
+  MPI_Allreduce(&ncells_local_, &ncells_total_, 1, MPI_LONG_LONG, MPI_SUM, comm_);
+
+  // vis fields on any subdomain, agreed on by all ranks
+  std::stringstream local_fields;
+  for (Amanzi::State::field_iterator field=S.field_begin(); field!=S.field_end(); ++field) {
+    if (!field->second->io_vis() ||
+        field->second->type() != Amanzi::COMPOSITE_VECTOR_FIELD) continue;
+
+    Amanzi::Key domain = Amanzi::Keys::getDomain(field->first);
+    if (std::find(subdomains_.begin(), subdomains_.end(), domain) == subdomains_.end()) continue;
+
+    Teuchos::RCP<const Amanzi::CompositeVector> vec = field->second->GetFieldData();
+    if (!vec->HasComponent("cell")) continue;
+
+    local_fields << field->first.substr(domain.size()+1) << " "
+                 << vec->ViewComponent("cell", false)->NumVectors() << std::endl;
+  }
+
+  std::map<std::string,int> fields;
+  std::stringstream all_fields(AllGatherString(local_fields.str(), comm_, true));
+  std::string var;
+  int ndofs;
+  while (all_fields >> var >> ndofs) {
+    fields[var] = std::max(fields[var], ndofs);
+  }
+  for (std::map<std::string,int>::const_iterator f=fields.begin(); f!=fields.end(); ++f) {
+    for (int i=0; i!=f->second; ++i) {
+      field_vars_.push_back(f->first);
+      field_dofs_.push_back(i);
+    }
+  }
+
+  // the mesh file, cell volumes and centroids
+  dim_ = meshes_.size() > 0 ? meshes_[0]->space_dimension() : 3;
+  MPI_Allreduce(MPI_IN_PLACE, &dim_, 1, MPI_INT, MPI_MAX, comm_);
+  WriteMesh_(S.cycle(), S.time());
+
+  std::vector<std::string> geom_names(1, "cell_volume");
+  const char* xyz[3] = {"centroid.x", "centroid.y", "centroid.z"};
+  for (int d=0; d!=dim_; ++d) geom_names.push_back(xyz[d]);
+  WriteIndex_(geom_names);
+}
+
+
+AggregatedVisualization::~AggregatedVisualization() {
+  // Finish() must be called by the owner before MPI shuts down; if that was
+  // missed, e.g. on an error, the dump in flight is completed and its file
+  // closed here.
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (writing_ && !finalized) Finish();
+}
+
+
+void AggregatedVisualization::MeshDeformed(
+        const Teuchos::RCP<const Amanzi::AmanziMesh::Mesh>& mesh) {
+  for (int i=0; i!=meshes_.size(); ++i) {
+    if (meshes_[i].get() == mesh.get()) mesh_deformed_ = true;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Pack the cell values of every field and start writing them.
+// -----------------------------------------------------------------------------
+void AggregatedVisualization::Write(const Amanzi::State& S) {
+  // the buffer is reused, so the previous dump must be done
+  Finish();
+
+  // rewrite the geometry if it changed on any rank
+  int deformed = mesh_deformed_ ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &deformed, 1, MPI_INT, MPI_LOR, comm_);
+  if (deformed) WriteMesh_(S.cycle(), S.time());
+  mesh_deformed_ = false;
+
+  buffer_.assign(field_vars_.size() * ncells_local_, std::numeric_limits<double>::quiet_NaN());
+  for (int j=0; j!=field_vars_.size(); ++j) {
+    double* dest = &buffer_[0] + j*ncells_local_;
+    for (int i=0; i!=subdomains_.size(); ++i) {
+      Amanzi::Key key = Amanzi::Keys::getKey(subdomains_[i], field_vars_[j]);
+      if (S.HasField(key)) {
+        Teuchos::RCP<const Amanzi::CompositeVector> vec = S.GetFieldData(key);
+        if (vec->HasComponent("cell")) {
+          const Epetra_MultiVector& vec_c = *vec->ViewComponent("cell", false);
+          if (field_dofs_[j] < vec_c.NumVectors()) {
+            for (int c=0; c!=ncells_[i]; ++c) dest[c] = vec_c[field_dofs_[j]][c];
+          }
+        }
+      }
+      dest += ncells_[i];
+    }
+  }
+
+  std::stringstream filename;
+  filename << filename_base_ << "_" << std::setfill('0') << std::setw(5) << S.cycle() << ".bin";
+  WriteFile_(filename.str(), S.cycle(), S.time(), field_vars_.size());
+}
+
+
+// -----------------------------------------------------------------------------
+// Complete the dump in flight, if any.
+// -----------------------------------------------------------------------------
+void AggregatedVisualization::Finish() {
+  if (!writing_) return;
+
+  if (requests_.size() > 0) {
+    MPI_Waitall(requests_.size(), &requests_[0], MPI_STATUSES_IGNORE);
+  }
+  requests_.clear();
+  MPI_File_close(&file_);
+  writing_ = false;
+}
+
+
+// -----------------------------------------------------------------------------
+// Write the cell volumes and centroids of the current geometry, blocking.
+// -----------------------------------------------------------------------------
+void AggregatedVisualization::WriteMesh_(int cycle, double time) {
+  buffer_.resize((dim_+1) * ncells_local_);
+  int lcv = 0;
+  for (int i=0; i!=meshes_.size(); ++i) {
+    for (int c=0; c!=ncells_[i]; ++c) {
+      buffer_[lcv] = meshes_[i]->cell_volume(c);
+      Amanzi::AmanziGeometry::Point cc = meshes_[i]->cell_centroid(c);
+      for (int d=0; d!=dim_; ++d) buffer_[(d+1)*ncells_local_ + lcv] = cc[d];
+      lcv++;
+    }
+  }
+  WriteFile_(filename_base_+"_mesh.bin", cycle, time, dim_+1);
+  Finish();
+}
+
+
+// -----------------------------------------------------------------------------
+// Start the nonblocking write of buffer_, holding nfields arrays.
+// -----------------------------------------------------------------------------
+void AggregatedVisualization::WriteFile_(const std::string& filename,
+        int cycle, double time, int nfields) {
+  int ierr = MPI_File_open(comm_, const_cast<char*>(filename.c_str()),
+                           MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file_);
+  if (ierr != MPI_SUCCESS) {
+    Errors::Message msg;
+    msg << "AggregatedVisualization: cannot open \"" << filename << "\" for writing.";
+    Exceptions::amanzi_throw(msg);
+  }
+  writing_ = true;
+
+  // an existing, longer file would keep its trailing bytes
+  MPI_File_set_size(file_, 0);
+
+  int rank;
+  MPI_Comm_rank(comm_, &rank);
+  if (rank == 0) {
+    long long cycle_ll = cycle, nfields_ll = nfields;
+    std::memset(header_, 0, 64);
+    std::memcpy(header_, "ATSAGGV1", 8);
+    std::memcpy(header_+8, &cycle_ll, 8);
+    std::memcpy(header_+16, &time, 8);
+    std::memcpy(header_+24, &nfields_ll, 8);
+    std::memcpy(header_+32, &ncells_total_, 8);
+
+    MPI_Request req;
+    MPI_File_iwrite_at(file_, 0, header_, 64, MPI_BYTE, &req);
+    requests_.push_back(req);
+  }
+
+  if (ncells_local_ > 0) {
+    for (int j=0; j!=nfields; ++j) {
+      MPI_Offset offset = 64 + ((MPI_Offset) j * ncells_total_ + offset_) * sizeof(double);
+      MPI_Request req;
+      MPI_File_iwrite_at(file_, offset, &buffer_[j*ncells_local_], ncells_local_,
+                         MPI_DOUBLE, &req);
+      requests_.push_back(req);
+    }
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Rank 0 writes the index of fields and subdomains.
+// -----------------------------------------------------------------------------
+void AggregatedVisualization::WriteIndex_(const std::vector<std::string>& geom_names) {
+  std::stringstream local;
+  long long offset = offset_;
+  for (int i=0; i!=subdomains_.size(); ++i) {
+    local << subdomains_[i] << " " << offset << " " << ncells_[i] << std::endl;
+    offset += ncells_[i];
+  }
+  std::string all = AllGatherString(local.str(), comm_, false);
+
+  int rank;
+  MPI_Comm_rank(comm_, &rank);
+  if (rank == 0) {
+    std::ofstream index((filename_base_+"_index.txt").c_str());
+    index << "# ATS aggregated visualization of domain set \"" << domain_set_ << "\"" << std::endl
+          << "mesh fields " << geom_names.size() << std::endl;
+    for (int j=0; j!=geom_names.size(); ++j) index << geom_names[j] << std::endl;
+
+    index << "fields " << field_vars_.size() << std::endl;
+    for (int j=0; j!=field_vars_.size(); ++j) {
+      index << field_vars_[j] << "." << field_dofs_[j] << std::endl;
+    }
+
+    index << "cells " << ncells_total_ << std::endl
+          << "subdomains" << std::endl << all;
+  }
+}
+
+} // close namespace ATS
@@ -0,0 +1,122 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! AggregatedVisualization: one file per dump for all subdomains of a domain set.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+A domain set in the `"visualization`" list, e.g. `"column_*`", normally
+writes a separate set of vis files for every subdomain.  When
+`"aggregate subdomains`" is set in that sublist, all subdomains of the set
+are instead written into a single binary file per dump, with one index
+file describing it.
+
+Each dump file, `"FILE_NAME_BASE_CYCLE.bin`", is a 64 byte header (the
+8 character tag ``ATSAGGV1``, then the cycle as int64, the time as double,
+the number of fields as int64, and the total number of cells as int64)
+followed by one contiguous array of doubles per field, of length the total
+number of cells.  Within each array, subdomains are stored one after
+another.  The index file, `"FILE_NAME_BASE_index.txt`", lists the field
+names in file order, then each subdomain's name, offset, and number of
+cells.  Cell volumes and centroids are written in the same format to
+`"FILE_NAME_BASE_mesh.bin`", at the start and again with the next dump
+after any subdomain mesh is deformed; its header holds the cycle and time
+of that dump.
+
+Fields are the cell components of all fields flagged for vis on any
+subdomain of the set, written one dof at a time as `"NAME.DOF`".  A value
+missing on a subdomain is written as NaN.
+
+Files are written with nonblocking MPI-IO, so that the time loop continues
+while a dump is written.  A dump only waits for the previous one to
+finish.
+
+* `"aggregate subdomains`" ``[bool]`` **false** Write the domain set
+  aggregated, as above.
+
+* `"file name base`" ``[string]`` **"visdump_DOMAIN_SET"**
+
+* IOEvent_ spec, determines when dumps are written.
+
+*/
+
+#ifndef ATS_AGGREGATED_VISUALIZATION_HH_
+#define ATS_AGGREGATED_VISUALIZATION_HH_
+
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "AmanziComm.hh"
+#include "Mesh.hh"
+#include "IOEvent.hh"
+
+namespace Amanzi {
+class State;
+};
+
+namespace ATS {
+
+class AggregatedVisualization : public Amanzi::IOEvent {
+
+ public:
+  AggregatedVisualization(Teuchos::ParameterList& plist,
+                          const std::string& domain_set,
+                          const Amanzi::State& S,
+                          const Amanzi::Comm_ptr_type& comm);
+  ~AggregatedVisualization();
+
+  // Pack the fields of S and start writing them.
+  void Write(const Amanzi::State& S);
+
+  // Block until the last dump is written and its file closed.  Collective.
+  void Finish();
+
+  // Hook for deformed meshes: if mesh is a subdomain, the mesh file is
+  // rewritten with the next dump.
+  void MeshDeformed(const Teuchos::RCP<const Amanzi::AmanziMesh::Mesh>& mesh);
+
+ private:
+  void WriteMesh_(int cycle, double time);
+  void WriteFile_(const std::string& filename, int cycle, double time, int nfields);
+  void WriteIndex_(const std::vector<std::string>& geom_names);
+
+ private:
+  std::string domain_set_;
+  std::string filename_base_;
+  MPI_Comm comm_;
+
+  // local subdomains, sorted by name
+  std::vector<std::string> subdomains_;
+  std::vector<Teuchos::RCP<const Amanzi::AmanziMesh::Mesh> > meshes_;
+  std::vector<int> ncells_;
+  int dim_;
+  bool mesh_deformed_;
+
+  // fields, identical on all ranks: variable name and dof
+  std::vector<std::string> field_vars_;
+  std::vector<int> field_dofs_;
+
+  // this rank's cells start at offset_ of ncells_total_
+  long long ncells_local_;
+  long long offset_;
+  long long ncells_total_;
+
+  // buffers owned by the write in flight
+  std::vector<double> buffer_;
+  char header_[64];
+  MPI_File file_;
+  std::vector<MPI_Request> requests_;
+  bool writing_;
+};
+
+} // close namespace ATS
+
+#endif
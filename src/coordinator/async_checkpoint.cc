@@ -0,0 +1,211 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/* -------------------------------------------------------------------------
+ATS
+
+License: see $ATS_DIR/COPYRIGHT
+Author: Ethan Coon
+
+Implementation for AsyncCheckpoint, which snapshots the State and writes
+checkpoints on a background thread.
+------------------------------------------------------------------------- */
+
+#include <exception>
+#include <sstream>
+
+#include "errors.hh"
+#include "Checkpoint.hh"
+#include "State.hh"
+
+#include "async_checkpoint.hh"
+
+namespace ATS {
+
+AsyncCheckpoint::AsyncCheckpoint(Teuchos::ParameterList& chkp_plist,
+        Teuchos::ParameterList& coordinator_plist,
+        const Amanzi::Comm_ptr_type& comm,
+        const Teuchos::RCP<Amanzi::VerboseObject>& vo) :
+    comm_(comm),
+    comm_dup_(MPI_COMM_NULL),
+    writing_(false),
+    stop_(false),
+    vo_(vo) {
+  async_ = coordinator_plist.get<bool>("asynchronous checkpoint", false);
+  max_outstanding_ = coordinator_plist.get<int>("asynchronous checkpoint max outstanding", 1);
+  if (max_outstanding_ < 1) {
+    Errors::Message msg("Coordinator: \"asynchronous checkpoint max outstanding\" must be positive.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // the writer thread calls MPI concurrently with the time loop
+  if (async_) {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      async_ = false;
+      if (vo_->os_OK(Teuchos::VERB_LOW)) {
+        Teuchos::OSTab tab = vo_->getOSTab();
+        *vo_->os() << "WARNING: asynchronous checkpoint requires MPI_THREAD_MULTIPLE,"
+                   << " checkpoints will be written synchronously." << std::endl;
+      }
+    }
+  }
+
+  if (async_) {
+    Teuchos::RCP<const Amanzi::MpiComm_type> mpi_comm =
+        Teuchos::rcp_dynamic_cast<const Amanzi::MpiComm_type>(comm);
+    MPI_Comm_dup(mpi_comm->Comm(), &comm_dup_);
+    Amanzi::Comm_ptr_type comm_dup = Teuchos::rcp(new Amanzi::MpiComm_type(comm_dup_));
+
+    // the writer's own output is replaced by messages from the main thread
+    Teuchos::ParameterList writer_plist(chkp_plist);
+    writer_plist.sublist("verbose object").set<std::string>("verbosity level", "none");
+    checkpoint_ = Teuchos::rcp(new Amanzi::Checkpoint(writer_plist, comm_dup));
+
+    staged_.resize(max_outstanding_);
+    busy_.resize(max_outstanding_, false);
+    worker_ = std::thread(&AsyncCheckpoint::WorkerLoop_, this);
+  } else {
+    checkpoint_ = Teuchos::rcp(new Amanzi::Checkpoint(chkp_plist, comm));
+  }
+}
+
+
+AsyncCheckpoint::~AsyncCheckpoint() {
+  if (worker_.joinable()) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+  }
+
+  // the Checkpoint must release the communicator before it is freed
+  checkpoint_ = Teuchos::null;
+  if (comm_dup_ != MPI_COMM_NULL) MPI_Comm_free(&comm_dup_);
+}
+
+
+// -----------------------------------------------------------------------------
+// Snapshot and queue a checkpoint.
+// -----------------------------------------------------------------------------
+void AsyncCheckpoint::Write(const Teuchos::Ptr<Amanzi::State>& S, double dt) {
+  if (!async_) {
+    WriteCheckpoint(checkpoint_.ptr(), S, dt);
+    return;
+  }
+
+  Job job;
+  job.dt = dt;
+  Queue_(S, job);
+}
+
+
+void AsyncCheckpoint::Queue_(const Teuchos::Ptr<Amanzi::State>& S, Job& job) {
+  ReportDone_();
+
+  // wait for a free staging State
+  job.slot = -1;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (job.slot < 0) {
+      for (int i=0; i!=max_outstanding_; ++i) {
+        if (!busy_[i]) {
+          job.slot = i;
+          break;
+        }
+      }
+      if (job.slot < 0) cv_.wait(lock);
+    }
+    busy_[job.slot] = true;
+  }
+
+  // copy outside the lock, the writer does not touch a free slot
+  if (staged_[job.slot] == Teuchos::null) {
+    staged_[job.slot] = Teuchos::rcp(new Amanzi::State(*S));
+  } else {
+    *staged_[job.slot] = *S;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    queue_.push_back(job);
+  }
+  cv_.notify_all();
+}
+
+
+// -----------------------------------------------------------------------------
+// Barrier on outstanding writes.
+// -----------------------------------------------------------------------------
+void AsyncCheckpoint::Wait() {
+  if (!async_) return;
+
+  std::string error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!queue_.empty() || writing_) cv_.wait(lock);
+    error.swap(error_);
+  }
+  ReportDone_();
+
+  if (!error.empty()) {
+    Errors::Message msg;
+    msg << "Coordinator: asynchronous checkpoint failed: " << error;
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+void AsyncCheckpoint::ReportDone_() {
+  std::vector<std::string> done;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done.swap(done_);
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    for (const auto& msg : done) *vo_->os() << msg << std::endl;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Writer thread: writes snapshots in the order they were queued, which is
+// the same on all ranks.
+// -----------------------------------------------------------------------------
+void AsyncCheckpoint::WorkerLoop_() {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (queue_.empty() && !stop_) cv_.wait(lock);
+      if (queue_.empty()) return;
+      job = queue_.front();
+      queue_.pop_front();
+      writing_ = true;
+    }
+
+    const Teuchos::RCP<Amanzi::State>& S = staged_[job.slot];
+    std::stringstream msg;
+    std::string error;
+    try {
+      WriteCheckpoint(checkpoint_.ptr(), S.ptr(), job.dt);
+      msg << "wrote checkpoint of cycle " << S->cycle() << ", time " << S->time() << " [s]";
+    } catch (const std::exception& e) {
+      error = e.what();
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      writing_ = false;
+      busy_[job.slot] = false;
+      if (!error.empty() && error_.empty()) error_ = error;
+      if (error.empty()) done_.push_back(msg.str());
+    }
+    cv_.notify_all();
+  }
+}
+
+} // close namespace ATS
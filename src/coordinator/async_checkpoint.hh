@@ -0,0 +1,130 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! AsyncCheckpoint: writes checkpoints on a background I/O thread.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+When `"asynchronous checkpoint`" is set in the `"cycle driver`" list,
+checkpoints are written by a single background thread.  At each requested
+checkpoint the State is copied into a staging State, and the time loop
+continues while the staging State is written.  A new snapshot waits if
+all staging States are still being written.
+
+The writer uses its own Checkpoint object on a duplicate of the
+communicator, so that its collective HDF5 calls never interleave with the
+collectives of the time loop.  This requires MPI to provide
+``MPI_THREAD_MULTIPLE``, which the ats executable requests when run with
+``--mpi_thread_multiple``.  Otherwise checkpoints are written synchronously
+and a warning is printed.
+
+Only checkpoints use the duplicate communicator.  Visualization writes
+through the mesh's communicator, so it is not queued: each visualization
+dump first waits for the writer and then is written synchronously on the
+main thread, and HDF5 is never used from two threads at once.  Snapshots
+are written in the order they are queued, which is the same on all ranks,
+so their collectives match.  Synchronous checkpoints (on error and at the
+end of the simulation) also wait for the writer first.
+
+Messages of the writer are reported by the main thread, on the next
+Write() or Wait().
+
+* `"asynchronous checkpoint`" ``[bool]`` **false** Enable background
+  checkpoint writes.
+
+* `"asynchronous checkpoint max outstanding`" ``[int]`` **1** Number of
+  staging States, i.e. snapshots that may be waiting or being written at
+  once.  Each one holds a full copy of the State.
+
+*/
+
+#ifndef ATS_ASYNC_CHECKPOINT_HH_
+#define ATS_ASYNC_CHECKPOINT_HH_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Ptr.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "AmanziComm.hh"
+
+#include "VerboseObject.hh"
+
+namespace Amanzi {
+class Checkpoint;
+class State;
+};
+
+namespace ATS {
+
+class AsyncCheckpoint {
+
+ public:
+  AsyncCheckpoint(Teuchos::ParameterList& chkp_plist,
+                  Teuchos::ParameterList& coordinator_plist,
+                  const Amanzi::Comm_ptr_type& comm,
+                  const Teuchos::RCP<Amanzi::VerboseObject>& vo);
+  ~AsyncCheckpoint();
+
+  // Are writes actually done in the background?
+  bool asynchronous() const { return async_; }
+
+  // Snapshot S and queue it for writing.  Blocks only if all staging
+  // States are in use.  Writes immediately if not asynchronous.
+  void Write(const Teuchos::Ptr<Amanzi::State>& S, double dt);
+
+  // Block until all queued snapshots are written.  Rethrows the first
+  // error raised by the writer.
+  void Wait();
+
+ private:
+  struct Job {
+    int slot;  // staging State
+    double dt;
+  };
+
+  void Queue_(const Teuchos::Ptr<Amanzi::State>& S, Job& job);
+  void WorkerLoop_();
+
+  // write the messages of completed jobs, on the main thread
+  void ReportDone_();
+
+ private:
+  bool async_;
+  int max_outstanding_;
+
+  Teuchos::RCP<Amanzi::Checkpoint> checkpoint_;
+  Amanzi::Comm_ptr_type comm_;
+  MPI_Comm comm_dup_;
+
+  // staging States, the queue of snapshots to write, and messages of
+  // snapshots done
+  std::vector<Teuchos::RCP<Amanzi::State> > staged_;
+  std::vector<bool> busy_;
+  std::deque<Job> queue_;
+  std::vector<std::string> done_;
+
+  std::thread worker_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool writing_;
+  bool stop_;
+  std::string error_;
+
+  Teuchos::RCP<Amanzi::VerboseObject> vo_;
+};
+
+} // close namespace ATS
+
+#endif
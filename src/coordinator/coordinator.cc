@@ -12,6 +12,8 @@ including Vis and restart/checkpoint dumps.  It contains one and only one PK
 -- most likely this PK is an MPC of some type -- to do the actual work.
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <unistd.h>
 #include <sys/resource.h>
@@ -20,6 +22,8 @@ including Vis and restart/checkpoint dumps.  It contains one and only one PK
 #include "Teuchos_VerboseObjectParameterListHelpers.hpp"
 #include "Teuchos_XMLParameterListHelpers.hpp"
 #include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_DefaultMpiComm.hpp"
+#include "boost/algorithm/string.hpp"
 #include "AmanziComm.hh"
 #include "AmanziTypes.hh"
 
@@ -32,8 +36,12 @@ including Vis and restart/checkpoint dumps.  It contains one and only one PK
 #include "PK.hh"
 #include "TreeVector.hh"
 #include "PK_Factory.hh"
+#include "ColumnGeometry.hh"
+#include "TimedEvaluator.hh"
 //#include "pk_factory_ats.hh"
 
+#include "async_checkpoint.hh"
+#include "aggregated_visualization.hh"
 #include "coordinator.hh"
 
 #define DEBUG_MODE 1
@@ -46,15 +54,22 @@ Coordinator::Coordinator(Teuchos::ParameterList& parameter_list,
     parameter_list_(Teuchos::rcp(new Teuchos::ParameterList(parameter_list))),
     S_(S),
     comm_(comm),
-    restart_(false) {
+    restart_(false),
+    commit_changed_only_(false),
+    commit_bytes_(0.),
+    commit_bytes_total_(0.),
+    commit_skipped_total_(0.),
+    rollback_bytes_total_(0.),
+    commit_count_(0) {
 
   // create and start the global timer
   timer_ = Teuchos::rcp(new Teuchos::Time("wallclock_monitor",true));
   setup_timer_ = Teuchos::TimeMonitor::getNewCounter("setup");
   cycle_timer_ = Teuchos::TimeMonitor::getNewCounter("cycle");
-  coordinator_init();
+  commit_timer_ = Teuchos::TimeMonitor::getNewCounter("state commit");
 
   vo_ = Teuchos::rcp(new Amanzi::VerboseObject("Coordinator", *parameter_list_));
+  coordinator_init();
 };
 
 void Coordinator::coordinator_init() {
@@ -95,7 +110,12 @@ void Coordinator::coordinator_init() {
   // }
   // else
   checkpoint_ = Teuchos::rcp(new Amanzi::Checkpoint(chkp_plist, comm_));
-  
+
+  // optionally write regular checkpoints in the background
+  if (coordinator_list_->get<bool>("asynchronous checkpoint", false)) {
+    async_checkpoint_ = Teuchos::rcp(new AsyncCheckpoint(chkp_plist, *coordinator_list_, comm_, vo_));
+    if (!async_checkpoint_->asynchronous()) async_checkpoint_ = Teuchos::null;
+  }
 
   // create the observations
   Teuchos::ParameterList& observation_plist = parameter_list_->sublist("observations");
@@ -188,6 +208,8 @@ void Coordinator::initialize() {
          mesh!=S_->mesh_end(); ++mesh) {
       if (boost::starts_with(mesh->first, "column")){
         DeformCheckpointMesh(S_.ptr(), mesh->first);
+        // column geometry may have been cached by PKs at setup
+        Amanzi::Operators::ColumnGeometry::MeshDeformed(mesh->second.first);
       }
     }
     
@@ -199,6 +221,8 @@ void Coordinator::initialize() {
          mesh!=S_->mesh_end(); ++mesh) {
       if (boost::starts_with(mesh->first, "column")){
         DeformCheckpointMesh(S_.ptr(), mesh->first);
+        // column geometry may have been cached by PKs at setup
+        Amanzi::Operators::ColumnGeometry::MeshDeformed(mesh->second.first);
       }
     }
   }
@@ -253,6 +277,14 @@ void Coordinator::initialize() {
     } else if (boost::ends_with(domain_name, "_*")) {
       // visualize domain set
       std::string domain_set_name = domain_name.substr(0,domain_name.size()-2);
+      if (vis_list->sublist(domain_name).get<bool>("aggregate subdomains", false)) {
+        // all subdomains in one file per dump
+        auto vis = Teuchos::rcp(new AggregatedVisualization(vis_list->sublist(domain_name),
+                domain_set_name, *S_, comm_));
+        aggregated_visualization_.push_back(vis);
+        continue;
+      }
+
       for (auto m=S_->mesh_begin(); m!=S_->mesh_end(); ++m) {
         if (boost::starts_with(m->first, domain_set_name)) {
           // visualize each subdomain
@@ -281,6 +313,9 @@ void Coordinator::initialize() {
        vis!=visualization_.end(); ++vis) {
     (*vis)->RegisterWithTimeStepManager(tsm_.ptr());
   }
+  for (auto& vis : aggregated_visualization_) {
+    vis->RegisterWithTimeStepManager(tsm_.ptr());
+  }
 
   // -- register checkpoint times
   checkpoint_->RegisterWithTimeStepManager(tsm_.ptr());
@@ -309,6 +344,17 @@ void Coordinator::initialize() {
     S_inter_ = S_;
   }
 
+  // Subcycling PKs copy S_inter_ into S_next_ directly, which evaluator
+  // versions do not see.
+  if (commit_changed_only_ && S_inter_ != S_) {
+    commit_changed_only_ = false;
+    if (vo_->os_OK(Teuchos::VERB_LOW)) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "WARNING: \"state commit mode\" \"changed fields\" is not supported"
+                 << " with \"support subcycling\", the state will be deep copied." << std::endl;
+    }
+  }
+
   // set the states in the PKs Passing null for S_ allows for safer subcycling
   // -- PKs can't use it, so it is guaranteed to be pristinely the old
   // timestep.  This comes at the expense of an increase in memory footprint.
@@ -320,10 +366,14 @@ void Coordinator::initialize() {
 void Coordinator::finalize() {
   // Force checkpoint at the end of simulation, and copy to checkpoint_final
   pk_->CalculateDiagnostics(S_next_);
+  if (async_checkpoint_ != Teuchos::null) async_checkpoint_->Wait();
   WriteCheckpoint(checkpoint_.ptr(), S_next_.ptr(), 0.0, true);
 
   // flush observations to make sure they are saved
   observations_->Flush();
+
+  // complete outstanding vis writes
+  for (auto& vis : aggregated_visualization_) vis->Finish();
 }
 
 
@@ -440,6 +490,24 @@ void Coordinator::read_parameter_list() {
   cycle1_ = coordinator_list_->get<int>("end cycle",-1);
   duration_ = coordinator_list_->get<double>("wallclock duration [hrs]", -1.0);
 
+  // state commit control
+  std::string commit_mode = coordinator_list_->get<std::string>("state commit mode", "deep copy");
+  if (commit_mode == "changed fields") {
+    commit_changed_only_ = true;
+  } else if (commit_mode != "deep copy") {
+    Errors::Message msg;
+    msg << "Coordinator: unknown state commit mode \"" << commit_mode
+        << "\", valid are \"deep copy\" and \"changed fields\".";
+    Exceptions::amanzi_throw(msg);
+  }
+  if (coordinator_list_->isParameter("state commit deep copy fields")) {
+    Teuchos::Array<std::string> deep_copy_fields =
+        coordinator_list_->get<Teuchos::Array<std::string> >("state commit deep copy fields");
+    commit_deep_copy_fields_.insert(deep_copy_fields.begin(), deep_copy_fields.end());
+  }
+
+  timer_report_filename_ = coordinator_list_->get<std::string>("timer report filename", "");
+
   // restart control
   restart_ = coordinator_list_->isParameter("restart from checkpoint file");
   if (restart_) {
@@ -502,26 +570,29 @@ bool Coordinator::advance(double t_old, double t_new) {
     // commit the state
     pk_->CommitStep(t_old, t_new, S_next_);
 
+    // the geometry of deformable meshes may have changed
+    for (Amanzi::State::mesh_iterator mesh=S_next_->mesh_begin();
+         mesh!=S_next_->mesh_end(); ++mesh) {
+      if (S_next_->IsDeformableMesh(mesh->first)) {
+        for (auto& vis : aggregated_visualization_) vis->MeshDeformed(mesh->second.first);
+      }
+    }
+
     // make observations, vis, and checkpoints
     observations_->MakeObservations(*S_next_);
     visualize();
     checkpoint(dt);
 
     // we're done with this time step, copy the state
-    *S_ = *S_next_;
-    *S_inter_ = *S_next_;
+    commit_state();
 
   } else {
     // Failed the timestep.  
     // Potentially write out failed timestep for debugging
-    for (std::vector<Teuchos::RCP<Amanzi::Visualization> >::iterator vis=failed_visualization_.begin();
-         vis!=failed_visualization_.end(); ++vis) {
-      WriteVis((*vis).ptr(), S_next_.ptr());
-    }
+    write_vis(failed_visualization_);
 
     // The timestep sizes have been updated, so copy back old soln and try again.
-    *S_next_ = *S_;
-    *S_inter_ = *S_;
+    rollback_state();
 
     // check whether meshes are deformable, and if so, recover the old coordinates
     for (Amanzi::State::mesh_iterator mesh=S_->mesh_begin();
@@ -551,6 +622,7 @@ bool Coordinator::advance(double t_old, double t_new) {
           // undeform the mesh
           Amanzi::AmanziGeometry::Point_List final_positions;
           mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+          Amanzi::Operators::ColumnGeometry::MeshDeformed(mesh->second.first);
         }
         
         else if (!parameter_list_->sublist("mesh").isSublist("column")) {
@@ -579,6 +651,7 @@ bool Coordinator::advance(double t_old, double t_new) {
           // undeform the mesh
           Amanzi::AmanziGeometry::Point_List final_positions;
           mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+          Amanzi::Operators::ColumnGeometry::MeshDeformed(mesh->second.first);
         }
         
       }
@@ -589,6 +662,215 @@ bool Coordinator::advance(double t_old, double t_new) {
   return fail;
 }
 
+// -----------------------------------------------------------------------------
+// Write min/mean/max over ranks of all timers to the timer report file.
+// Timers that exist on only some ranks, e.g. those of column PKs and
+// evaluators, are included.
+// -----------------------------------------------------------------------------
+void Coordinator::report_timers() {
+  if (timer_report_filename_.empty()) return;
+
+  Teuchos::RCP<const Amanzi::MpiComm_type> mpi_comm =
+      Teuchos::rcp_dynamic_cast<const Amanzi::MpiComm_type>(comm_);
+  Teuchos::MpiComm<int> tcomm(Teuchos::opaqueWrapper(mpi_comm->Comm()));
+
+  std::map<std::string, std::vector<std::pair<double,double> > > stats;
+  std::vector<std::string> stat_names;
+  Teuchos::TimeMonitor::computeGlobalTimerStatistics(stats, stat_names,
+          Teuchos::ptrFromRef(tcomm), Teuchos::Union);
+  if (comm_->MyPID() != 0) return;
+
+  // columns of the report, in order min, mean, max
+  const char* wanted[3] = { "MinOverProcs", "MeanOverProcs", "MaxOverProcs" };
+  const char* labels[3] = { "min", "mean", "max" };
+  int index[3];
+  for (int k=0; k!=3; ++k) {
+    index[k] = std::find(stat_names.begin(), stat_names.end(), wanted[k]) - stat_names.begin();
+    if (index[k] == stat_names.size()) {
+      Errors::Message msg;
+      msg << "Coordinator: timer statistic \"" << wanted[k] << "\" is not available.";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+
+  std::ofstream out(timer_report_filename_.c_str());
+  out << std::setprecision(8);
+  bool json = boost::ends_with(timer_report_filename_, ".json");
+  if (json) {
+    out << "{" << std::endl << "  \"nranks\": " << comm_->NumProc() << "," << std::endl
+        << "  \"timers\": [";
+  } else {
+    out << "timer,calls min,calls mean,calls max,time min [s],time mean [s],time max [s]" << std::endl;
+  }
+
+  bool first = true;
+  for (auto& stat : stats) {
+    std::string name = stat.first;
+    if (json) {
+      boost::replace_all(name, "\\", "\\\\");
+      boost::replace_all(name, "\"", "\\\"");
+      out << (first ? "" : ",") << std::endl << "    { \"name\": \"" << name << "\"";
+      for (int k=0; k!=3; ++k) out << ", \"calls " << labels[k] << "\": " << stat.second[index[k]].second;
+      for (int k=0; k!=3; ++k) out << ", \"time " << labels[k] << "\": " << stat.second[index[k]].first;
+      out << " }";
+    } else {
+      boost::replace_all(name, "\"", "\"\"");
+      out << "\"" << name << "\"";
+      for (int k=0; k!=3; ++k) out << "," << stat.second[index[k]].second;
+      for (int k=0; k!=3; ++k) out << "," << stat.second[index[k]].first;
+      out << std::endl;
+    }
+    first = false;
+  }
+  if (json) out << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+
+// -----------------------------------------------------------------------------
+// Copy a single field's data into the same field of another state, returning
+// the number of bytes copied.
+// -----------------------------------------------------------------------------
+static double CopyField(const Amanzi::Field& source, Amanzi::State& target) {
+  Teuchos::RCP<Amanzi::Field> target_field =
+      target.GetField(source.fieldname(), source.owner());
+
+  switch (source.type()) {
+    case Amanzi::COMPOSITE_VECTOR_FIELD:
+      target_field->SetData(*source.GetFieldData());
+      break;
+    case Amanzi::CONSTANT_VECTOR:
+      target_field->SetData(*source.GetConstantVectorData());
+      break;
+    case Amanzi::CONSTANT_SCALAR:
+      target_field->SetData(*source.GetScalarData());
+      break;
+    default:
+      return 0.;
+  }
+  return static_cast<double>(source.GetLocalElementCount()) * sizeof(double);
+}
+
+
+static void CopyStateTimes(const Amanzi::State& source, Amanzi::State& target) {
+  target.set_time(source.time());
+  target.set_cycle(source.cycle());
+  target.set_initial_time(source.initial_time());
+  target.set_intermediate_time(source.intermediate_time());
+  target.set_final_time(source.final_time());
+  target.set_last_time(source.last_time());
+}
+
+
+static double CountStateBytes(const Amanzi::State& S) {
+  double bytes = 0.;
+  for (Amanzi::State::field_iterator field=S.field_begin(); field!=S.field_end(); ++field) {
+    bytes += static_cast<double>(field->second->GetLocalElementCount()) * sizeof(double);
+  }
+  return bytes;
+}
+
+
+// -----------------------------------------------------------------------------
+// Has a field of S_next_ been written since it was last committed or rolled
+// back?  The field is then marked as committed.
+//
+// Only fields computed by a VersionedEvaluator (all ATS secondary variable
+// evaluators) can be known to be unchanged: their evaluator's version counts
+// its writes, so no field data is read.  Fields with any other evaluator, or
+// none, or in the deep copy list are always considered changed.
+// -----------------------------------------------------------------------------
+bool Coordinator::field_changed_since_commit(const std::string& key) {
+  if (commit_deep_copy_fields_.count(key) || !S_next_->HasFieldEvaluator(key)) return true;
+
+  const Amanzi::VersionedEvaluator* eval =
+      dynamic_cast<const Amanzi::VersionedEvaluator*>(S_next_->GetFieldEvaluator(key).get());
+  if (eval == NULL) return true;
+
+  std::map<std::string, unsigned long>::iterator committed = committed_versions_.find(key);
+  bool changed = committed == committed_versions_.end() || committed->second != eval->version();
+  committed_versions_[key] = eval->version();
+  return changed;
+}
+
+
+// -----------------------------------------------------------------------------
+// Commit the successful step into the old state(s).
+//
+// In "changed fields" mode, only fields written during the step are copied.
+// A field not written this step still holds its committed value, so skipping
+// it is exact.  Note S_inter_ is S_ unless subcycling is supported, in which
+// case the state is always deep copied.
+// -----------------------------------------------------------------------------
+void Coordinator::commit_state() {
+  Teuchos::TimeMonitor monitor(*commit_timer_);
+  commit_bytes_ = 0.;
+  double skipped = 0.;
+
+  if (!commit_changed_only_) {
+    *S_ = *S_next_;
+    commit_bytes_ = CountStateBytes(*S_next_);
+    if (S_inter_ != S_) {
+      *S_inter_ = *S_next_;
+      commit_bytes_ *= 2;
+    }
+
+  } else {
+    for (Amanzi::State::field_iterator field=S_next_->field_begin();
+         field!=S_next_->field_end(); ++field) {
+      if (field_changed_since_commit(field->first)) {
+        commit_bytes_ += CopyField(*field->second, *S_);
+      } else {
+        skipped += static_cast<double>(field->second->GetLocalElementCount()) * sizeof(double);
+      }
+    }
+    CopyStateTimes(*S_next_, *S_);
+  }
+
+  commit_bytes_total_ += commit_bytes_;
+  commit_skipped_total_ += skipped;
+  commit_count_++;
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "State commit copied " << commit_bytes_ / 1024 / 1024
+               << " MBytes and skipped " << skipped / 1024 / 1024
+               << " MBytes on this rank." << std::endl;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Roll back a failed step.
+//
+// In "changed fields" mode, only fields written during the failed step are
+// restored; all others still hold the old state's values.
+// -----------------------------------------------------------------------------
+void Coordinator::rollback_state() {
+  Teuchos::TimeMonitor monitor(*commit_timer_);
+  double bytes = 0.;
+
+  if (!commit_changed_only_) {
+    *S_next_ = *S_;
+    bytes = CountStateBytes(*S_);
+    if (S_inter_ != S_) {
+      *S_inter_ = *S_;
+      bytes *= 2;
+    }
+
+  } else {
+    for (Amanzi::State::field_iterator field=S_->field_begin();
+         field!=S_->field_end(); ++field) {
+      if (field_changed_since_commit(field->first)) {
+        bytes += CopyField(*field->second, *S_next_);
+      }
+    }
+    CopyStateTimes(*S_, *S_next_);
+  }
+
+  rollback_bytes_total_ += bytes;
+}
+
+
 void Coordinator::visualize(bool force) {
   // write visualization if requested
   bool dump = force;
@@ -599,23 +881,48 @@ void Coordinator::visualize(bool force) {
         dump = true;
       }
     }
+    for (auto& vis : aggregated_visualization_) {
+      if (vis->DumpRequested(S_next_->cycle(), S_next_->time())) dump = true;
+    }
   }
 
   if (dump) {
     pk_->CalculateDiagnostics(S_next_);
   }
 
+  std::vector<Teuchos::RCP<Amanzi::Visualization> > due;
   for (std::vector<Teuchos::RCP<Amanzi::Visualization> >::iterator vis=visualization_.begin();
        vis!=visualization_.end(); ++vis) {
     if (force || (*vis)->DumpRequested(S_next_->cycle(), S_next_->time())) {
-      WriteVis((*vis).ptr(), S_next_.ptr());
+      due.push_back(*vis);
+    }
+  }
+  write_vis(due);
+
+  for (auto& vis : aggregated_visualization_) {
+    if (force || vis->DumpRequested(S_next_->cycle(), S_next_->time())) {
+      vis->Write(*S_next_);
     }
   }
 }
 
+// HDF5 is not used from two threads at once: while the checkpoint writer is
+// active, vis goes through its queue, or waits for it if a mesh deforms.
+void Coordinator::write_vis(const std::vector<Teuchos::RCP<Amanzi::Visualization> >& vis) {
+  if (vis.empty()) return;
+
+  // vis writes on the mesh communicator, so the checkpoint writer must be idle
+  if (async_checkpoint_ != Teuchos::null) async_checkpoint_->Wait();
+  for (auto& v : vis) WriteVis(v.ptr(), S_next_.ptr());
+}
+
 void Coordinator::checkpoint(double dt, bool force) {
   if (force || checkpoint_->DumpRequested(S_next_->cycle(), S_next_->time())) {
-    WriteCheckpoint(checkpoint_.ptr(), S_next_.ptr(), dt);
+    if (async_checkpoint_ != Teuchos::null) {
+      async_checkpoint_->Write(S_next_.ptr(), dt);
+    } else {
+      WriteCheckpoint(checkpoint_.ptr(), S_next_.ptr(), dt);
+    }
   }
 }
 
@@ -694,6 +1001,16 @@ void Coordinator::cycle_driver() {
     // flush observations to make sure they are saved
     observations_->Flush();
 
+    // finish any background checkpoint first; a failure there must not
+    // hide the original error
+    if (async_checkpoint_ != Teuchos::null) {
+      try {
+        async_checkpoint_->Wait();
+      } catch (Amanzi::Exceptions::Amanzi_exception& e_chkp) {
+        if (vo_->os_OK(Teuchos::VERB_LOW)) *vo_->os() << e_chkp.what() << std::endl;
+      }
+    }
+
     // catch errors to dump two checkpoints -- one as a "last good" checkpoint
     // and one as a "debugging data" checkpoint.
     checkpoint_->set_filebasename("last_good_checkpoint");
@@ -709,7 +1026,28 @@ void Coordinator::cycle_driver() {
   // finalizing simulation                                                                                                                                                                                                               
   S_->WriteStatistics(vo_);  
   report_memory();
+
+  double local_bytes[4] = { commit_bytes_total_,
+                            commit_count_ > 0 ? commit_bytes_total_ / commit_count_ : 0.,
+                            commit_skipped_total_,
+                            rollback_bytes_total_ };
+  double global_bytes[4] = { 0., 0., 0., 0. };
+  comm_->SumAll(local_bytes, global_bytes, 4);
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM) && commit_count_ > 0) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "State commit (" << (commit_changed_only_ ? "changed fields" : "deep copy")
+               << "), all ranks:" << std::endl
+               << "  Total copied:       " << std::setw(7) << global_bytes[0]/1024/1024
+               << " MBytes" << std::endl
+               << "  Copied per cycle:   " << std::setw(7) << global_bytes[1]/1024/1024
+               << " MBytes" << std::endl
+               << "  Total not copied:   " << std::setw(7) << global_bytes[2]/1024/1024
+               << " MBytes" << std::endl
+               << "  Restored on failure:" << std::setw(7) << global_bytes[3]/1024/1024
+               << " MBytes" << std::endl;
+  }
   Teuchos::TimeMonitor::summarize(*vo_->os());
+  report_timers();
 
   finalize();
 
@@ -38,6 +38,40 @@ simulation, including starting and ending times and restart options.
    be minimized.
 
 * `"PK tree`" ``[pk-type-spec-list]`` List of length one, the top level PK spec.
+
+* `"state commit mode`" ``[string]`` **"deep copy"** How the accepted state
+   is copied into the old state at the end of a successful timestep.  One of:
+
+   - `"deep copy`" copies every field of every mesh.
+   - `"changed fields`" copies only fields written during the timestep, and
+     a failed timestep restores only those.  A field computed by an ATS
+     secondary variable evaluator is written when its evaluator's version
+     changes, so no field data is compared and no evaluator is run.  Fields
+     with other evaluators, or none, are always copied.  Not supported with
+     `"support subcycling`", where the state is deep copied.
+
+* `"state commit deep copy fields`" ``[Array(string)]`` **optional** In
+   `"changed fields`" mode, fields that are always deep copied, e.g. those
+   that a PK writes without notifying its evaluator.
+
+* `"asynchronous checkpoint`" ``[bool]`` **false** Write checkpoints on a
+   background thread from a snapshot of the State, see AsyncCheckpoint_.
+   Visualization dumps stay on the main thread and first wait for
+   outstanding checkpoints.
+   Checkpoints written after an error and at the end of the simulation are
+   always written synchronously, after all outstanding writes finish.
+
+* `"asynchronous checkpoint max outstanding`" ``[int]`` **1** Maximum number
+   of snapshots waiting to be written.
+
+* `"timer report filename`" ``[string]`` **optional** If provided, all
+   timers (including each PK's ``FunctionalResidual``,
+   ``UpdatePreconditioner``, ``ApplyPreconditioner``, ``ErrorNorm``, and
+   ``ModifyCorrection``, and each secondary variable evaluator's
+   ``evaluate`` and ``derivative``) are reduced over all ranks at the end of the
+   simulation and written to this file: call counts and times, each as the
+   min, mean, and max over ranks.  The file is JSON if the name ends in
+   `".json`", and CSV otherwise.
    
 Note: Either `"end cycle`" or `"end time`" are required, and if
 both are present, the simulation will stop with whichever arrives
@@ -69,6 +103,9 @@ Example:
 #ifndef ATS_COORDINATOR_HH_
 #define ATS_COORDINATOR_HH_
 
+#include <map>
+#include <set>
+
 #include "Teuchos_Time.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
@@ -92,6 +129,9 @@ class UnstructuredObservations;
 
 namespace ATS {
 
+class AsyncCheckpoint;
+class AggregatedVisualization;
+
 class Coordinator {
 
 public:
@@ -105,6 +145,7 @@ public:
   void initialize();
   void finalize();
   void report_memory();
+  void report_timers();
   bool advance(double t_old, double t_new);
   void visualize(bool force=false);
   void checkpoint(double dt, bool force=false);
@@ -118,6 +159,14 @@ private:
   void coordinator_init();
   void read_parameter_list();
 
+  // copy S_next_ into S_ (and S_inter_) after success, or back after failure
+  void commit_state();
+  void rollback_state();
+  bool field_changed_since_commit(const std::string& key);
+
+  // write vis to each of vis, after outstanding checkpoints
+  void write_vis(const std::vector<Teuchos::RCP<Amanzi::Visualization> >& vis);
+
   // PK container and factory
   Teuchos::RCP<Amanzi::PK> pk_;
 
@@ -127,6 +176,16 @@ private:
   Teuchos::RCP<Amanzi::State> S_next_;
   Teuchos::RCP<Amanzi::TreeVector> soln_;
 
+  // state commit control
+  bool commit_changed_only_;
+  std::set<std::string> commit_deep_copy_fields_;
+  double commit_bytes_;
+  double commit_bytes_total_;
+  double commit_skipped_total_;
+  double rollback_bytes_total_;
+  int commit_count_;
+  std::map<std::string, unsigned long> committed_versions_;
+
   // time step manager
   Teuchos::RCP<Amanzi::TimeStepManager> tsm_;
 
@@ -148,7 +207,9 @@ private:
   // vis and checkpointing
   std::vector<Teuchos::RCP<Amanzi::Visualization> > visualization_;
   std::vector<Teuchos::RCP<Amanzi::Visualization> > failed_visualization_;
+  std::vector<Teuchos::RCP<AggregatedVisualization> > aggregated_visualization_;
   Teuchos::RCP<Amanzi::Checkpoint> checkpoint_;
+  Teuchos::RCP<AsyncCheckpoint> async_checkpoint_;
   bool restart_;
   std::string restart_filename_;
 
@@ -158,8 +219,10 @@ private:
   // timers
   Teuchos::RCP<Teuchos::Time> setup_timer_;
   Teuchos::RCP<Teuchos::Time> cycle_timer_;
+  Teuchos::RCP<Teuchos::Time> commit_timer_;
   Teuchos::RCP<Teuchos::Time> timer_;
   double duration_;
+  std::string timer_report_filename_;
   
   // fancy OS
   Teuchos::RCP<Amanzi::VerboseObject> vo_;
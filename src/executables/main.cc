@@ -79,6 +79,17 @@ int main(int argc, char *argv[])
   feraiseexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
 #endif
 
+  // asynchronous checkpoints need MPI_THREAD_MULTIPLE, which must be
+  // requested before the session starts MPI
+  bool mpi_thread_multiple = false;
+  for (int i=1; i<argc; ++i) {
+    if (std::string(argv[i]) == "--mpi_thread_multiple") mpi_thread_multiple = true;
+  }
+  if (mpi_thread_multiple) {
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+  }
+
   Teuchos::GlobalMPISession mpiSession(&argc,&argv,0);
 
   Teuchos::CommandLineProcessor CLP;
@@ -86,6 +97,8 @@ int main(int argc, char *argv[])
 
   std::string xmlInFileName = "options.xml";
   CLP.setOption("xml_file", &xmlInFileName, "XML options file");
+  CLP.setOption("mpi_thread_multiple", "no_mpi_thread_multiple", &mpi_thread_multiple,
+                "Start MPI with MPI_THREAD_MULTIPLE, required for asynchronous checkpoints");
   CLP.throwExceptions(false);
   
   Teuchos::CommandLineProcessor::EParseCommandLineReturn
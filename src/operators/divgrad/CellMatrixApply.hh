@@ -0,0 +1,101 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Matrix-free action of the cells' local MFD matrices.
+//
+// Each cell c has a local matrix on its faces and itself,
+//
+//    [ Aff  Afc ]
+//    [ Acf  Acc ]
+//
+// stored packed: Aff column-major at Aff_offsets[c], and Afc, Acf at
+// Af_offsets[c].  ApplyCellMatrices() computes y = A x, adding each cell's
+// face contributions into yf and setting yc, and optionally subtracts the
+// cell rhs in the same pass.  Hexes and prisms, the common cases, use
+// fixed-size kernels.
+//
+// Connectivity is any type providing cell_faces(c) and cell_num_faces(c),
+// e.g. MeshConnectivity.  This is the kernel of MatrixMFD::Apply() and
+// ComputeNegativeResidual().
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_CELL_MATRIX_APPLY_HH_
+#define AMANZI_OPERATORS_CELL_MATRIX_APPLY_HH_
+
+#include "MatrixMFD_Defs.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+// Action of one cell's local matrix: yf = Aff*xf + Afc*xc, returning
+// Acf*xf + Acc*xc.  NF > 0 fixes the number of faces at compile time so the
+// loops fully unroll; NF == 0 takes nfaces at run time.
+template<int NF>
+inline double ApplyCellMatrix(int nfaces_rt, const double* Aff,
+        const double* Afc, const double* Acf, double Acc,
+        const double* xf, double xc, double* yf) {
+  const int nfaces = NF > 0 ? NF : nfaces_rt;
+  double yc = Acc * xc;
+  for (int n = 0; n < nfaces; n++) {
+    double av = Afc[n] * xc;
+    for (int m = 0; m < nfaces; m++) {
+      av += Aff[n + m*nfaces] * xf[m];  // column-major
+    }
+    yf[n] = av;
+    yc += Acf[n] * xf[n];
+  }
+  return yc;
+}
+
+
+// y = A x over cells [0, ncells), or A x - rhs_c on cells if rhs_c is not
+// NULL.  yf is summed into, and must be zeroed by the caller; yc is set.
+template<class Connectivity>
+void ApplyCellMatrices(const Connectivity& conn, int ncells,
+        const double* Aff, const int* Aff_offsets,
+        const double* Afc, const double* Acf, const int* Af_offsets,
+        const double* Acc, const double* xf, const double* xc,
+        const double* rhs_c, double* yf, double* yc) {
+  double v[MFD_MAX_FACES];
+  double av[MFD_MAX_FACES];
+
+  for (int c = 0; c < ncells; c++) {
+    const int* faces = conn.cell_faces(c);
+    int nfaces = conn.cell_num_faces(c);
+
+    const double* Aff_c = &Aff[Aff_offsets[c]];
+    const double* Afc_c = &Afc[Af_offsets[c]];
+    const double* Acf_c = &Acf[Af_offsets[c]];
+
+    for (int n = 0; n < nfaces; n++) {
+      v[n] = xf[faces[n]];
+    }
+
+    double y;
+    switch (nfaces) {
+      case 6:
+        y = ApplyCellMatrix<6>(nfaces, Aff_c, Afc_c, Acf_c, Acc[c], v, xc[c], av);
+        break;
+      case 5:
+        y = ApplyCellMatrix<5>(nfaces, Aff_c, Afc_c, Acf_c, Acc[c], v, xc[c], av);
+        break;
+      default:
+        y = ApplyCellMatrix<0>(nfaces, Aff_c, Afc_c, Acf_c, Acc[c], v, xc[c], av);
+    }
+
+    for (int n = 0; n < nfaces; n++) {
+      yf[faces[n]] += av[n];
+    }
+    yc[c] = rhs_c ? y - rhs_c[c] : y;
+  }
+}
+
+}  // namespace Operators
+}  // namespace Amanzi
+
+#endif
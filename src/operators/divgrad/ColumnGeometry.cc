@@ -0,0 +1,89 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Cached column geometry of a columnar (extruded) mesh.
+// -----------------------------------------------------------------------------
+
+#include "errors.hh"
+#include "MeshKeyedCache.hh"
+#include "ColumnGeometry.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+ColumnGeometry::ColumnGeometry(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) :
+    mesh_(mesh.create_weak())
+{
+  int ncols = mesh_->num_columns(false);
+
+  // faces_of_column() holds the top face of each cell and the bottom face
+  // of the column, so face j+1 is the face below cell j.
+  offsets_.resize(ncols+1);
+  offsets_[0] = 0;
+  for (int i=0; i!=ncols; ++i) {
+    const AmanziMesh::Entity_ID_List& col_cells = mesh_->cells_of_column(i);
+    const AmanziMesh::Entity_ID_List& col_faces = mesh_->faces_of_column(i);
+    if (col_faces.size() != col_cells.size() + 1) {
+      Errors::Message msg("ColumnGeometry: column faces do not bound the column cells.");
+      Exceptions::amanzi_throw(msg);
+    }
+
+    cells_.insert(cells_.end(), col_cells.begin(), col_cells.end());
+    faces_.insert(faces_.end(), col_faces.begin(), col_faces.end());
+    offsets_[i+1] = cells_.size();
+  }
+
+  UpdateGeometry();
+}
+
+
+void ColumnGeometry::UpdateGeometry() {
+  int ncols = num_columns();
+  depth_.resize(cells_.size());
+  dz_.resize(cells_.size());
+  top_centroids_.resize(ncols);
+
+  for (int i=0; i!=ncols; ++i) {
+    // faces of column i start at offsets_[i] + i, one more per column
+    const int* col_faces = &faces_[offsets_[i] + i];
+    top_centroids_[i] = mesh_->face_centroid(col_faces[0]);
+    double z_top = top_centroids_[i][2];
+    double z_above = z_top;
+
+    for (int j=0; j!=num_cells(i); ++j) {
+      int n = offsets_[i] + j;
+      double z_below = mesh_->face_centroid(col_faces[j+1])[2];
+      depth_[n] = z_top - mesh_->cell_centroid(cells_[n])[2];
+      dz_[n] = z_above - z_below;
+      z_above = z_below;
+    }
+  }
+}
+
+
+static MeshKeyedCache<ColumnGeometry>&
+ColumnGeometryCache_() {
+  static MeshKeyedCache<ColumnGeometry> cache;
+  return cache;
+}
+
+
+Teuchos::RCP<const ColumnGeometry>
+ColumnGeometry::Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) {
+  return ColumnGeometryCache_().Get(mesh);
+}
+
+
+void
+ColumnGeometry::MeshDeformed(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) {
+  Teuchos::RCP<ColumnGeometry> geom = ColumnGeometryCache_().Find(mesh);
+  if (geom != Teuchos::null) geom->UpdateGeometry();
+}
+
+} // namespace
+} // namespace
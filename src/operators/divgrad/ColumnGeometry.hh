@@ -0,0 +1,84 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Cached column geometry of a columnar (extruded) mesh.
+//
+// Column-based physics (vegetation, rooting depth, transpiration) walks the
+// cells of each column top-down and needs each cell's depth below the
+// surface and its thickness.  Querying the mesh for these walks faces and
+// normals for every column on every call; this object stores the columns
+// built by Mesh::build_columns() in flat arrays, along with their geometry.
+//
+// Column i is the mesh's column i, i.e. cells_of_column(i), and entries of
+// a column are ordered from the top down.  Column membership is
+// topological, but depths, thicknesses and centroids change when the mesh
+// is deformed; deformation PKs call MeshDeformed() to refresh them.
+//
+// Use ColumnGeometry::Get(mesh) to share one instance per mesh.  As with
+// MeshConnectivity, the instance holds its mesh only weakly, so the shared
+// cache does not keep meshes alive.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_COLUMN_GEOMETRY_HH_
+#define AMANZI_OPERATORS_COLUMN_GEOMETRY_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Point.hh"
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class ColumnGeometry {
+ public:
+  explicit ColumnGeometry(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // Shared instance for a mesh, created on first request.
+  static Teuchos::RCP<const ColumnGeometry>
+  Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // Refresh the geometry of the shared instance, if any, after the mesh's
+  // nodes have moved.
+  static void MeshDeformed(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  Teuchos::RCP<const AmanziMesh::Mesh> Mesh() const { return mesh_.create_strong(); }
+
+  // owned columns
+  int num_columns() const { return offsets_.size() - 1; }
+
+  // cells of column i, top down, and per-cell depth of the cell centroid
+  // below the top face [m] and cell thickness [m]
+  int num_cells(int i) const { return offsets_[i+1] - offsets_[i]; }
+  const int* cells(int i) const { return &cells_[offsets_[i]]; }
+  const double* depth(int i) const { return &depth_[offsets_[i]]; }
+  const double* dz(int i) const { return &dz_[offsets_[i]]; }
+
+  // centroid of the top face of column i
+  const AmanziGeometry::Point& top_face_centroid(int i) const {
+    return top_centroids_[i]; }
+
+  // (re)compute depths, thicknesses and centroids
+  void UpdateGeometry();
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;  // weak
+
+  std::vector<int> offsets_;
+  std::vector<int> cells_;
+  std::vector<int> faces_;   // top face of each cell, plus bottom of column
+  std::vector<double> depth_;
+  std::vector<double> dz_;
+  std::vector<AmanziGeometry::Point> top_centroids_;
+};
+
+} // namespace
+} // namespace
+
+#endif
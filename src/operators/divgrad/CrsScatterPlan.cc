@@ -0,0 +1,212 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Precomputed, value-only assembly of dense element matrices.
+// -----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Epetra_MpiComm.h"
+#include "errors.hh"
+
+#include "CrsScatterPlan.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+static const int CRS_SCATTER_PLAN_TAG = 2718;
+
+CrsScatterPlan::CrsScatterPlan(Epetra_CrsMatrix& matrix) :
+    matrix_(matrix),
+    finalized_(false),
+    values_(NULL) {
+  comm_ = dynamic_cast<const Epetra_MpiComm&>(matrix.Comm()).Comm();
+  elem_offsets_.push_back(0);
+}
+
+
+bool CrsScatterPlan::Supported(const Epetra_CrsMatrix& matrix) {
+  return matrix.Filled() && matrix.StorageOptimized();
+}
+
+
+int CrsScatterPlan::AddElement(int nrows, const int* row_gids, int ncols, const int* col_gids) {
+  AMANZI_ASSERT(!finalized_);
+  for (int j=0; j!=ncols; ++j) {
+    for (int i=0; i!=nrows; ++i) {
+      row_gids_.push_back(row_gids[i]);
+      col_gids_.push_back(col_gids[j]);
+    }
+  }
+  elem_offsets_.push_back(row_gids_.size());
+  return elem_offsets_.size() - 2;
+}
+
+
+// -----------------------------------------------------------------------------
+// Offset of the entry (row, col) in the value array, given by local row and
+// global column.
+// -----------------------------------------------------------------------------
+static int FindEntry(const Epetra_CrsMatrix& matrix, const int* row_offsets,
+                     const int* indices, int lrid, int col_gid) {
+  int lcid = matrix.ColMap().LID(col_gid);
+  if (lcid >= 0) {
+    for (int k=row_offsets[lrid]; k!=row_offsets[lrid+1]; ++k) {
+      if (indices[k] == lcid) return k;
+    }
+  }
+
+  Errors::Message msg;
+  msg << "CrsScatterPlan: entry (" << matrix.RowMap().GID(lrid) << ", " << col_gid
+      << ") is not in the matrix graph.";
+  Exceptions::amanzi_throw(msg);
+  return -1;
+}
+
+
+void CrsScatterPlan::Finalize() {
+  if (!Supported(matrix_)) {
+    Errors::Message msg("CrsScatterPlan: matrix must be filled with optimized storage.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  int* row_offsets;
+  int* indices;
+  int ierr = matrix_.ExtractCrsDataPointers(row_offsets, indices, values_);
+  AMANZI_ASSERT(!ierr);
+
+  const Epetra_Map& row_map = matrix_.RowMap();
+  int nentries = row_gids_.size();
+  dest_.resize(nentries);
+
+  // local entries, and the global rows of off-process entries
+  std::vector<int> remote_entries;
+  std::vector<int> remote_gids;
+  for (int k=0; k!=nentries; ++k) {
+    int lrid = row_map.LID(row_gids_[k]);
+    if (lrid >= 0) {
+      dest_[k] = FindEntry(matrix_, row_offsets, indices, lrid, col_gids_[k]);
+    } else {
+      remote_entries.push_back(k);
+      remote_gids.push_back(row_gids_[k]);
+    }
+  }
+
+  // owners of off-process rows
+  int nremote = remote_entries.size();
+  std::vector<int> owners(nremote), owner_lids(nremote);
+  if (nremote > 0) {
+    ierr = row_map.RemoteIDList(nremote, &remote_gids[0], &owners[0], &owner_lids[0]);
+    AMANZI_ASSERT(!ierr);
+  }
+
+  // send slots, grouped by owner
+  std::vector<int> order(nremote);
+  for (int i=0; i!=nremote; ++i) order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&owners](int a, int b) { return owners[a] < owners[b]; });
+
+  int nprocs;
+  MPI_Comm_size(comm_, &nprocs);
+  std::vector<int> send_counts(nprocs, 0), recv_counts(nprocs, 0);
+  std::vector<int> send_gids(2*nremote);
+  for (int slot=0; slot!=nremote; ++slot) {
+    int i = order[slot];
+    int k = remote_entries[i];
+    if (owners[i] < 0) {
+      Errors::Message msg;
+      msg << "CrsScatterPlan: row " << row_gids_[k] << " is not in the matrix row map.";
+      Exceptions::amanzi_throw(msg);
+    }
+    dest_[k] = -(slot+1);
+    send_counts[owners[i]]++;
+    send_gids[2*slot] = row_gids_[k];
+    send_gids[2*slot+1] = col_gids_[k];
+  }
+
+  send_offsets_.assign(1, 0);
+  for (int p=0; p!=nprocs; ++p) {
+    if (send_counts[p] > 0) {
+      send_procs_.push_back(p);
+      send_offsets_.push_back(send_offsets_.back() + send_counts[p]);
+    }
+  }
+
+  // receive the global ids of entries other processes send here
+  MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, comm_);
+
+  recv_offsets_.assign(1, 0);
+  for (int p=0; p!=nprocs; ++p) {
+    if (recv_counts[p] > 0) {
+      recv_procs_.push_back(p);
+      recv_offsets_.push_back(recv_offsets_.back() + recv_counts[p]);
+    }
+  }
+
+  int nrecv = recv_offsets_.back();
+  std::vector<int> recv_gids(2*nrecv);
+  requests_.resize(send_procs_.size() + recv_procs_.size());
+  int r = 0;
+  for (int i=0; i!=recv_procs_.size(); ++i) {
+    MPI_Irecv(&recv_gids[2*recv_offsets_[i]], 2*(recv_offsets_[i+1] - recv_offsets_[i]),
+              MPI_INT, recv_procs_[i], CRS_SCATTER_PLAN_TAG, comm_, &requests_[r++]);
+  }
+  for (int i=0; i!=send_procs_.size(); ++i) {
+    MPI_Isend(&send_gids[2*send_offsets_[i]], 2*(send_offsets_[i+1] - send_offsets_[i]),
+              MPI_INT, send_procs_[i], CRS_SCATTER_PLAN_TAG, comm_, &requests_[r++]);
+  }
+  if (r > 0) MPI_Waitall(r, &requests_[0], MPI_STATUSES_IGNORE);
+
+  recv_dest_.resize(nrecv);
+  for (int slot=0; slot!=nrecv; ++slot) {
+    int lrid = row_map.LID(recv_gids[2*slot]);
+    AMANZI_ASSERT(lrid >= 0);
+    recv_dest_[slot] = FindEntry(matrix_, row_offsets, indices, lrid, recv_gids[2*slot+1]);
+  }
+
+  send_buf_.assign(nremote, 0.);
+  recv_buf_.assign(nrecv, 0.);
+
+  // global ids are no longer needed
+  std::vector<int>().swap(row_gids_);
+  std::vector<int>().swap(col_gids_);
+  finalized_ = true;
+}
+
+
+void CrsScatterPlan::PutScalar(double value) {
+  AMANZI_ASSERT(finalized_);
+  matrix_.PutScalar(value);
+  std::fill(send_buf_.begin(), send_buf_.end(), 0.);
+}
+
+
+void CrsScatterPlan::GlobalAssemble() {
+  AMANZI_ASSERT(finalized_);
+
+  int r = 0;
+  for (int i=0; i!=recv_procs_.size(); ++i) {
+    MPI_Irecv(&recv_buf_[recv_offsets_[i]], recv_offsets_[i+1] - recv_offsets_[i],
+              MPI_DOUBLE, recv_procs_[i], CRS_SCATTER_PLAN_TAG, comm_, &requests_[r++]);
+  }
+  for (int i=0; i!=send_procs_.size(); ++i) {
+    MPI_Isend(&send_buf_[send_offsets_[i]], send_offsets_[i+1] - send_offsets_[i],
+              MPI_DOUBLE, send_procs_[i], CRS_SCATTER_PLAN_TAG, comm_, &requests_[r++]);
+  }
+  if (r > 0) MPI_Waitall(r, &requests_[0], MPI_STATUSES_IGNORE);
+
+  for (int slot=0; slot!=recv_dest_.size(); ++slot) {
+    values_[recv_dest_[slot]] += recv_buf_[slot];
+  }
+
+  // sent values have been added by their owners
+  std::fill(send_buf_.begin(), send_buf_.end(), 0.);
+}
+
+}  // namespace Operators
+}  // namespace Amanzi
@@ -0,0 +1,106 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Precomputed, value-only assembly of dense element matrices into a filled
+// Epetra_CrsMatrix.
+//
+// Epetra_FECrsMatrix::SumIntoGlobalValues maps each row and column GID to a
+// local index, searches the row for the column, and stages contributions to
+// rows owned by other processes, which GlobalAssemble() then sends.  When the
+// sparsity pattern is fixed, all of that work is the same on every assembly.
+// A plan resolves it once: each entry of each element is mapped to its
+// offset in the matrix's contiguous value array, or to a slot in a send
+// buffer if its row is owned by another process.  Reassembly then adds
+// values through these offsets, and GlobalAssemble() exchanges the send
+// buffers in one packed message per neighboring process.
+//
+// Usage:
+//   plan.AddElement(...)   for each element, in a fixed order, then
+//   plan.Finalize()        (collective), then on each assembly
+//   plan.PutScalar(0.), plan.SumIntoElement(e, values) for each element,
+//   plan.GlobalAssemble() (collective).
+//
+// The matrix must be FillComplete'd with optimized storage, and must contain
+// every entry of every element.  The plan is valid until the matrix is
+// refilled or destroyed.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_CRS_SCATTER_PLAN_HH_
+#define AMANZI_OPERATORS_CRS_SCATTER_PLAN_HH_
+
+#include <vector>
+
+#include "Epetra_CrsMatrix.h"
+#include "mpi.h"
+
+namespace Amanzi {
+namespace Operators {
+
+class CrsScatterPlan {
+ public:
+  explicit CrsScatterPlan(Epetra_CrsMatrix& matrix);
+
+  // Can the matrix be assembled by a plan?  False if its storage is not
+  // optimized, in which case the caller should use SumIntoGlobalValues.
+  static bool Supported(const Epetra_CrsMatrix& matrix);
+
+  const Epetra_CrsMatrix* matrix() const { return &matrix_; }
+
+  // Register an element, a dense nrows x ncols block given by global ids.
+  // Returns the element's index, which counts up from 0.
+  int AddElement(int nrows, const int* row_gids, int ncols, const int* col_gids);
+
+  // Resolve offsets and the communication pattern.  Collective.
+  void Finalize();
+
+  // Set all values of the matrix, and clear pending off-process values.
+  void PutScalar(double value);
+
+  // Add an element's values, stored column-major as in
+  // Epetra_FECrsMatrix::SumIntoGlobalValues.
+  void SumIntoElement(int e, const double* values) {
+    for (int k=elem_offsets_[e]; k!=elem_offsets_[e+1]; ++k) {
+      int i = dest_[k];
+      if (i >= 0) {
+        values_[i] += values[k - elem_offsets_[e]];
+      } else {
+        send_buf_[-i-1] += values[k - elem_offsets_[e]];
+      }
+    }
+  }
+
+  // Send off-process values to their owners and add them in.  Collective.
+  void GlobalAssemble();
+
+ private:
+  Epetra_CrsMatrix& matrix_;
+  MPI_Comm comm_;
+  bool finalized_;
+
+  // per element entry: offset into values_, or -(slot+1) into send_buf_
+  std::vector<int> elem_offsets_;
+  std::vector<int> dest_;
+  double* values_;
+
+  // global ids of entries, only kept until Finalize()
+  std::vector<int> row_gids_;
+  std::vector<int> col_gids_;
+
+  // off-process entries, grouped by owning process
+  std::vector<int> send_procs_, send_offsets_;
+  std::vector<double> send_buf_;
+  std::vector<int> recv_procs_, recv_offsets_;
+  std::vector<double> recv_buf_;
+  std::vector<int> recv_dest_;
+  std::vector<MPI_Request> requests_;
+};
+
+}  // namespace Operators
+}  // namespace Amanzi
+
+#endif
@@ -0,0 +1,317 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Face Schur complement of N MFD systems coupled through their cell
+// unknowns, with the number of equations N fixed at compile time.
+//
+// Each equation i is discretized by a MatrixMFD with local matrices Aff_i,
+// Afc_i, and Acf_i.  The coupled system is
+//
+//     [ Kcc   Kcf ]     Kcc: an N x N block per cell
+//     [ Kfc   Kff ]     Kfc, Kff: diagonal in the equations
+//
+// where Kcf(i,j) may be nonzero for i != j, e.g. the advective coupling of
+// energy cells to flow faces.  Eliminating the cells gives the face system
+//
+//     S = Kff - Kfc * Kcc^-1 * Kcf,
+//
+// which is an N x N block for each pair of faces of a cell.
+//
+// MatrixMFD_Coupled assembles S for N = 2 into an Epetra_FEVbrMatrix, one
+// block entry at a time.  Here unknowns are interleaved, so that equation k
+// of a face with global id g is the point row N*g + k.  S is then a point
+// Epetra_FECrsMatrix in block sparse row layout, which preconditioners use
+// without conversion, and each cell's dense (N*nfaces)^2 contribution is
+// added through a CrsScatterPlan.  Cell blocks are inverted by loops of
+// fixed trip count N, which the compiler unrolls.
+//
+// Usage:
+//   SetBlock(i, i, A_i) for each equation, SetBlock(i, j, G) for optional
+//   cell-to-face couplings, SymbolicAssemble() once, then for each assembly
+//   fill Kcc(c) for every owned cell and call Assemble().
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_FACE_BLOCK_SCHUR_HH_
+#define AMANZI_OPERATORS_FACE_BLOCK_SCHUR_HH_
+
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_Map.h"
+#include "Epetra_FECrsGraph.h"
+#include "Epetra_FECrsMatrix.h"
+
+#include "errors.hh"
+#include "MatrixMFD.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+// Dense N x N block, stored column-major.
+template<int N>
+class CellBlock {
+ public:
+  double& operator()(int i, int j) { return v_[i + N*j]; }
+  double operator()(int i, int j) const { return v_[i + N*j]; }
+  const double* values() const { return v_; }
+
+  void PutScalar(double s) {
+    for (int k=0; k!=N*N; ++k) v_[k] = s;
+  }
+
+  // Inverse by Gauss-Jordan elimination with partial pivoting.  Returns
+  // false if the block is singular.
+  bool Inverse(CellBlock<N>& inv) const {
+    CellBlock<N> a(*this);
+    inv.PutScalar(0.);
+    for (int i=0; i!=N; ++i) inv(i,i) = 1.;
+
+    for (int k=0; k!=N; ++k) {
+      int p = k;
+      for (int i=k+1; i!=N; ++i) {
+        if (std::abs(a(i,k)) > std::abs(a(p,k))) p = i;
+      }
+      if (std::abs(a(p,k)) <= 1.e-30) return false;
+      if (p != k) {
+        for (int j=0; j!=N; ++j) {
+          std::swap(a(k,j), a(p,j));
+          std::swap(inv(k,j), inv(p,j));
+        }
+      }
+
+      double d = 1. / a(k,k);
+      for (int j=0; j!=N; ++j) {
+        a(k,j) *= d;
+        inv(k,j) *= d;
+      }
+      for (int i=0; i!=N; ++i) {
+        if (i == k) continue;
+        double m = a(i,k);
+        for (int j=0; j!=N; ++j) {
+          a(i,j) -= m * a(k,j);
+          inv(i,j) -= m * inv(k,j);
+        }
+      }
+    }
+    return true;
+  }
+
+ private:
+  double v_[N*N];
+};
+
+// Closed form for the flow-energy system, identical to the VBR path.
+template<>
+inline bool CellBlock<2>::Inverse(CellBlock<2>& inv) const {
+  double det = v_[0]*v_[3] - v_[2]*v_[1];
+  if (std::abs(det) <= 1.e-30) return false;
+  inv(0,0) = v_[3] / det;
+  inv(1,1) = v_[0] / det;
+  inv(0,1) = -v_[2] / det;
+  inv(1,0) = -v_[1] / det;
+  return true;
+}
+
+
+template<int N>
+class FaceBlockSchur {
+ public:
+  explicit FaceBlockSchur(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) :
+      mesh_(mesh),
+      conn_(MeshConnectivity::Get(mesh)) {}
+
+  // For i == j, the MatrixMFD of equation i.  For i != j, a MatrixMFD whose
+  // Acf couples the cells of equation i to the faces of equation j; these
+  // are optional.
+  void SetBlock(int i, int j, const Teuchos::RCP<const MatrixMFD>& block) {
+    blocks_[i][j] = block;
+  }
+
+  // Cell block of an owned cell, filled by the caller before Assemble().
+  CellBlock<N>& Kcc(int c) { return Kcc_[c]; }
+
+  // Inverse of the cell block, valid after Assemble().
+  const CellBlock<N>& KccInverse(int c) const { return Kcc_inv_[c]; }
+
+  // Build the map, graph, and scatter plan.  Collective.
+  void SymbolicAssemble();
+
+  // Invert the cell blocks and assemble S.  Collective.  Throws
+  // Errors::CutTimeStep if a cell block is singular.
+  void Assemble();
+
+  const Epetra_Map& Map() const { return *map_; }
+  Teuchos::RCP<Epetra_FECrsMatrix> Schur() const { return S_; }
+
+ private:
+  void CellGIDs_(int c, int* gids) const;
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
+  Teuchos::RCP<const MeshConnectivity> conn_;
+  Teuchos::RCP<const MatrixMFD> blocks_[N][N];
+
+  std::vector<CellBlock<N> > Kcc_;
+  std::vector<CellBlock<N> > Kcc_inv_;
+
+  Teuchos::RCP<Epetra_Map> map_;
+  Teuchos::RCP<Epetra_FECrsMatrix> S_;
+  Teuchos::RCP<CrsScatterPlan> plan_;
+};
+
+
+template<int N>
+void FaceBlockSchur<N>::CellGIDs_(int c, int* gids) const {
+  const Epetra_Map& fmap_wghost = mesh_->face_map(true);
+  const int* faces = conn_->cell_faces(c);
+  int nfaces = conn_->cell_num_faces(c);
+  for (int n=0; n!=nfaces; ++n) {
+    int gid = fmap_wghost.GID(faces[n]);
+    for (int k=0; k!=N; ++k) gids[N*n + k] = N*gid + k;
+  }
+}
+
+
+template<int N>
+void FaceBlockSchur<N>::SymbolicAssemble() {
+  const Epetra_Map& fmap = mesh_->face_map(false);
+  int nfaces_owned = fmap.NumMyElements();
+  int ncells = conn_->num_cells_owned();
+
+  // interleaved point map
+  std::vector<int> map_gids(N*nfaces_owned);
+  for (int f=0; f!=nfaces_owned; ++f) {
+    for (int k=0; k!=N; ++k) map_gids[N*f + k] = N*fmap.GID(f) + k;
+  }
+  map_ = Teuchos::rcp(new Epetra_Map(-1, map_gids.size(),
+          map_gids.size() ? &map_gids[0] : NULL, 0, fmap.Comm()));
+
+  // graph
+  int gids[N*MFD_MAX_FACES];
+  Epetra_FECrsGraph graph(Copy, *map_, N*(2*MFD_HEX_FACES - 1), false);
+  for (int c=0; c!=ncells; ++c) {
+    int m = N*conn_->cell_num_faces(c);
+    CellGIDs_(c, gids);
+    int ierr = graph.InsertGlobalIndices(m, gids, m, gids);
+    AMANZI_ASSERT(!ierr);
+  }
+  int ierr = graph.GlobalAssemble();
+  AMANZI_ASSERT(!ierr);
+
+  S_ = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, graph));
+  ierr = S_->GlobalAssemble();
+  AMANZI_ASSERT(!ierr);
+
+  // value-only assembly, if every process can use it
+  int local_ok = CrsScatterPlan::Supported(*S_) ? 1 : 0;
+  int ok = 0;
+  map_->Comm().MinAll(&local_ok, &ok, 1);
+  plan_ = Teuchos::null;
+  if (ok) {
+    plan_ = Teuchos::rcp(new CrsScatterPlan(*S_));
+    for (int c=0; c!=ncells; ++c) {
+      int m = N*conn_->cell_num_faces(c);
+      CellGIDs_(c, gids);
+      plan_->AddElement(m, gids, m, gids);
+    }
+    plan_->Finalize();
+  }
+
+  Kcc_.resize(ncells);
+  Kcc_inv_.resize(ncells);
+}
+
+
+template<int N>
+void FaceBlockSchur<N>::Assemble() {
+  int ncells = conn_->num_cells_owned();
+  AMANZI_ASSERT(Kcc_.size() == ncells);
+
+  // local matrices of the blocks
+  const std::vector<Teuchos::SerialDenseMatrix<int, double> >* Kff[N];
+  const std::vector<Epetra_SerialDenseVector>* Kfc[N];
+  const std::vector<Epetra_SerialDenseVector>* Kcf[N][N];
+  for (int i=0; i!=N; ++i) {
+    AMANZI_ASSERT(blocks_[i][i] != Teuchos::null);
+    Kff[i] = &blocks_[i][i]->Aff_cells();
+    Kfc[i] = &blocks_[i][i]->Afc_cells();
+    for (int j=0; j!=N; ++j) {
+      Kcf[i][j] = blocks_[i][j] == Teuchos::null ? NULL : &blocks_[i][j]->Acf_cells();
+    }
+  }
+
+  // workspace
+  const int M = N*MFD_MAX_FACES;
+  double W[N*N*MFD_MAX_FACES];  // W(i,j)(m) = sum_k Kcc^-1(i,k) * Kcf(k,j)(m)
+  double T[M*M];
+  int gids[M];
+
+  if (plan_ != Teuchos::null) {
+    plan_->PutScalar(0.);
+  } else {
+    S_->PutScalar(0.);
+  }
+
+  for (int c=0; c!=ncells; ++c) {
+    if (!Kcc_[c].Inverse(Kcc_inv_[c])) {
+      std::cout << "FaceBlockSchur: Division by zero: the cell block is singular" << std::endl;
+      Exceptions::amanzi_throw(Errors::CutTimeStep());
+    }
+    const CellBlock<N>& inv = Kcc_inv_[c];
+    int nfaces = conn_->cell_num_faces(c);
+    int m_size = N*nfaces;
+
+    for (int j=0; j!=N; ++j) {
+      for (int i=0; i!=N; ++i) {
+        double* Wij = &W[(i + N*j)*nfaces];
+        for (int m=0; m!=nfaces; ++m) Wij[m] = 0.;
+        for (int k=0; k!=N; ++k) {
+          if (Kcf[k][j] == NULL) continue;
+          const Epetra_SerialDenseVector& Kcf_kj = (*Kcf[k][j])[c];
+          for (int m=0; m!=nfaces; ++m) Wij[m] += inv(i,k) * Kcf_kj(m);
+        }
+      }
+    }
+
+    // T = Kff - Kfc * W, with rows N*n + i and columns N*m + j
+    for (int m=0; m!=nfaces; ++m) {
+      for (int j=0; j!=N; ++j) {
+        double* Tcol = &T[m_size*(N*m + j)];
+        for (int n=0; n!=nfaces; ++n) {
+          for (int i=0; i!=N; ++i) {
+            Tcol[N*n + i] = -(*Kfc[i])[c](n) * W[(i + N*j)*nfaces + m];
+          }
+          Tcol[N*n + j] += (*Kff[j])[c](n, m);
+        }
+      }
+    }
+
+    if (plan_ != Teuchos::null) {
+      plan_->SumIntoElement(c, T);
+    } else {
+      CellGIDs_(c, gids);
+      int ierr = S_->SumIntoGlobalValues(m_size, gids, T);
+      AMANZI_ASSERT(!ierr);
+    }
+  }
+
+  if (plan_ != Teuchos::null) {
+    plan_->GlobalAssemble();
+  } else {
+    int ierr = S_->GlobalAssemble();
+    AMANZI_ASSERT(!ierr);
+  }
+}
+
+}  // namespace Operators
+}  // namespace Amanzi
+
+#endif
@@ -10,6 +10,7 @@
 #define OPERATORS_MATRIX_MFD_HH_
 
 #include <strings.h>
+#include <set>
 
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_SerialDenseMatrix.hpp"
@@ -38,6 +39,8 @@
 #include "LinearOperatorFactory.hh"
 
 #include "MatrixMFD_Defs.hh"
+#include "MeshConnectivity.hh"
+#include "CrsScatterPlan.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -73,6 +76,10 @@ class MatrixMFD : public CompositeMatrix {
 
 
   // Access to local matrices for external tweaking.
+  //
+  // Aff, Acf, Afc, and Ff local matrices are views into packed storage (see
+  // InitializeLocalMatrixStorage_()).  Entries may be modified freely, but
+  // the containers must not be resized and entries must not be reassigned.
   std::vector<double>& Acc_cells() {
     MarkLocalMatricesAsChanged_();
     return Acc_cells_;
@@ -191,6 +198,20 @@ class MatrixMFD : public CompositeMatrix {
   int ApplyAcf_(const CompositeVector& X, Epetra_MultiVector& Y, double scalar) const;
 
   void InitializeFromPList_();
+
+  // Forces lazily computed mesh geometry, see threaded_local_matrices_.
+  void PrepareMeshForThreads_() const;
+
+  // Allocates packed storage for the cell-local matrices and rhs and sets
+  // Aff_cells_, Acf_cells_, Afc_cells_, and Ff_cells_ as views into it.
+  // Storage is only reallocated if the number of cells has changed.  The
+  // rhs-only version leaves the local matrices untouched.
+  void InitializeCellFaceOffsets_();
+  void InitializeLocalMatrixStorage_();
+  void InitializeLocalRhsStorage_();
+  void SetLocalMatrixViews_();
+  void SetLocalRhsViews_();
+
   virtual void UpdatePreconditioner_() const;
 
   virtual void FillMatrixGraphs_(const Teuchos::Ptr<Epetra_CrsGraph> cf_graph,
@@ -201,6 +222,20 @@ class MatrixMFD : public CompositeMatrix {
   virtual void AssembleAff_() const;
   virtual void AssembleRHS_() const;
   virtual void AssembleSchur_() const;
+
+  // Matrix-free action of the cell local matrices, optionally subtracting
+  // the rhs in the same pass.
+  int ApplyFused_(const CompositeVector& X, CompositeVector& Y,
+                  bool subtract_rhs) const;
+
+  // True if ComputeNegativeResidual() may use ApplyFused_().  Classes that
+  // override Apply() must return false.
+  virtual bool FusedResidual_() const { return true; }
+
+  // Ensures plan assembles the cell face-face blocks into matrix, building
+  // it if needed.  Returns false if precomputed assembly is not used.
+  bool UpdateCellFacePlan_(Teuchos::RCP<CrsScatterPlan>& plan,
+                           Epetra_CrsMatrix& matrix) const;
   
  private:
   // These are dangerous -- they require ghosted vectors, and a
@@ -212,6 +247,7 @@ class MatrixMFD : public CompositeMatrix {
 
  protected:
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
+  Teuchos::RCP<const MeshConnectivity> conn_;  // cached cell/face connectivity
   Teuchos::ParameterList plist_;
   bool flag_symmetry_;
 
@@ -222,6 +258,11 @@ class MatrixMFD : public CompositeMatrix {
 
   MFDMethod method_;
 
+  // If true and built with OpenMP, local mass and stiffness matrices are
+  // built by threaded cell loops.  This requires thread-safe read access to
+  // the mesh.
+  bool threaded_local_matrices_;
+
   // local matrices
   std::vector<WhetStone::DenseMatrix > Mff_cells_;
   std::vector<Teuchos::SerialDenseMatrix<int, double> > Aff_cells_;
@@ -230,6 +271,16 @@ class MatrixMFD : public CompositeMatrix {
   std::vector<Epetra_SerialDenseVector> Ff_cells_;
   std::vector<double> Fc_cells_;
 
+  // packed storage backing the local matrices, one buffer per block type.
+  // Cell c owns entries [offsets[c], offsets[c+1]), where the offsets are
+  // keyed by the number of faces (face2: number of faces squared).
+  std::vector<int> cell_face_offsets_;
+  std::vector<int> cell_face2_offsets_;
+  std::vector<double> Aff_values_;  // column-major, like SerialDenseMatrix
+  std::vector<double> Acf_values_;
+  std::vector<double> Afc_values_;
+  std::vector<double> Ff_values_;
+
   // boundary condition flags
   std::vector<MatrixBC> bc_markers_;
 
@@ -238,6 +289,12 @@ class MatrixMFD : public CompositeMatrix {
   mutable Teuchos::RCP<Epetra_FECrsMatrix> Aff_;
   mutable Teuchos::RCP<Epetra_FECrsMatrix> Sff_;  // Schur complement
 
+  // value-only assembly of Aff_ and Sff_, planned on first assembly
+  bool precomputed_assembly_;
+  mutable Teuchos::RCP<CrsScatterPlan> Aff_plan_;
+  mutable Teuchos::RCP<CrsScatterPlan> Sff_plan_;
+  mutable std::set<const Epetra_CrsMatrix*> unplanned_;  // plan rejected
+
   // global rhs
   mutable Teuchos::RCP<CompositeVector> rhs_;
 
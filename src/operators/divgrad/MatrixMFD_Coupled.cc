@@ -56,6 +56,7 @@ MatrixMFD_Coupled::MatrixMFD_Coupled(Teuchos::ParameterList& plist,
     plist_(plist),
     mesh_(mesh),
     assembled_schur_(false),
+    assembled_pc_(false),
     is_schur_created_(false),
     is_operator_created_(false) {
   InitializeFromPList_();
@@ -66,6 +67,7 @@ MatrixMFD_Coupled::MatrixMFD_Coupled(const MatrixMFD_Coupled& other) :
     plist_(other.plist_),
     mesh_(other.mesh_),
     assembled_schur_(false),
+    assembled_pc_(false),
     is_schur_created_(false) {
   InitializeFromPList_();
 }
@@ -84,6 +86,19 @@ void MatrixMFD_Coupled::InitializeFromPList_() {
 
   // dump
   dump_schur_ = plist_.get<bool>("dump Schur complement", false);
+
+  // storage of the Schur complement
+  std::string format = plist_.get<std::string>("Schur complement format", "VBR");
+  if (format == "VBR") {
+    schur_bsr_ = false;
+  } else if (format == "BSR") {
+    schur_bsr_ = true;
+  } else {
+    Errors::Message msg;
+    msg << "MatrixMFD_Coupled: unknown \"Schur complement format\" \"" << format
+        << "\", valid are \"VBR\" and \"BSR\".";
+    Exceptions::amanzi_throw(msg);
+  }
 }
 
 
@@ -109,9 +124,11 @@ void MatrixMFD_Coupled::SetSubBlocks(const Teuchos::RCP<MatrixMFD>& blockA,
 
 int MatrixMFD_Coupled::ApplyInverse(const TreeVector& X,
         TreeVector& Y) const {
-  if (!assembled_schur_) {
-    AssembleSchur_();
+  // Schur() may have assembled without updating the preconditioner
+  if (!assembled_schur_) AssembleSchur_();
+  if (!assembled_pc_) {
     UpdatePreconditioner_();
+    assembled_pc_ = true;
   }
 
   if (S_pc_ == Teuchos::null) {
@@ -127,9 +144,11 @@ int MatrixMFD_Coupled::ApplyInverse(const TreeVector& X,
   const Epetra_MultiVector& XA_f = *XA->ViewComponent("face", false);
   const Epetra_MultiVector& XB_f = *XB->ViewComponent("face", false);
 
-  // Temporary cell and face vectors.
-  Epetra_MultiVector Xf(*double_fmap_, 1);
-  Epetra_MultiVector Yf(*double_fmap_, 1);
+  // Temporary cell and face vectors, with the same layout in either format.
+  const Epetra_BlockMap& smap = P2f2f_bsr_ == Teuchos::null ? *double_fmap_
+      : P2f2f_bsr_->Map();
+  Epetra_MultiVector Xf(smap, 1);
+  Epetra_MultiVector Yf(smap, 1);
 
   Teuchos::RCP<CompositeVector> A = 
     Teuchos::rcp(new CompositeVector(*XA, INIT_MODE_ZERO));
@@ -150,10 +169,9 @@ int MatrixMFD_Coupled::ApplyInverse(const TreeVector& X,
     Epetra_MultiVector& Ac = *A->ViewComponent("cell",false);
     Epetra_MultiVector& Bc = *B->ViewComponent("cell",false);
     for (int c=0; c!=ncells; ++c){
-      Ac[0][c] = A2c2c_cells_Inv_[c](0,0)*XA_c[0][c] 
-	+ A2c2c_cells_Inv_[c](0,1)*XB_c[0][c];
-      Bc[0][c] = A2c2c_cells_Inv_[c](1,0)*XA_c[0][c] 
-	+ A2c2c_cells_Inv_[c](1,1)*XB_c[0][c];
+      const double* inv = CellInverse_(c);
+      Ac[0][c] = inv[0]*XA_c[0][c] + inv[2]*XB_c[0][c];
+      Bc[0][c] = inv[1]*XA_c[0][c] + inv[3]*XB_c[0][c];
     }
   }
 
@@ -206,8 +224,9 @@ int MatrixMFD_Coupled::ApplyInverse(const TreeVector& X,
       double tmpA = XA_c[0][c] - YA_c[0][c];
       double tmpB = XB_c[0][c] - YB_c[0][c];
 
-      YA_c[0][c] = A2c2c_cells_Inv_[c](0,0)*tmpA + A2c2c_cells_Inv_[c](0,1)*tmpB;
-      YB_c[0][c] = A2c2c_cells_Inv_[c](1,0)*tmpA + A2c2c_cells_Inv_[c](1,1)*tmpB;
+      const double* inv = CellInverse_(c);
+      YA_c[0][c] = inv[0]*tmpA + inv[2]*tmpB;
+      YB_c[0][c] = inv[1]*tmpA + inv[3]*tmpB;
     }
   }
 
@@ -341,7 +360,29 @@ void MatrixMFD_Coupled::AssembleSchur_() const {
 
   std::vector<double>& Gcc = adv_block_->Acc_cells();
   std::vector<Epetra_SerialDenseVector>& Gcf = adv_block_->Acf_cells();
-  
+
+  if (P2f2f_bsr_ != Teuchos::null) {
+    // cell blocks, as in the VBR path below, then the templated assembly
+    for (int c=0; c!=ncells; ++c) {
+      CellBlock<2>& Kcc = P2f2f_bsr_->Kcc(c);
+      Kcc(0,0) = Acc[c];
+      Kcc(0,1) = (*Ccc_)[0][c]*scaling_;
+      Kcc(1,0) = (*Dcc_)[0][c]*scaling_ + Gcc[c];
+      Kcc(1,1) = Bcc[c];
+    }
+    P2f2f_bsr_->SetBlock(0, 0, blockA_);
+    P2f2f_bsr_->SetBlock(1, 1, blockB_);
+    P2f2f_bsr_->SetBlock(1, 0, adv_block_);
+    P2f2f_bsr_->Assemble();
+    assembled_schur_ = true;
+    is_schur_created_ = true;
+
+    if (dump_schur_) {
+      EpetraExt::RowMatrixToMatlabFile("schur_MatrixMFD_Coupled_0.txt", *P2f2f_bsr_->Schur());
+    }
+    return;
+  }
+
   // workspace
   Teuchos::SerialDenseMatrix<int, double> cell_inv(2, 2);
   Epetra_SerialDenseMatrix values(2, 2);
@@ -475,11 +516,16 @@ void MatrixMFD_Coupled::SymbolicAssembleGlobalMatrices() {
   // Create the matrices
   A2f2c_ = Teuchos::rcp(new Epetra_VbrMatrix(Copy, *cf_graph)); // stored in transpose
   A2c2f_ = Teuchos::rcp(new Epetra_VbrMatrix(Copy, *cf_graph));
-  P2f2f_ = Teuchos::rcp(new Epetra_FEVbrMatrix(Copy, *ff_graph, false));
-  //  A2f2f_ = Teuchos::rcp(new Epetra_FEVbrMatrix(Copy, *ff_graph, false));
-  ierr = P2f2f_->GlobalAssemble();
-  //  ierr = A2f2f_->GlobalAssemble();
-  AMANZI_ASSERT(!ierr);
+  if (schur_bsr_) {
+    P2f2f_bsr_ = Teuchos::rcp(new FaceBlockSchur<2>(mesh_));
+    P2f2f_bsr_->SymbolicAssemble();
+  } else {
+    P2f2f_ = Teuchos::rcp(new Epetra_FEVbrMatrix(Copy, *ff_graph, false));
+    //  A2f2f_ = Teuchos::rcp(new Epetra_FEVbrMatrix(Copy, *ff_graph, false));
+    ierr = P2f2f_->GlobalAssemble();
+    //  ierr = A2f2f_->GlobalAssemble();
+    AMANZI_ASSERT(!ierr);
+  }
 }
 
 
@@ -493,7 +539,11 @@ void MatrixMFD_Coupled::UpdatePreconditioner_() const {
     Exceptions::amanzi_throw(msg);
   }
   S_pc_->Destroy();
-  S_pc_->Update(P2f2f_);
+  if (P2f2f_bsr_ != Teuchos::null) {
+    S_pc_->Update(P2f2f_bsr_->Schur());
+  } else {
+    S_pc_->Update(P2f2f_);
+  }
 }
 
 
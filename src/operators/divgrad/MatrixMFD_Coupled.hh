@@ -34,6 +34,11 @@
                    [  0   Bff ]     [  0  Bfc ][ Dcc  Bcc ]    [  0  Bcf ]
 
   This class forms this matrix.
+
+  Parameter "Schur complement format" chooses its storage: "VBR" (default),
+  an Epetra_FEVbrMatrix of 2x2 blocks, or "BSR", a point matrix with the two
+  unknowns of each face interleaved, assembled by FaceBlockSchur<2>.  The
+  _Surf, _TPFA and _Permafrost variants support "VBR" only.
  */
 
 
@@ -54,6 +59,7 @@
 #include "Preconditioner.hh"
 
 #include "MatrixMFD.hh"
+#include "FaceBlockSchur.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -84,9 +90,16 @@ class MatrixMFD_Coupled : public TreeMatrix {
     MarkLocalMatricesAsChanged_();
   }
 
+  // Null in the other format.  These assemble the Schur complement only; the
+  // preconditioner is updated by the next ApplyInverse().
   Teuchos::RCP<const Epetra_FEVbrMatrix> Schur() {
+    if (!assembled_schur_) AssembleSchur_();
     return P2f2f_;
   }
+  Teuchos::RCP<const Epetra_FECrsMatrix> SchurBSR() {
+    if (!assembled_schur_) AssembleSchur_();
+    return P2f2f_bsr_ == Teuchos::null ? Teuchos::null : P2f2f_bsr_->Schur();
+  }
   Teuchos::RCP<const Epetra_FEVbrMatrix> Aff() {
     return A2f2f_;
   }
@@ -124,6 +137,7 @@ class MatrixMFD_Coupled : public TreeMatrix {
  protected:
   virtual void MarkLocalMatricesAsChanged_() {
     assembled_schur_ = false;
+    assembled_pc_ = false;
     assembled_operator_ = false;
   }
 
@@ -131,6 +145,12 @@ class MatrixMFD_Coupled : public TreeMatrix {
   virtual void AssembleAff_() const;
   virtual void UpdatePreconditioner_() const;
 
+  // inverse of the 2x2 cell block, column-major
+  const double* CellInverse_(int c) const {
+    return P2f2f_bsr_ == Teuchos::null ? A2c2c_cells_Inv_[c].values()
+        : P2f2f_bsr_->KccInverse(c).values();
+  }
+
  protected:
   // mesh
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
@@ -157,6 +177,7 @@ class MatrixMFD_Coupled : public TreeMatrix {
   mutable Teuchos::RCP<Epetra_VbrMatrix> A2c2f_;
   mutable Teuchos::RCP<Epetra_FEVbrMatrix> P2f2f_;
   mutable Teuchos::RCP<Epetra_FEVbrMatrix> A2f2f_;
+  Teuchos::RCP<FaceBlockSchur<2> > P2f2f_bsr_;  // "BSR" format only
 
   // maps
   Teuchos::RCP<const Epetra_BlockMap> double_fmap_;
@@ -166,9 +187,11 @@ class MatrixMFD_Coupled : public TreeMatrix {
   // flags
   mutable bool assembled_operator_;
   mutable bool assembled_schur_;
+  mutable bool assembled_pc_;  // preconditioner of the assembled Schur complement
   mutable bool is_schur_created_;
   mutable bool is_operator_created_;
   bool dump_schur_;
+  bool schur_bsr_;
 
   // preconditioner for Schur complement
   Teuchos::RCP<AmanziPreconditioners::Preconditioner> S_pc_;
@@ -70,6 +70,11 @@ void MatrixMFD_Coupled_Surf::SymbolicAssembleGlobalMatrices() {
   // Identical to MatrixMFD_Coupled, but does the FillMatrixGraph call
   // with a _Surf matrix, which must first be created.
   int ierr(0);
+  if (schur_bsr_) {
+    Errors::Message msg("MatrixMFD_Coupled_Surf: \"Schur complement format\" \"BSR\" is not supported.");
+    Exceptions::amanzi_throw(msg);
+  }
+
   const Epetra_BlockMap& cmap = mesh_->cell_map(false);
   const Epetra_BlockMap& fmap = mesh_->face_map(false);
   const Epetra_BlockMap& fmap_wghost = mesh_->face_map(true);
@@ -33,9 +33,11 @@ void MatrixMFD_Coupled_TPFA::SetSubBlocks(const Teuchos::RCP<MatrixMFD>& blockA,
 
 int MatrixMFD_Coupled_TPFA::ApplyInverse(const TreeVector& X,
         TreeVector& Y) const {
-  if (!assembled_schur_) {
-    AssembleSchur_();
+  // Schur() may have assembled without updating the preconditioner
+  if (!assembled_schur_) AssembleSchur_();
+  if (!assembled_pc_) {
     UpdatePreconditioner_();
+    assembled_pc_ = true;
   }
 
   if (S_pc_ == Teuchos::null) {
@@ -198,6 +200,10 @@ void MatrixMFD_Coupled_TPFA::AssembleSchur_() const {
 
 
 void MatrixMFD_Coupled_TPFA::SymbolicAssembleGlobalMatrices() {
+  if (schur_bsr_) {
+    Errors::Message msg("MatrixMFD_Coupled_TPFA: \"Schur complement format\" \"BSR\" is not supported.");
+    Exceptions::amanzi_throw(msg);
+  }
 
   // get the standard matrices
   MatrixMFD_Coupled::SymbolicAssembleGlobalMatrices();
@@ -1,4 +1,5 @@
 #include "EpetraExt_RowMatrixOut.h"
+#include "errors.hh"
 
 #include "MatrixMFD_Permafrost.hh"
 
@@ -21,6 +22,12 @@ MatrixMFD_Permafrost::MatrixMFD_Permafrost(const MatrixMFD_Permafrost& other) :
 
 
 void MatrixMFD_Permafrost::ComputeSchurComplement() {
+  // the surface terms are summed into the VBR Schur complement
+  if (schur_bsr_) {
+    Errors::Message msg("MatrixMFD_Permafrost: \"Schur complement format\" \"BSR\" is not supported.");
+    Exceptions::amanzi_throw(msg);
+  }
+
   // Base ComputeSchurComplement() gets the standard face parts
   MatrixMFD_Coupled::ComputeSchurComplement();
 
@@ -41,6 +41,9 @@ class MatrixMFD_Surf : virtual public MatrixMFD {
                      CompositeVector& Y) const;
 
  protected:
+  // Apply() is overridden, so residuals may not use the base fused path.
+  virtual bool FusedResidual_() const { return false; }
+
   virtual void FillMatrixGraphs_(const Teuchos::Ptr<Epetra_CrsGraph> cf_graph,
           const Teuchos::Ptr<Epetra_FECrsGraph> ff_graph);
 
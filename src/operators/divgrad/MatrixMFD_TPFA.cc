@@ -49,27 +49,17 @@ void MatrixMFD_TPFA::CreateMFDstiffnessMatrices(
 
   int ncells = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
   
-  if (Aff_cells_.size() != ncells) {
-    Aff_cells_.resize(static_cast<size_t>(ncells));
-  }
-  if (Afc_cells_.size() != ncells) {
-    Afc_cells_.resize(static_cast<size_t>(ncells));
-  }
-  if (Acf_cells_.size() != ncells) {
-    Acf_cells_.resize(static_cast<size_t>(ncells));
-  }
-  if (Acc_cells_.size() != ncells) {
-    Acc_cells_.resize(static_cast<size_t>(ncells));
-    Acc_ = Teuchos::rcp(new Epetra_Vector(View,mesh_->cell_map(false),&Acc_cells_[0]));
-  }  
+  InitializeLocalMatrixStorage_();
 
   for (int c=0; c!=ncells; ++c) {
     mesh_->cell_get_faces(c, &faces);
     int nfaces = faces.size();
 
     WhetStone::DenseMatrix& Mff = Mff_cells_[c];
-    Teuchos::SerialDenseMatrix<int, double> Bff(nfaces,nfaces);
-    Epetra_SerialDenseVector Bcf(nfaces), Bfc(nfaces);
+    Teuchos::SerialDenseMatrix<int, double>& Bff = Aff_cells_[c];
+    Epetra_SerialDenseVector& Bcf = Acf_cells_[c];
+    Epetra_SerialDenseVector& Bfc = Afc_cells_[c];
+    Bff.putScalar(0.);
 
     if (Krel == Teuchos::null ||
         (!Krel->HasComponent("cell") && !Krel->HasComponent("face"))) {
@@ -107,9 +97,6 @@ void MatrixMFD_TPFA::CreateMFDstiffnessMatrices(
       matsum += colsum;
     }
 
-    Aff_cells_[c] = Bff;
-    Afc_cells_[c] = Bfc;
-    Acf_cells_[c] = Bcf;
     Acc_cells_[c] = matsum;
 
   }
@@ -550,19 +537,19 @@ void MatrixMFD_TPFA::AnalyticJacobian(const Upwinding& upwinding,
   int ierr = 0;
 
   // Get the derivatives
-  std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > > Jpp_faces;
-  upwinding.UpdateDerivatives(S, potential_key, dconductivity, bc_markers, bc_values, &Jpp_faces);
-  AMANZI_ASSERT(Jpp_faces.size() == nfaces_owned);
+  upwinding.UpdateDerivatives(S, potential_key, dconductivity, bc_markers, bc_values, &Jpp_faces_);
+  AMANZI_ASSERT(Jpp_faces_.size() == nfaces_owned);
 
   // Assemble into App
   for (unsigned int f=0; f!=nfaces_owned; ++f) {
     mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
 
     int mcells = cells.size();
+    AMANZI_ASSERT(mcells == Jpp_faces_.num_cells(f));
     for (int n=0; n!=mcells; ++n) {
       cells_GID[n] = cmap_wghost.GID(cells[n]);
     }
-    ierr = (*App_).SumIntoGlobalValues(mcells, cells_GID, Jpp_faces[f]->values());
+    ierr = (*App_).SumIntoGlobalValues(mcells, cells_GID, Jpp_faces_.values(f));
     AMANZI_ASSERT(!ierr);
   }
 
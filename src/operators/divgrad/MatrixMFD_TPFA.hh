@@ -71,6 +71,9 @@ class MatrixMFD_TPFA : virtual public MatrixMFD {
   }
 
  protected:
+  // Apply() is overridden, so residuals may not use the base fused path.
+  virtual bool FusedResidual_() const { return false; }
+
   virtual void MarkLocalMatricesAsChanged_() {
     assembled_operator_ = false;
     assembled_schur_ = false;
@@ -87,6 +90,7 @@ class MatrixMFD_TPFA : virtual public MatrixMFD {
  protected:
   mutable Teuchos::RCP<CompositeVector> Dff_;
   mutable Teuchos::RCP<Epetra_FECrsMatrix> App_;  // Explicit Schur complement
+  FaceJacobian Jpp_faces_;  // reused by AnalyticJacobian()
   bool cells_only_;
   mutable bool assembled_app_;
   mutable bool assembled_dff_;
@@ -41,27 +41,17 @@ void MatrixMFD_TPFA_ScaledConstraint::CreateMFDstiffnessMatrices(
 
     int ncells = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
-    if (Aff_cells_.size() != ncells) {
-      Aff_cells_.resize(static_cast<size_t>(ncells));
-    }
-    if (Afc_cells_.size() != ncells) {
-      Afc_cells_.resize(static_cast<size_t>(ncells));
-    }
-    if (Acf_cells_.size() != ncells) {
-      Acf_cells_.resize(static_cast<size_t>(ncells));
-    }
-    if (Acc_cells_.size() != ncells) {
-      Acc_cells_.resize(static_cast<size_t>(ncells));
-      Acc_ = Teuchos::rcp(new Epetra_Vector(View,mesh_->cell_map(false),&Acc_cells_[0]));
-    }     
+    InitializeLocalMatrixStorage_();
 
     for (int c=0; c!=ncells; ++c) {
       mesh_->cell_get_faces(c, &faces);
       int nfaces = faces.size();
 
       WhetStone::DenseMatrix& Mff = Mff_cells_[c];
-      Teuchos::SerialDenseMatrix<int, double> Bff(nfaces,nfaces);
-      Epetra_SerialDenseVector Bcf(nfaces), Bfc(nfaces);
+      Teuchos::SerialDenseMatrix<int, double>& Bff = Aff_cells_[c];
+      Epetra_SerialDenseVector& Bcf = Acf_cells_[c];
+      Epetra_SerialDenseVector& Bfc = Afc_cells_[c];
+      Bff.putScalar(0.);
 
       if (Krel->HasComponent("cell")) {
         const Epetra_MultiVector& Krel_c = *Krel->ViewComponent("cell",false);
@@ -84,9 +74,6 @@ void MatrixMFD_TPFA_ScaledConstraint::CreateMFDstiffnessMatrices(
         matsum += colsum;
       }
 
-      Aff_cells_[c] = Bff;
-      Afc_cells_[c] = Bfc;
-      Acf_cells_[c] = Bcf;
       Acc_cells_[c] = matsum;
     }
   }
@@ -261,6 +261,31 @@ void Matrix_TPFA::SymbolicAssembleGlobalMatrices() {
   Aff_ = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, *fbfb_graph));
   Aff_->GlobalAssemble();
 
+  // plan value-only reassembly, in the face order of AssembleSchur_()
+  Spp_plan_ = Teuchos::null;
+  Aff_bf_plan_ = Teuchos::null;
+  int local_ok = (CrsScatterPlan::Supported(*Spp_) && CrsScatterPlan::Supported(*Aff_)) ? 1 : 0;
+  int ok = 0;
+  cmap.Comm().MinAll(&local_ok, &ok, 1);
+
+  if (precomputed_assembly_ && ok) {
+    Spp_plan_ = Teuchos::rcp(new CrsScatterPlan(*Spp_));
+    Aff_bf_plan_ = Teuchos::rcp(new CrsScatterPlan(*Aff_));
+    for (int f = 0; f < nfaces; f++) {
+      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+      int ncells = cells.size();
+
+      for (int n = 0; n < ncells; n++) cells_GID[n] = cmap_wghost.GID(cells[n]);
+      Spp_plan_->AddElement(ncells, cells_GID, ncells, cells_GID);
+
+      if (ncells == 1) {
+        face_GID = fmap.GID(f);
+        Aff_bf_plan_->AddElement(1, &face_GID, 1, &face_GID);
+      }
+    }
+    Spp_plan_->Finalize();
+    Aff_bf_plan_->Finalize();
+  }
 
 }
 
@@ -293,8 +318,15 @@ void Matrix_TPFA::AssembleSchur_() const {
   // std::cout<<"rhs_bf\n"<<rhs_bf<<"\n";
   // exit(0);
 
-  Spp_->PutScalar(0.0);
-  Aff_->PutScalar(0.0);
+  bool use_plan = Spp_plan_ != Teuchos::null;
+  int fb_elem = 0;
+  if (use_plan) {
+    Spp_plan_->PutScalar(0.0);
+    Aff_bf_plan_->PutScalar(0.0);
+  } else {
+    Spp_->PutScalar(0.0);
+    Aff_->PutScalar(0.0);
+  }
 
   for (AmanziMesh::Entity_ID f=0; f!=nfaces_owned; ++f) {
     mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
@@ -337,13 +369,21 @@ void Matrix_TPFA::AssembleSchur_() const {
       }
 
 
-      (*Aff_).SumIntoGlobalValues(face_GID, 1,  &(Dff_f[0][fb_lid]), &face_GID);
+      if (use_plan) {
+        Aff_bf_plan_->SumIntoElement(fb_elem++, &(Dff_f[0][fb_lid]));
+      } else {
+        (*Aff_).SumIntoGlobalValues(face_GID, 1,  &(Dff_f[0][fb_lid]), &face_GID);
+      }
 
       /// Schur comlement contribution for rhs_cells (old verion)
       //  rhs_cells[0][c] += rhs_bf[0][fb_lid]*Afc_cells_[f](0) / Dff_f[0][fb_lid];
 
     }
-    (*Spp_).SumIntoGlobalValues(mcells, cells_GID, Bpp.values());
+    if (use_plan) {
+      Spp_plan_->SumIntoElement(f, Bpp.values());
+    } else {
+      (*Spp_).SumIntoGlobalValues(mcells, cells_GID, Bpp.values());
+    }
 
     // double val=100;
     // face_GID = fmap_wghost.GID(f);
@@ -351,8 +391,13 @@ void Matrix_TPFA::AssembleSchur_() const {
 
   }
 
-  (*Spp_).GlobalAssemble();
-  (*Aff_).GlobalAssemble();
+  if (use_plan) {
+    Spp_plan_->GlobalAssemble();
+    Aff_bf_plan_->GlobalAssemble();
+  } else {
+    (*Spp_).GlobalAssemble();
+    (*Aff_).GlobalAssemble();
+  }
 
   //(*Att_).GlobalAssemble();
   //(*Acf_).FillComplete();
@@ -572,31 +617,25 @@ void Matrix_TPFA::DeriveFlux(const CompositeVector& solution,
   // const Epetra_MultiVector& Krel_face = *rel_perm->ViewComponent("face", true);
   Epetra_MultiVector& flux = *mass_flux->ViewComponent("face", true);
 
-  const Epetra_Map& fb_map = mesh_->exterior_face_map(false);
-  const Epetra_Map& f_map = mesh_->face_map(false);
-
   int ncells_owned  = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
   int nfaces_wghost = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
   int nfaces_owned  = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
 
-  AmanziMesh::Entity_ID_List cells, faces;
-  std::vector<int> dirs;
-
   std::vector<int> flag(nfaces_wghost, 0);
 
   for (int c = 0; c < ncells_owned; c++) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
-    int nfaces = faces.size();
+    const int* faces = conn_->cell_faces(c);
+    const int* dirs = conn_->cell_face_dirs(c);
+    int nfaces = conn_->cell_num_faces(c);
 
     for (int n = 0; n < nfaces; n++) {
       int f = faces[n];
 
 
       if (f < nfaces_owned && !flag[f]) {
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        if (cells.size() == 1) {
-          int face_gid = f_map.GID(f);
-          int face_lbid = fb_map.LID(face_gid);
+        const int* cells = conn_->face_cells(f);
+        if (conn_->face_num_cells(f) == 1) {
+          int face_lbid = conn_->boundary_face(f);
           if (face_lbid >= 0) {
             double value = lb[0][face_lbid];
             flux[0][f] = dirs[n] * (*rel_perm_transmissibility_)[f] * (p[0][c] - value);// + (*gravity_term_)[f];
@@ -744,19 +783,29 @@ void Matrix_TPFA::AnalyticJacobian(const Upwinding& upwinding,
   int ierr = 0;
 
   // Get the derivatives
-  std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > > Jpp_faces;
-  upwinding.UpdateDerivatives(S, potential_key, dconductivity, bc_markers, bc_values, &Jpp_faces);
-  AMANZI_ASSERT(Jpp_faces.size() == nfaces_owned);
+  upwinding.UpdateDerivatives(S, potential_key, dconductivity, bc_markers, bc_values, &Jpp_faces_);
+  AMANZI_ASSERT(Jpp_faces_.size() == nfaces_owned);
 
   // Assemble into Spp
+  if (Spp_plan_ != Teuchos::null) {
+    for (unsigned int f=0; f!=nfaces_owned; ++f) {
+      // element f of the plan is the face's cells, as in the path below
+      AMANZI_ASSERT(conn_->face_num_cells(f) == Jpp_faces_.num_cells(f));
+      Spp_plan_->SumIntoElement(f, Jpp_faces_.values(f));
+    }
+    Spp_plan_->GlobalAssemble();
+    return;
+  }
+
   for (unsigned int f=0; f!=nfaces_owned; ++f) {
     mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
 
     int mcells = cells.size();
+    AMANZI_ASSERT(mcells == Jpp_faces_.num_cells(f));
     for (int n=0; n!=mcells; ++n) {
       cells_GID[n] = cmap_wghost.GID(cells[n]);
     }
-    ierr = (*Spp_).SumIntoGlobalValues(mcells, cells_GID, Jpp_faces[f]->values());
+    ierr = (*Spp_).SumIntoGlobalValues(mcells, cells_GID, Jpp_faces_.values(f));
     AMANZI_ASSERT(!ierr);
   }
 
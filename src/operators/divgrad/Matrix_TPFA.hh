@@ -100,6 +100,10 @@ class Matrix_TPFA :  public MatrixMFD {
  protected:
   mutable Teuchos::RCP<CompositeVector> Dff_;
   mutable Teuchos::RCP<Epetra_FECrsMatrix> Spp_;  // Explicit Schur complement
+  // value-only assembly: Spp_ by owned face, Aff_ by owned boundary face
+  Teuchos::RCP<CrsScatterPlan> Spp_plan_;
+  Teuchos::RCP<CrsScatterPlan> Aff_bf_plan_;
+  FaceJacobian Jpp_faces_;  // reused by AnalyticJacobian()
   mutable Teuchos::RCP<Epetra_CrsMatrix> Afc_;
   mutable Teuchos::RCP<Epetra_CrsMatrix> Acf_;
   //mutable Teuchos::RCP<AmanziPreconditioners::Preconditioner> Aff_pc_;
@@ -0,0 +1,74 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Cached, CSR-style mesh connectivity for operator and upwinding kernels.
+// -----------------------------------------------------------------------------
+
+#include "MeshKeyedCache.hh"
+#include "MeshConnectivity.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+MeshConnectivity::MeshConnectivity(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) :
+    mesh_(mesh.create_weak())
+{
+  ncells_owned_ = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  ncells_all_ = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
+  nfaces_owned_ = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  nfaces_all_ = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+
+  AmanziMesh::Entity_ID_List faces, cells;
+  std::vector<int> dirs;
+
+  // cell -> faces, dirs
+  cell_face_offsets_.resize(ncells_all_+1);
+  cell_face_offsets_[0] = 0;
+  for (int c=0; c!=ncells_all_; ++c) {
+    cell_face_offsets_[c+1] = cell_face_offsets_[c] + mesh_->cell_get_num_faces(c);
+  }
+
+  cell_faces_.resize(cell_face_offsets_[ncells_all_]);
+  cell_face_dirs_.resize(cell_face_offsets_[ncells_all_]);
+  for (int c=0; c!=ncells_all_; ++c) {
+    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
+    int i = cell_face_offsets_[c];
+    for (int n=0; n!=faces.size(); ++n) {
+      cell_faces_[i+n] = faces[n];
+      cell_face_dirs_[i+n] = dirs[n];
+    }
+  }
+
+  // face -> cells
+  face_cell_offsets_.resize(nfaces_all_+1);
+  face_cell_offsets_[0] = 0;
+  face_cells_.reserve(2*nfaces_all_);
+  for (int f=0; f!=nfaces_all_; ++f) {
+    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    face_cells_.insert(face_cells_.end(), cells.begin(), cells.end());
+    face_cell_offsets_[f+1] = face_cells_.size();
+  }
+
+  // owned face -> boundary face
+  const Epetra_Map& fb_map = mesh_->exterior_face_map(false);
+  const Epetra_Map& f_map = mesh_->face_map(false);
+  boundary_face_.assign(nfaces_all_, -1);
+  for (int f=0; f!=nfaces_owned_; ++f) {
+    boundary_face_[f] = fb_map.LID(f_map.GID(f));
+  }
+}
+
+
+Teuchos::RCP<const MeshConnectivity>
+MeshConnectivity::Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) {
+  static MeshKeyedCache<MeshConnectivity> cache;
+  return cache.Get(mesh);
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,92 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Cached, CSR-style mesh connectivity for operator and upwinding kernels.
+//
+// Hot loops in the div-grad operators and upwinding schemes walk
+// cell->faces (with orientations) and face->cells for every cell on every
+// call.  Querying the mesh fills a fresh Entity_ID_List each time; this
+// object flattens that connectivity once so those loops become indexed
+// sweeps.
+//
+// Connectivity and face orientations are topological, so they are not
+// changed by moving the nodes of a deformable mesh (Mesh::deform()).  Only
+// geometric quantities change with deformation, and none are cached here,
+// so a cache is valid for the life of its mesh.
+//
+// Use MeshConnectivity::Get(mesh) to share one instance per mesh.  The
+// instance holds its mesh only weakly, so the shared cache does not keep
+// meshes alive; users must hold the mesh themselves, as they already do.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_MESH_CONNECTIVITY_HH_
+#define AMANZI_OPERATORS_MESH_CONNECTIVITY_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class MeshConnectivity {
+ public:
+  explicit MeshConnectivity(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // Shared instance for a mesh, created on first request.
+  static Teuchos::RCP<const MeshConnectivity>
+  Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  Teuchos::RCP<const AmanziMesh::Mesh> Mesh() const { return mesh_.create_strong(); }
+
+  // entity counts
+  int num_cells_owned() const { return ncells_owned_; }
+  int num_cells() const { return ncells_all_; }  // owned + ghost
+  int num_faces_owned() const { return nfaces_owned_; }
+  int num_faces() const { return nfaces_all_; }  // owned + ghost
+
+  // cell -> faces and outward orientations, for all (owned and ghost) cells
+  int cell_num_faces(int c) const {
+    return cell_face_offsets_[c+1] - cell_face_offsets_[c]; }
+  const int* cell_faces(int c) const {
+    return &cell_faces_[cell_face_offsets_[c]]; }
+  const int* cell_face_dirs(int c) const {
+    return &cell_face_dirs_[cell_face_offsets_[c]]; }
+
+  // face -> cells, for all (owned and ghost) faces, with
+  // Parallel_type::ALL semantics
+  int face_num_cells(int f) const {
+    return face_cell_offsets_[f+1] - face_cell_offsets_[f]; }
+  const int* face_cells(int f) const {
+    return &face_cells_[face_cell_offsets_[f]]; }
+
+  // LID in exterior_face_map(false) of an owned face, or -1 if the face is
+  // not an owned boundary face
+  int boundary_face(int f) const { return boundary_face_[f]; }
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;  // weak
+
+  int ncells_owned_, ncells_all_;
+  int nfaces_owned_, nfaces_all_;
+
+  std::vector<int> cell_face_offsets_;
+  std::vector<int> cell_faces_;
+  std::vector<int> cell_face_dirs_;
+
+  std::vector<int> face_cell_offsets_;
+  std::vector<int> face_cells_;
+
+  std::vector<int> boundary_face_;
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -0,0 +1,90 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// A thread-safe cache of one object per mesh, keyed by the mesh.
+//
+// The cache does not keep meshes alive: it holds each mesh only weakly, and
+// cached objects must do the same (see MeshConnectivity).  An entry whose
+// mesh has been freed is never returned -- the mesh's address may since
+// have been reused by a new mesh -- and such entries are dropped, along with
+// the object, as the cache grows.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_MESH_KEYED_CACHE_HH_
+#define AMANZI_OPERATORS_MESH_KEYED_CACHE_HH_
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+template<class T>
+class MeshKeyedCache {
+ public:
+  MeshKeyedCache() : prune_at_(MIN_PRUNE) {}
+
+  // Instance for a live mesh, constructed as T(mesh) on first request.
+  Teuchos::RCP<T> Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = cache_[mesh.get()];
+    if (entry.value == Teuchos::null || !entry.mesh.is_valid_ptr()) {
+      entry.mesh = mesh.create_weak();
+      entry.value = Teuchos::rcp(new T(mesh));
+      if (cache_.size() >= prune_at_) Prune_();
+    }
+    return entry.value;
+  }
+
+  // Instance for a live mesh, or null if none has been requested.
+  Teuchos::RCP<T> Find(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    typename std::map<const AmanziMesh::Mesh*, Entry>::iterator entry =
+        cache_.find(mesh.get());
+    if (entry == cache_.end() || !entry->second.mesh.is_valid_ptr()) {
+      return Teuchos::null;
+    }
+    return entry->second.value;
+  }
+
+ private:
+  // Drop entries of freed meshes.  Pruning when the cache has doubled keeps
+  // the cost amortized constant per entry.
+  void Prune_() {
+    typename std::map<const AmanziMesh::Mesh*, Entry>::iterator entry = cache_.begin();
+    while (entry != cache_.end()) {
+      if (entry->second.mesh.is_valid_ptr()) {
+        ++entry;
+      } else {
+        cache_.erase(entry++);
+      }
+    }
+    prune_at_ = std::max<std::size_t>(MIN_PRUNE, 2*cache_.size());
+  }
+
+ private:
+  static const std::size_t MIN_PRUNE = 64;
+
+  struct Entry {
+    Teuchos::RCP<const AmanziMesh::Mesh> mesh;  // weak
+    Teuchos::RCP<T> value;
+  };
+
+  std::mutex mutex_;
+  std::map<const AmanziMesh::Mesh*, Entry> cache_;
+  std::size_t prune_at_;
+};
+
+} // namespace
+} // namespace
+
+#endif
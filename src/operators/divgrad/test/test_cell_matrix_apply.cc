@@ -0,0 +1,138 @@
+#include <cmath>
+#include <vector>
+
+#include "UnitTest++.h"
+
+#include "CellMatrixApply.hh"
+
+using namespace Amanzi;
+
+// The fused residual of MatrixMFD::ComputeNegativeResidual(), A x - rhs in
+// one pass over the cells, against Apply() followed by Update(-1, rhs), on
+// chains of hexes, of prisms, and of mixed cells.  Consecutive cells share
+// a face, so faces receive contributions from two cells.
+struct cells {
+  // connectivity, as MeshConnectivity provides it
+  std::vector<int> face_offsets;
+  std::vector<int> faces;
+  int nfaces;
+
+  int cell_num_faces(int c) const { return face_offsets[c+1] - face_offsets[c]; }
+  const int* cell_faces(int c) const { return &faces[face_offsets[c]]; }
+  int ncells() const { return face_offsets.size() - 1; }
+
+  // packed local matrices, as in MatrixMFD
+  std::vector<int> Aff_offsets;
+  std::vector<double> Aff, Afc, Acf, Acc;
+
+  // vectors
+  std::vector<double> xf, xc, rhs_f, rhs_c;
+
+  unsigned int seed;
+
+  cells() : nfaces(0), seed(12345) {}
+
+  // deterministic values in [-1, 1)
+  double next() {
+    seed = 1103515245u * seed + 12345u;
+    return ((seed >> 8) & 0xffff) / 32768. - 1.;
+  }
+
+  // cells with the given number of faces, each sharing its first face with
+  // the previous cell
+  void build(const std::vector<int>& cell_nfaces) {
+    face_offsets.assign(1, 0);
+    faces.clear();
+    nfaces = 1;
+    for (int c=0; c!=cell_nfaces.size(); ++c) {
+      faces.push_back(nfaces - 1);
+      for (int n=1; n!=cell_nfaces[c]; ++n) faces.push_back(nfaces++);
+      face_offsets.push_back(faces.size());
+    }
+
+    Aff_offsets.assign(1, 0);
+    Aff.clear(); Afc.clear(); Acf.clear(); Acc.clear();
+    for (int c=0; c!=ncells(); ++c) {
+      int nf = cell_num_faces(c);
+      for (int k=0; k!=nf*nf; ++k) Aff.push_back(next());
+      for (int k=0; k!=nf; ++k) Afc.push_back(next());
+      for (int k=0; k!=nf; ++k) Acf.push_back(next());
+      Acc.push_back(2. + next());
+      Aff_offsets.push_back(Aff.size());
+    }
+
+    xf.resize(nfaces); rhs_f.resize(nfaces);
+    xc.resize(ncells()); rhs_c.resize(ncells());
+    for (int f=0; f!=nfaces; ++f) { xf[f] = next(); rhs_f[f] = next(); }
+    for (int c=0; c!=ncells(); ++c) { xc[c] = next(); rhs_c[c] = next(); }
+  }
+
+  void apply(bool subtract_rhs, std::vector<double>& yf, std::vector<double>& yc) {
+    yf.assign(nfaces, 0.);
+    yc.assign(ncells(), 0.);
+    Operators::ApplyCellMatrices(*this, ncells(), &Aff[0], &Aff_offsets[0],
+            &Afc[0], &Acf[0], &face_offsets[0], &Acc[0], &xf[0], &xc[0],
+            subtract_rhs ? &rhs_c[0] : NULL, &yf[0], &yc[0]);
+  }
+
+  // A x with plain loops over each cell's local matrix
+  void reference(std::vector<double>& yf, std::vector<double>& yc) {
+    yf.assign(nfaces, 0.);
+    yc.assign(ncells(), 0.);
+    for (int c=0; c!=ncells(); ++c) {
+      int nf = cell_num_faces(c);
+      const int* fc = cell_faces(c);
+      const double* Aff_c = &Aff[Aff_offsets[c]];
+      yc[c] = Acc[c] * xc[c];
+      for (int n=0; n!=nf; ++n) {
+        yc[c] += Acf[face_offsets[c] + n] * xf[fc[n]];
+        yf[fc[n]] += Afc[face_offsets[c] + n] * xc[c];
+        for (int m=0; m!=nf; ++m) yf[fc[n]] += Aff_c[n + m*nf] * xf[fc[m]];
+      }
+    }
+  }
+
+  void checkResidual(const std::vector<int>& cell_nfaces) {
+    build(cell_nfaces);
+
+    // Apply() matches the local matrices
+    std::vector<double> yf, yc, yf_ref, yc_ref;
+    apply(false, yf, yc);
+    reference(yf_ref, yc_ref);
+    for (int f=0; f!=nfaces; ++f) CHECK_CLOSE(yf_ref[f], yf[f], 1.e-12);
+    for (int c=0; c!=ncells(); ++c) CHECK_CLOSE(yc_ref[c], yc[c], 1.e-12);
+
+    // Apply() followed by Update(-1, rhs)
+    for (int f=0; f!=nfaces; ++f) yf[f] -= rhs_f[f];
+    for (int c=0; c!=ncells(); ++c) yc[c] -= rhs_c[c];
+
+    // fused, with the face rhs subtracted after the gather as in MatrixMFD
+    std::vector<double> rf, rc;
+    apply(true, rf, rc);
+    for (int f=0; f!=nfaces; ++f) rf[f] -= rhs_f[f];
+
+    for (int f=0; f!=nfaces; ++f) CHECK_CLOSE(yf[f], rf[f], 1.e-12);
+    for (int c=0; c!=ncells(); ++c) CHECK_CLOSE(yc[c], rc[c], 1.e-12);
+  }
+};
+
+
+TEST_FIXTURE(cells, FusedResidualHex) {
+  checkResidual(std::vector<int>(20, 6));
+}
+
+
+TEST_FIXTURE(cells, FusedResidualPrism) {
+  checkResidual(std::vector<int>(20, 5));
+}
+
+
+// tetrahedra and general polyhedra take the run-time sized kernel
+TEST_FIXTURE(cells, FusedResidualMixed) {
+  std::vector<int> cell_nfaces;
+  for (int c=0; c!=20; ++c) {
+    const int pattern[] = { 6, 5, 4, 6, 8, 5, 14 };
+    cell_nfaces.push_back(pattern[c % 7]);
+  }
+  checkResidual(cell_nfaces);
+}
@@ -0,0 +1,153 @@
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "MeshFactory.hh"
+#include "Mesh.hh"
+#include "State.hh"
+#include "Checkpoint.hh"
+
+#include "ColumnGeometry.hh"
+
+using namespace Amanzi;
+
+struct columns {
+  Epetra_MpiComm *comm;
+  Teuchos::RCP<AmanziGeometry::GeometricModel> gm;
+  Teuchos::RCP<AmanziMesh::Mesh> mesh;
+  Teuchos::RCP<Teuchos::ParameterList> plist;
+
+  columns() {
+    comm = new Epetra_MpiComm(MPI_COMM_WORLD);
+
+    plist = Teuchos::rcp(new Teuchos::ParameterList());
+    Teuchos::updateParametersFromXmlFile("test/test-mesh.xml",plist.ptr());
+
+    AmanziMesh::MeshFactory factory(comm);
+    AmanziMesh::FrameworkPreference prefs(factory.preference());
+    prefs.clear();
+    prefs.push_back(AmanziMesh::MSTK);
+    factory.preference(prefs);
+
+    // 3x3x3 cells on the unit cube, in columns of three cells
+    Teuchos::ParameterList& regionlist = plist->sublist("Regions");
+    gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regionlist, comm));
+    mesh = factory.create(plist->sublist("Mesh").sublist("Generate Mesh"), &*gm);
+    mesh->build_columns();
+  }
+
+  ~columns() { delete comm; }
+
+  // squash the mesh by a factor of s toward z = 0
+  void squash(double s) {
+    int nnodes = mesh->num_entities(AmanziMesh::NODE, AmanziMesh::Parallel_type::ALL);
+    AmanziMesh::Entity_ID_List nodeids;
+    AmanziGeometry::Point_List newpos, finpos;
+    AmanziGeometry::Point coords(3);
+    for (int n=0; n!=nnodes; ++n) {
+      mesh->node_get_coordinates(n, &coords);
+      coords[2] *= s;
+      nodeids.push_back(n);
+      newpos.push_back(coords);
+    }
+    mesh->deform(nodeids, newpos, true, &finpos);
+  }
+
+  void checkGeometry(const Operators::ColumnGeometry& geom, double height) {
+    CHECK_EQUAL(mesh->num_columns(false), geom.num_columns());
+    for (int i=0; i!=geom.num_columns(); ++i) {
+      CHECK_EQUAL(3, geom.num_cells(i));
+      CHECK_CLOSE(height, geom.top_face_centroid(i)[2], 1.e-12);
+      for (int j=0; j!=geom.num_cells(i); ++j) {
+        CHECK_EQUAL(mesh->cells_of_column(i)[j], geom.cells(i)[j]);
+        CHECK_CLOSE(height / 3., geom.dz(i)[j], 1.e-12);
+        CHECK_CLOSE((j + 0.5) * height / 3., geom.depth(i)[j], 1.e-12);
+      }
+    }
+  }
+};
+
+
+TEST_FIXTURE(columns, ColumnGeometryShared) {
+  Teuchos::RCP<const Operators::ColumnGeometry> geom =
+      Operators::ColumnGeometry::Get(mesh);
+  CHECK(geom.get() == Operators::ColumnGeometry::Get(mesh).get());
+  CHECK(geom->Mesh().get() == mesh.get());
+  checkGeometry(*geom, 1.0);
+}
+
+
+// MeshDeformed() updates the shared instance in place.
+TEST_FIXTURE(columns, ColumnGeometryMeshDeformed) {
+  Teuchos::RCP<const Operators::ColumnGeometry> geom =
+      Operators::ColumnGeometry::Get(mesh);
+  checkGeometry(*geom, 1.0);
+
+  squash(0.5);
+  Operators::ColumnGeometry::MeshDeformed(mesh);
+  CHECK(geom.get() == Operators::ColumnGeometry::Get(mesh).get());
+  checkGeometry(*geom, 0.5);
+}
+
+
+// On restart, the coordinator deforms "column*" meshes to their checkpointed
+// coordinates after PKs have cached the geometry, and then refreshes it.
+TEST_FIXTURE(columns, ColumnGeometryRestartDeformed) {
+  Teuchos::RCP<const Operators::ColumnGeometry> geom =
+      Operators::ColumnGeometry::Get(mesh);
+
+  Teuchos::ParameterList state_plist;
+  Teuchos::RCP<State> S = Teuchos::rcp(new State(state_plist));
+  S->RegisterMesh("column_0", mesh, true);
+  S->RequireField("column_0-vertex_coordinate", "coordinator")->SetMesh(mesh)
+      ->SetGhosted()->AddComponent("node", AmanziMesh::NODE, 3);
+  S->Setup();
+
+  // checkpoint the coordinates of the mesh squashed by half
+  Epetra_MultiVector& vc = *S->GetFieldData("column_0-vertex_coordinate", "coordinator")
+      ->ViewComponent("node", true);
+  AmanziGeometry::Point coords(3);
+  for (int n=0; n!=vc.MyLength(); ++n) {
+    mesh->node_get_coordinates(n, &coords);
+    vc[0][n] = coords[0];
+    vc[1][n] = coords[1];
+    vc[2][n] = 0.5 * coords[2];
+  }
+  S->GetField("column_0-vertex_coordinate", "coordinator")->set_initialized();
+
+  Amanzi::Comm_ptr_type comm_ptr = Teuchos::rcpFromRef(*comm);
+  Teuchos::ParameterList chkp_plist;
+  chkp_plist.set<std::string>("file name base", "restart_column");
+  Checkpoint chkp(chkp_plist, comm_ptr);
+  WriteCheckpoint(Teuchos::ptr(&chkp), S.ptr(), 0.);
+
+  // restart into a fresh copy of the coordinates
+  vc.PutScalar(0.);
+  ReadCheckpoint(comm_ptr, S.ptr(), "restart_column00000.h5");
+  DeformCheckpointMesh(S.ptr(), "column_0");
+  Operators::ColumnGeometry::MeshDeformed(mesh);
+
+  CHECK(geom.get() == Operators::ColumnGeometry::Get(mesh).get());
+  checkGeometry(*geom, 0.5);
+}
+
+
+// The cache does not keep the mesh alive, and a new mesh gets a new
+// instance.
+TEST_FIXTURE(columns, ColumnGeometryDoesNotOwnMesh) {
+  Teuchos::RCP<const Operators::ColumnGeometry> geom =
+      Operators::ColumnGeometry::Get(mesh);
+  Teuchos::RCP<const AmanziMesh::Mesh> weak_mesh = mesh.create_weak();
+
+  mesh = Teuchos::null;
+  CHECK(!weak_mesh.is_valid_ptr());
+
+  columns other;
+  other.squash(0.5);
+  Teuchos::RCP<const Operators::ColumnGeometry> other_geom =
+      Operators::ColumnGeometry::Get(other.mesh);
+  CHECK(other_geom->Mesh().get() == other.mesh.get());
+  other.checkGeometry(*other_geom, 0.5);
+}
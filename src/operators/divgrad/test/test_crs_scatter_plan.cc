@@ -0,0 +1,179 @@
+#include <cmath>
+#include <vector>
+
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Epetra_FECrsGraph.h"
+#include "Epetra_FECrsMatrix.h"
+
+#include "MeshFactory.hh"
+#include "Mesh.hh"
+
+#include "MeshConnectivity.hh"
+#include "CrsScatterPlan.hh"
+
+using namespace Amanzi;
+
+// Assembly of element matrices through a CrsScatterPlan against
+// Epetra_FECrsMatrix::SumIntoGlobalValues, with the element patterns the
+// div-grad operators use: the face-face block of each cell, and the
+// cell-cell block of each face.  Run on 2 or more ranks, so that
+// off-process entries are exchanged.
+struct plan {
+  Epetra_MpiComm *comm;
+  Teuchos::RCP<AmanziGeometry::GeometricModel> gm;
+  Teuchos::RCP<AmanziMesh::Mesh> mesh;
+  Teuchos::RCP<const Operators::MeshConnectivity> conn;
+  Teuchos::RCP<Teuchos::ParameterList> plist;
+
+  // elements, as global ids of their rows (= columns)
+  std::vector<int> elem_offsets;
+  std::vector<int> elem_gids;
+
+  plan() {
+    comm = new Epetra_MpiComm(MPI_COMM_WORLD);
+
+    plist = Teuchos::rcp(new Teuchos::ParameterList());
+    Teuchos::updateParametersFromXmlFile("test/test-mesh.xml",plist.ptr());
+
+    AmanziMesh::MeshFactory factory(comm);
+    AmanziMesh::FrameworkPreference prefs(factory.preference());
+    prefs.clear();
+    prefs.push_back(AmanziMesh::MSTK);
+    factory.preference(prefs);
+
+    Teuchos::ParameterList& regionlist = plist->sublist("Regions");
+    gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regionlist, comm));
+    mesh = factory.create(plist->sublist("Mesh").sublist("Generate Mesh"), &*gm);
+    conn = Operators::MeshConnectivity::Get(mesh);
+  }
+
+  ~plan() { delete comm; }
+
+  // faces of each owned cell, as in MatrixMFD's Aff and Sff
+  void cellFaceElements() {
+    const Epetra_Map& fmap_wghost = mesh->face_map(true);
+    elem_offsets.assign(1, 0);
+    elem_gids.clear();
+    for (int c=0; c!=conn->num_cells_owned(); ++c) {
+      const int* faces = conn->cell_faces(c);
+      for (int n=0; n!=conn->cell_num_faces(c); ++n) {
+        elem_gids.push_back(fmap_wghost.GID(faces[n]));
+      }
+      elem_offsets.push_back(elem_gids.size());
+    }
+  }
+
+  // cells of each owned face, as in Matrix_TPFA's Spp
+  void faceCellElements() {
+    const Epetra_Map& cmap_wghost = mesh->cell_map(true);
+    elem_offsets.assign(1, 0);
+    elem_gids.clear();
+    for (int f=0; f!=conn->num_faces_owned(); ++f) {
+      const int* cells = conn->face_cells(f);
+      for (int n=0; n!=conn->face_num_cells(f); ++n) {
+        elem_gids.push_back(cmap_wghost.GID(cells[n]));
+      }
+      elem_offsets.push_back(elem_gids.size());
+    }
+  }
+
+  int numElements() const { return elem_offsets.size() - 1; }
+  int elementSize(int e) const { return elem_offsets[e+1] - elem_offsets[e]; }
+  const int* elementGIDs(int e) const { return &elem_gids[elem_offsets[e]]; }
+
+  Teuchos::RCP<Epetra_FECrsMatrix> createMatrix(const Epetra_Map& map) {
+    Epetra_FECrsGraph graph(Copy, map, 8);
+    for (int e=0; e!=numElements(); ++e) {
+      graph.InsertGlobalIndices(elementSize(e), elementGIDs(e),
+                                elementSize(e), elementGIDs(e));
+    }
+    int ierr = graph.GlobalAssemble();
+    CHECK(!ierr);
+
+    Teuchos::RCP<Epetra_FECrsMatrix> A = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, graph));
+    A->GlobalAssemble();
+    return A;
+  }
+
+  // nonsymmetric values, distinct per element and entry, column-major
+  void elementValues(int e, double scale, std::vector<double>& values) {
+    int n = elementSize(e);
+    values.resize(n*n);
+    for (int j=0; j!=n; ++j) {
+      for (int i=0; i!=n; ++i) {
+        values[i + j*n] = scale * (elementGIDs(e)[i] + 1. + 0.1*i + 0.01*j);
+      }
+    }
+  }
+
+  void assemble(Operators::CrsScatterPlan& planned, Epetra_FECrsMatrix& ref, double scale) {
+    std::vector<double> values;
+    planned.PutScalar(0.);
+    ref.PutScalar(0.);
+    for (int e=0; e!=numElements(); ++e) {
+      elementValues(e, scale, values);
+      planned.SumIntoElement(e, &values[0]);
+      ref.SumIntoGlobalValues(elementSize(e), elementGIDs(e), &values[0]);
+    }
+    planned.GlobalAssemble();
+    ref.GlobalAssemble();
+  }
+
+  // Compare owned rows entry by entry.  Contributions may be summed in a
+  // different order, so values agree to round-off.
+  void checkSame(const Epetra_CrsMatrix& planned, const Epetra_CrsMatrix& ref) {
+    CHECK(planned.RowMap().SameAs(ref.RowMap()));
+    CHECK_EQUAL(ref.NumMyRows(), planned.NumMyRows());
+    for (int i=0; i!=ref.NumMyRows(); ++i) {
+      int n, n_ref;
+      double *vals, *vals_ref;
+      int *inds, *inds_ref;
+      planned.ExtractMyRowView(i, n, vals, inds);
+      ref.ExtractMyRowView(i, n_ref, vals_ref, inds_ref);
+
+      CHECK_EQUAL(n_ref, n);
+      if (n != n_ref) continue;
+      for (int k=0; k!=n; ++k) {
+        CHECK_EQUAL(ref.GCID(inds_ref[k]), planned.GCID(inds[k]));
+        CHECK_CLOSE(vals_ref[k], vals[k], 1.e-12 * (1. + std::abs(vals_ref[k])));
+      }
+    }
+  }
+
+  void checkPattern(const Epetra_Map& map) {
+    Teuchos::RCP<Epetra_FECrsMatrix> A = createMatrix(map);
+    Teuchos::RCP<Epetra_FECrsMatrix> A_ref = createMatrix(map);
+    CHECK(Operators::CrsScatterPlan::Supported(*A));
+
+    Operators::CrsScatterPlan A_plan(*A);
+    for (int e=0; e!=numElements(); ++e) {
+      CHECK_EQUAL(e, A_plan.AddElement(elementSize(e), elementGIDs(e),
+              elementSize(e), elementGIDs(e)));
+    }
+    A_plan.Finalize();
+    CHECK(A_plan.matrix() == A.get());
+
+    assemble(A_plan, *A_ref, 1.);
+    checkSame(*A, *A_ref);
+
+    // reassembly reuses the plan, which must start from zero
+    assemble(A_plan, *A_ref, -2.5);
+    checkSame(*A, *A_ref);
+  }
+};
+
+
+TEST_FIXTURE(plan, PlanCellFaceElements) {
+  cellFaceElements();
+  checkPattern(mesh->face_map(false));
+}
+
+
+TEST_FIXTURE(plan, PlanFaceCellElements) {
+  faceCellElements();
+  checkPattern(mesh->cell_map(false));
+}
@@ -1,8 +1,11 @@
+#include <algorithm>
+
 #include "UnitTest++.h"
 
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_XMLParameterListHelpers.hpp"
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_Time.hpp"
 #include "EpetraExt_RowMatrixOut.h"
 #include "EpetraExt_CrsMatrixIn.h"
 #include "Epetra_SerialComm.h"
@@ -29,6 +32,7 @@ struct mfd {
   Teuchos::RCP<CompositeVector> bA,bB;
   Teuchos::RCP<TreeVector> x,b;
   Teuchos::RCP<TreeVector> offdiag;
+  Teuchos::ParameterList op_plist;
 
   std::vector<Operators::MatrixBC> bc_markers;
   std::vector<double> bc_values;
@@ -79,6 +83,7 @@ struct mfd {
     plist.sublist("consistent face solver").sublist("preconditioner")
       .set("preconditioner type", "block ilu");
 
+    op_plist = plist;
     A = Teuchos::rcp(new Operators::MatrixMFD(plist, mesh));
     B = Teuchos::rcp(new Operators::MatrixMFD(plist, mesh));
     C = Teuchos::rcp(new Operators::MatrixMFD_Coupled(plist, mesh));
@@ -469,3 +474,86 @@ TEST_FIXTURE(mfd, AssembleRandomTwoPointNormed) {
 }
 
 
+// Compares the BSR Schur complement to the VBR one, and times assembly of
+// each.  Both are applied to the same vector, as their maps differ in type
+// but share the interleaved layout.
+TEST_FIXTURE(mfd, SchurBSRvsVBR) {
+  CompositeVectorSpace kr_sp;
+  kr_sp.SetMesh(mesh)->SetGhosted()->SetComponent("face",AmanziMesh::FACE,1);
+  Teuchos::RCP<CompositeVector> kr =
+    Teuchos::rcp(new CompositeVector(kr_sp));
+  kr->PutScalar(0.5);
+
+  setDirichletOne();
+  createMFD("two point flux approximation", "block ilu", kr.ptr());
+
+  // nonzero cell coupling, and the energy block as the advective block
+  std::srand(0);
+  Epetra_MultiVector& Ccc = *offdiag->SubVector(0)->Data()->ViewComponent("cell",false);
+  Epetra_MultiVector& Dcc = *offdiag->SubVector(1)->Data()->ViewComponent("cell",false);
+  for (int c=0; c!=Ccc.MyLength(); ++c) {
+    Ccc[0][c] = (std::rand() % 1000) / 10000.0;
+    Dcc[0][c] = (std::rand() % 1000) / 10000.0;
+  }
+
+  // without dumping, which would dominate the timings
+  Teuchos::ParameterList vbr_plist(op_plist);
+  vbr_plist.set("dump Schur complement", false);
+  Teuchos::RCP<Operators::MatrixMFD_Coupled> C_vbr =
+    Teuchos::rcp(new Operators::MatrixMFD_Coupled(vbr_plist, mesh));
+  C_vbr->SetSubBlocks(A,B);
+  C_vbr->SymbolicAssembleGlobalMatrices();
+  C_vbr->SetAdvectiveBlock(B);
+
+  Teuchos::ParameterList bsr_plist(vbr_plist);
+  bsr_plist.set("Schur complement format", "BSR");
+  Teuchos::RCP<Operators::MatrixMFD_Coupled> C_bsr =
+    Teuchos::rcp(new Operators::MatrixMFD_Coupled(bsr_plist, mesh));
+  C_bsr->SetSubBlocks(A,B);
+  C_bsr->SymbolicAssembleGlobalMatrices();
+  C_bsr->SetAdvectiveBlock(B);
+
+  Teuchos::RCP<const Epetra_MultiVector> Ccc_ptr = offdiag->SubVector(0)->Data()->ViewComponent("cell",false);
+  Teuchos::RCP<const Epetra_MultiVector> Dcc_ptr = offdiag->SubVector(1)->Data()->ViewComponent("cell",false);
+
+  // timed assemblies
+  int nrepeats = 20;
+  Teuchos::Time vbr_timer("VBR Schur assembly");
+  Teuchos::Time bsr_timer("BSR Schur assembly");
+  Teuchos::RCP<const Epetra_FEVbrMatrix> S_vbr;
+  Teuchos::RCP<const Epetra_FECrsMatrix> S_bsr;
+  for (int i=0; i!=nrepeats; ++i) {
+    C_vbr->SetOffDiagonals(Ccc_ptr, Dcc_ptr, 1.0);
+    vbr_timer.start();
+    S_vbr = C_vbr->Schur();
+    vbr_timer.stop();
+
+    C_bsr->SetOffDiagonals(Ccc_ptr, Dcc_ptr, 1.0);
+    bsr_timer.start();
+    S_bsr = C_bsr->SchurBSR();
+    bsr_timer.stop();
+  }
+  std::cout << "Schur assembly, " << nrepeats << " times: VBR " << vbr_timer.totalElapsedTime()
+            << " s, BSR " << bsr_timer.totalElapsedTime() << " s" << std::endl;
+
+  // same operator
+  Epetra_Vector x_vbr(S_vbr->OperatorDomainMap());
+  Epetra_Vector y_vbr(S_vbr->OperatorRangeMap());
+  Epetra_Vector x_bsr(S_bsr->OperatorDomainMap());
+  Epetra_Vector y_bsr(S_bsr->OperatorRangeMap());
+  CHECK_EQUAL(x_vbr.MyLength(), x_bsr.MyLength());
+  for (int i=0; i!=x_vbr.MyLength(); ++i) {
+    x_vbr[i] = x_bsr[i] = (std::rand() % 1000) / 1000.0;
+  }
+  S_vbr->Apply(x_vbr, y_vbr);
+  S_bsr->Apply(x_bsr, y_bsr);
+
+  double diff = 0.;
+  for (int i=0; i!=y_vbr.MyLength(); ++i) {
+    diff = std::max(diff, std::abs(y_vbr[i] - y_bsr[i]));
+  }
+  double global_diff = 0.;
+  comm->MaxAll(&diff, &global_diff, 1);
+  std::cout << "max |S_vbr x - S_bsr x| = " << global_diff << std::endl;
+  CHECK_CLOSE(0., global_diff, 1.e-10);
+}
@@ -0,0 +1,147 @@
+#include <cmath>
+
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "MeshFactory.hh"
+#include "Mesh.hh"
+
+#include "MatrixMFD.hh"
+#include "Matrix_TPFA.hh"
+
+using namespace Amanzi;
+
+// Assembly through a CrsScatterPlan ("precomputed assembly") against the
+// SumIntoGlobalValues assembly.  Run on 2 or more ranks, so that the plans'
+// off-process entries are exchanged.
+struct plan {
+  Epetra_MpiComm *comm;
+  Teuchos::RCP<AmanziGeometry::GeometricModel> gm;
+  Teuchos::RCP<AmanziMesh::Mesh> mesh;
+  Teuchos::RCP<Teuchos::ParameterList> plist;
+  Teuchos::RCP<CompositeVector> kr;
+  std::vector<Operators::MatrixBC> bc_markers;
+  std::vector<double> bc_values;
+
+  plan() {
+    comm = new Epetra_MpiComm(MPI_COMM_WORLD);
+
+    plist = Teuchos::rcp(new Teuchos::ParameterList());
+    Teuchos::updateParametersFromXmlFile("test/test-mesh.xml",plist.ptr());
+
+    AmanziMesh::MeshFactory factory(comm);
+    AmanziMesh::FrameworkPreference prefs(factory.preference());
+    prefs.clear();
+    prefs.push_back(AmanziMesh::MSTK);
+    factory.preference(prefs);
+
+    Teuchos::ParameterList& regionlist = plist->sublist("Regions");
+    gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regionlist, comm));
+    mesh = factory.create(plist->sublist("Mesh").sublist("Generate Mesh"), &*gm);
+
+    // Dirichlet on the bottom, so that boundary rows are assembled too
+    int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+    bc_markers.resize(nfaces, Operators::MATRIX_BC_NULL);
+    bc_values.resize(nfaces, 0.);
+    AmanziMesh::Entity_ID_List bottom;
+    mesh->get_set_entities("bottom side", AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL, &bottom);
+    for (int f=0; f!=bottom.size(); ++f) {
+      bc_markers[bottom[f]] = Operators::MATRIX_BC_DIRICHLET;
+      bc_values[bottom[f]] = 1.;
+    }
+
+    // a nonuniform relative permeability
+    CompositeVectorSpace kr_sp;
+    kr_sp.SetMesh(mesh)->SetGhosted()->SetComponent("face",AmanziMesh::FACE,1);
+    kr = Teuchos::rcp(new CompositeVector(kr_sp));
+    Epetra_MultiVector& kr_f = *kr->ViewComponent("face",true);
+    for (int f=0; f!=kr_f.MyLength(); ++f) {
+      AmanziGeometry::Point fc = mesh->face_centroid(f);
+      kr_f[0][f] = std::sqrt(std::abs(fc[0]) + std::abs(fc[1]) + std::abs(fc[2]));
+    }
+  }
+
+  ~plan() { delete comm; }
+
+  Teuchos::RCP<Operators::MatrixMFD> createMatrix(std::string method, bool precomputed) {
+    Teuchos::ParameterList mplist;
+    mplist.set("MFD method", method);
+    mplist.set("precomputed assembly", precomputed);
+
+    Teuchos::RCP<Operators::MatrixMFD> A;
+    if (method == "two point flux approximation") {
+      mplist.set("TPFA", false);
+      mplist.set("FV", true);
+      A = Teuchos::rcp(new Operators::Matrix_TPFA(mplist, mesh));
+    } else {
+      A = Teuchos::rcp(new Operators::MatrixMFD(mplist, mesh));
+    }
+
+    A->set_symmetric(false);
+    A->SymbolicAssembleGlobalMatrices();
+    A->CreateMFDmassMatrices(Teuchos::null);
+    A->CreateMFDstiffnessMatrices(kr.ptr());
+    A->CreateMFDrhsVectors();
+    A->ApplyBoundaryConditions(bc_markers, bc_values);
+    return A;
+  }
+
+  // Compare owned rows entry by entry.  Contributions may be summed in a
+  // different order, so values agree to round-off.
+  void checkSame(const Epetra_CrsMatrix& planned, const Epetra_CrsMatrix& ref) {
+    CHECK(planned.RowMap().SameAs(ref.RowMap()));
+    CHECK_EQUAL(ref.NumMyRows(), planned.NumMyRows());
+    for (int i=0; i!=ref.NumMyRows(); ++i) {
+      int n, n_ref;
+      double *vals, *vals_ref;
+      int *inds, *inds_ref;
+      planned.ExtractMyRowView(i, n, vals, inds);
+      ref.ExtractMyRowView(i, n_ref, vals_ref, inds_ref);
+
+      CHECK_EQUAL(n_ref, n);
+      if (n != n_ref) continue;
+      for (int k=0; k!=n; ++k) {
+        CHECK_EQUAL(ref.GCID(inds_ref[k]), planned.GCID(inds[k]));
+        CHECK_CLOSE(vals_ref[k], vals[k], 1.e-12 * (1. + std::abs(vals_ref[k])));
+      }
+    }
+  }
+};
+
+
+TEST_FIXTURE(plan, PlanAssemblyMFD) {
+  Teuchos::RCP<Operators::MatrixMFD> A = createMatrix("mfd", true);
+  Teuchos::RCP<Operators::MatrixMFD> A_ref = createMatrix("mfd", false);
+
+  checkSame(*A->Aff(), *A_ref->Aff());
+  checkSame(*A->Schur(), *A_ref->Schur());
+}
+
+
+// Reassembly reuses the plans, which must start from zero.
+TEST_FIXTURE(plan, PlanReassemblyMFD) {
+  Teuchos::RCP<Operators::MatrixMFD> A = createMatrix("mfd", true);
+  Teuchos::RCP<Operators::MatrixMFD> A_ref = createMatrix("mfd", false);
+  A->Aff();
+  A->Schur();
+
+  kr->Scale(2.);
+  A->CreateMFDstiffnessMatrices(kr.ptr());
+  A->ApplyBoundaryConditions(bc_markers, bc_values);
+  A_ref->CreateMFDstiffnessMatrices(kr.ptr());
+  A_ref->ApplyBoundaryConditions(bc_markers, bc_values);
+
+  checkSame(*A->Aff(), *A_ref->Aff());
+  checkSame(*A->Schur(), *A_ref->Schur());
+}
+
+
+TEST_FIXTURE(plan, PlanAssemblyTPFA) {
+  Teuchos::RCP<Operators::MatrixMFD> A = createMatrix("two point flux approximation", true);
+  Teuchos::RCP<Operators::MatrixMFD> A_ref = createMatrix("two point flux approximation", false);
+
+  checkSame(*A->Schur(), *A_ref->Schur());
+}
@@ -746,3 +746,62 @@ TEST_FIXTURE(mfd, AssembleRandomTPFANormed) {
   }
   
 }
+
+
+// The local rhs must not touch the TPFA local matrices, which are stored by
+// face.  Creating the stiffness matrices before or after the rhs must give
+// the same operator.
+TEST_FIXTURE(mfd, StiffnessThenRhsTwoPointKr) {
+  CompositeVectorSpace kr_sp;
+  kr_sp.SetMesh(mesh)->SetGhosted()->SetComponent("face",AmanziMesh::FACE,1);
+
+  Teuchos::RCP<CompositeVector> kr = 
+    Teuchos::rcp(new CompositeVector(kr_sp));
+  Epetra_MultiVector& kr_f = *kr->ViewComponent("face",false);
+  for (int f=0; f!=kr_f.MyLength(); ++f) {
+    AmanziGeometry::Point fc = mesh->face_centroid(f);
+    kr_f[0][f] = std::sqrt(std::abs(fc[0]) + std::abs(fc[1]) + std::abs(fc[2]));
+  }
+
+  setDirichletLinear();
+
+  // stiffness, then rhs
+  createMFD("two point flux approximation", kr.ptr());
+  int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  CHECK_EQUAL(nfaces, A->Aff_cells().size());
+  CHECK_EQUAL(nfaces, A->Afc_cells().size());
+
+  // rhs, then stiffness
+  Teuchos::ParameterList plist;
+  plist.set("MFD method", "two point flux approximation");
+  plist.set("TPFA", false);
+  plist.set("FV", true);
+  plist.sublist("preconditioner").set("preconditioner type", "ml");
+  Teuchos::RCP<Operators::MatrixMFD> B =
+    Teuchos::rcp(new Operators::Matrix_TPFA(plist, mesh));
+  B->set_symmetric(false);
+  B->SymbolicAssembleGlobalMatrices();
+  B->CreateMFDmassMatrices(Teuchos::null);
+  B->CreateMFDrhsVectors();
+  B->CreateMFDstiffnessMatrices(kr.ptr());
+  B->ApplyBoundaryConditions(bc_markers, bc_values);
+
+  for (int f=0; f!=nfaces; ++f) {
+    CHECK_EQUAL(B->Aff_cells()[f](0,0), A->Aff_cells()[f](0,0));
+    CHECK_EQUAL(B->Afc_cells()[f](0), A->Afc_cells()[f](0));
+  }
+
+  // the same residual, which is zero for the linear solution
+  setSolution(x.ptr());
+  CompositeVector rB(*b);
+  A->ComputeNegativeResidual(*x, b.ptr());
+  B->ComputeNegativeResidual(*x, Teuchos::ptr(&rB));
+
+  double norm = 0.;
+  b->NormInf(&norm);
+  CHECK_CLOSE(0., norm, 1.e-8);
+
+  rB.Update(-1., *b, 1.);
+  rB.NormInf(&norm);
+  CHECK_CLOSE(0., norm, 1.e-12);
+}
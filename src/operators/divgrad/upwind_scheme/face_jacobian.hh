@@ -0,0 +1,67 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Packed storage of the per-face Jacobian blocks of a TPFA operator with
+// respect to cell values.
+//
+// Each owned face has a dense block over its cells: 2x2 for an interior
+// face, 1x1 for a boundary face.  Blocks are stored with a fixed stride of
+// 4 doubles, column-major with leading dimension 2, so that values(f) can
+// be passed directly to Epetra_FECrsMatrix::SumIntoGlobalValues() with the
+// face's cells.  A boundary face uses only its first entry.
+//
+// The buffer is sized once and reused: Resize() keeps its allocation when
+// the number of faces does not change.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_FACE_JACOBIAN_HH_
+#define AMANZI_OPERATORS_FACE_JACOBIAN_HH_
+
+#include <vector>
+
+#include "dbc.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class FaceJacobian {
+ public:
+  static const int STRIDE = 4;
+
+  void Resize(int nfaces) {
+    values_.resize(STRIDE*nfaces);
+    num_cells_.resize(nfaces);
+  }
+
+  int size() const { return num_cells_.size(); }
+
+  // Zero the block of face f, which has mcells (1 or 2) cells.
+  void InitializeFace(int f, int mcells) {
+    AMANZI_ASSERT(mcells == 1 || mcells == 2);
+    num_cells_[f] = mcells;
+    double* v = &values_[STRIDE*f];
+    v[0] = v[1] = v[2] = v[3] = 0.;
+  }
+
+  int num_cells(int f) const { return num_cells_[f]; }
+  bool boundary(int f) const { return num_cells_[f] == 1; }
+
+  double& operator()(int f, int i, int j) { return values_[STRIDE*f + i + 2*j]; }
+  double operator()(int f, int i, int j) const { return values_[STRIDE*f + i + 2*j]; }
+
+  const double* values(int f) const { return &values_[STRIDE*f]; }
+
+ private:
+  std::vector<double> values_;
+  std::vector<char> num_cells_;
+};
+
+} // namespace
+} // namespace
+
+#endif
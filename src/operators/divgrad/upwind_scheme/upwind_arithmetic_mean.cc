@@ -85,7 +85,7 @@ UpwindArithmeticMean::UpdateDerivatives(const Teuchos::Ptr<State>& S,
                                         const CompositeVector& dconductivity,
                                         const std::vector<int>& bc_markers,
                                         const std::vector<double>& bc_values,
-                                        std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > >* Jpp_faces) const {
+                                        FaceJacobian* Jpp_faces) const {
 
   // Grab derivatives
   dconductivity.ScatterMasterToGhosted("cell");
@@ -99,7 +99,7 @@ UpwindArithmeticMean::UpdateDerivatives(const Teuchos::Ptr<State>& S,
   // Grab mesh and allocate space
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = pres->Mesh();
   unsigned int nfaces_owned = mesh->num_entities(AmanziMesh::FACE,AmanziMesh::Parallel_type::OWNED);
-  Jpp_faces->resize(nfaces_owned);
+  Jpp_faces->Resize(nfaces_owned);
 
   // workspace
   double dK_dp[2];
@@ -112,9 +112,7 @@ UpwindArithmeticMean::UpdateDerivatives(const Teuchos::Ptr<State>& S,
     int mcells = cells.size();
 
     // create the local matrix
-    Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > Jpp =
-      Teuchos::rcp(new Teuchos::SerialDenseMatrix<int, double>(mcells, mcells));
-    (*Jpp_faces)[f] = Jpp;
+    Jpp_faces->InitializeFace(f, mcells);
     
     if (mcells == 1) {
       if (bc_markers[f] == Operators::OPERATOR_BC_DIRICHLET) {
@@ -122,9 +120,9 @@ UpwindArithmeticMean::UpdateDerivatives(const Teuchos::Ptr<State>& S,
         p[1] = bc_values[f];
         double dp = p[0] - p[1];
 
-        (*Jpp)(0,0) = dp * mesh->face_area(f) * dcell_v[0][cells[0]];
+        (*Jpp_faces)(f,0,0) = dp * mesh->face_area(f) * dcell_v[0][cells[0]];
       } else {
-        (*Jpp)(0,0) = 0.;
+        (*Jpp_faces)(f,0,0) = 0.;
       }
     } else {
       p[0] = pres_v[0][cells[0]];
@@ -133,10 +131,10 @@ UpwindArithmeticMean::UpdateDerivatives(const Teuchos::Ptr<State>& S,
       dK_dp[0] = 0.5 * dcell_v[0][cells[0]];
       dK_dp[1] = 0.5 * dcell_v[0][cells[1]];
 
-      (*Jpp)(0,0) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[0];
-      (*Jpp)(0,1) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[1];
-      (*Jpp)(1,0) = -(*Jpp)(0,0);
-      (*Jpp)(1,1) = -(*Jpp)(0,1);
+      (*Jpp_faces)(f,0,0) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[0];
+      (*Jpp_faces)(f,0,1) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[1];
+      (*Jpp_faces)(f,1,0) = -(*Jpp_faces)(f,0,0);
+      (*Jpp_faces)(f,1,1) = -(*Jpp_faces)(f,0,1);
     }
   }
 }
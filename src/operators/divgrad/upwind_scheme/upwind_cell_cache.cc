@@ -0,0 +1,102 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Upwind and downwind cells of each face, kept up to date with a flux.
+// -----------------------------------------------------------------------------
+
+#include "dbc.hh"
+#include "upwind_cell_cache.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+UpwindCellCache::UpwindCellCache(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                                 ZeroFluxRule rule) :
+    mesh_(mesh),
+    conn_(MeshConnectivity::Get(mesh)),
+    rule_(rule)
+{
+  upwind_cell_ = Teuchos::rcp(new Epetra_IntVector(mesh_->face_map(true)));
+  downwind_cell_ = Teuchos::rcp(new Epetra_IntVector(mesh_->face_map(true)));
+}
+
+
+int UpwindCellCache::Update(const Epetra_MultiVector& flux) {
+  int nfaces = flux.MyLength();
+  AMANZI_ASSERT(nfaces <= upwind_cell_->MyLength());
+
+  // a value that no sign takes forces a recompute
+  if (sign_.size() != nfaces) {
+    sign_.assign(nfaces, 2);
+    upwind_cell_->PutValue(-1);
+    downwind_cell_->PutValue(-1);
+  }
+
+  int nchanged = 0;
+  for (int f=0; f!=nfaces; ++f) {
+    double q = flux[0][f];
+    signed char s = (q > 0.) - (q < 0.);
+    if (s != sign_[f]) {
+      sign_[f] = s;
+      IdentifyFace_(f, q);
+      ++nchanged;
+    }
+  }
+  return nchanged;
+}
+
+
+void UpwindCellCache::IdentifyFace_(int f, double flux) {
+  int uw = -1;
+  int dw = -1;
+
+  const int* cells = conn_->face_cells(f);
+  int mcells = conn_->face_num_cells(f);
+  for (int i=0; i!=mcells; ++i) {
+    int c = cells[i];
+
+    // orientation of the face relative to this cell
+    const int* faces = conn_->cell_faces(c);
+    int nfaces = conn_->cell_num_faces(c);
+    int dir = 0;
+    for (int n=0; n!=nfaces; ++n) {
+      if (faces[n] == f) {
+        dir = conn_->cell_face_dirs(c)[n];
+        break;
+      }
+    }
+    AMANZI_ASSERT(dir != 0);
+
+    double tmp = flux * dir;
+    if (tmp > 0.) {
+      uw = c;
+    } else if (tmp < 0.) {
+      dw = c;
+    } else if (rule_ == ZERO_FLUX_OUTWARD_UPWIND) {
+      if (dir > 0) {
+        uw = c;
+      } else {
+        dw = c;
+      }
+    } else {
+      // one upwind and the other downwind, lowest cell first
+      if (uw == -1 || c < uw) {
+        if (uw != -1) dw = uw;
+        uw = c;
+      } else {
+        dw = c;
+      }
+    }
+  }
+
+  (*upwind_cell_)[f] = uw;
+  (*downwind_cell_)[f] = dw;
+}
+
+} // namespace
+} // namespace
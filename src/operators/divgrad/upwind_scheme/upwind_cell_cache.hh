@@ -0,0 +1,80 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Upwind and downwind cells of each face, kept up to date with a flux.
+//
+// Which cell is upwind of a face depends only on the mesh topology and the
+// sign of the flux on that face.  Residual and preconditioner evaluations
+// within a timestep, and transport substeps, mostly see fluxes whose signs
+// have not changed, so rebuilding the lists from a sweep over every cell's
+// faces is usually wasted work.  This cache keeps the sign of the flux on
+// each face; Update() compares signs, which is a single streaming pass, and
+// recomputes the cells only of faces whose sign changed.
+//
+// Faces with zero flux are assigned by a rule chosen at construction, to
+// match the schemes that use the cache.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_OPERATORS_UPWIND_CELL_CACHE_HH_
+#define AMANZI_OPERATORS_UPWIND_CELL_CACHE_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_IntVector.h"
+#include "Epetra_MultiVector.h"
+
+#include "Mesh.hh"
+#include "MeshConnectivity.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class UpwindCellCache {
+ public:
+  enum ZeroFluxRule {
+    // the lowest numbered cell is upwind
+    ZERO_FLUX_FIRST_CELL_UPWIND = 0,
+    // the cell whose outward normal agrees with the face normal is upwind
+    ZERO_FLUX_OUTWARD_UPWIND
+  };
+
+  UpwindCellCache(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                  ZeroFluxRule rule);
+
+  Teuchos::RCP<const AmanziMesh::Mesh> Mesh() const { return mesh_; }
+
+  // Bring the cells up to date with the flux.  Its length sets the faces
+  // covered, the owned or all faces; other faces have no cells.  Returns
+  // the number of faces recomputed.
+  int Update(const Epetra_MultiVector& flux);
+
+  // Force a full recompute on the next Update().
+  void Invalidate() { sign_.clear(); }
+
+  // Cells on the ghosted face map, -1 for none (i.e. the boundary).
+  const Teuchos::RCP<Epetra_IntVector>& upwind_cell() const { return upwind_cell_; }
+  const Teuchos::RCP<Epetra_IntVector>& downwind_cell() const { return downwind_cell_; }
+
+ private:
+  void IdentifyFace_(int f, double flux);
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
+  Teuchos::RCP<const MeshConnectivity> conn_;
+  ZeroFluxRule rule_;
+
+  std::vector<signed char> sign_;
+  Teuchos::RCP<Epetra_IntVector> upwind_cell_;
+  Teuchos::RCP<Epetra_IntVector> downwind_cell_;
+};
+
+} // namespace
+} // namespace
+
+#endif
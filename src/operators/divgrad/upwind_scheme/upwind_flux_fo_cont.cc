@@ -15,6 +15,7 @@
 #include "State.hh"
 #include "Debugger.hh"
 #include "VerboseObject.hh"
+#include "MeshConnectivity.hh"
 #include "upwind_flux_fo_cont.hh"
 #include "Epetra_IntVector.h"
 
@@ -66,6 +67,7 @@ void UpwindFluxFOCont::CalculateCoefficientsOnFaces(
                                                     const Teuchos::Ptr<CompositeVector>& face_coef,
                                                     const Teuchos::Ptr<Debugger>& db) {
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = face_coef->Mesh();
+  Teuchos::RCP<const MeshConnectivity> conn = MeshConnectivity::Get(mesh);
   
   // initialize the face coefficients
   if (face_coef->HasComponent("cell")) {
@@ -94,15 +96,15 @@ void UpwindFluxFOCont::CalculateCoefficientsOnFaces(
   Epetra_IntVector downwind_cell(*face_coef->ComponentMap("face",true));
   downwind_cell.PutValue(-1);
   
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
   int nfaces_local = flux.size("face",false);
   
   int ncells = cell_coef.size("cell",true);
   for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);
+    const int* faces = conn->cell_faces(c);
+    const int* fdirs = conn->cell_face_dirs(c);
+    int nfaces = conn->cell_num_faces(c);
     
-    for (unsigned int n=0; n!=faces.size(); ++n) {
+    for (int n=0; n!=nfaces; ++n) {
       int f = faces[n];
       
       if (f < nfaces_local) {
@@ -179,7 +181,7 @@ void UpwindFluxFOCont::UpdateDerivatives(const Teuchos::Ptr<State>& S,
                                         const CompositeVector& dconductivity,
                                         const std::vector<int>& bc_markers,
                                         const std::vector<double>& bc_values,
-                                        std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > >* Jpp_faces) const {
+                                        FaceJacobian* Jpp_faces) const {
   AMANZI_ASSERT(0);
 }
 
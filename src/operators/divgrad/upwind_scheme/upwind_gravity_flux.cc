@@ -13,6 +13,7 @@
 #include "Tensor.hh"
 #include "CompositeVector.hh"
 #include "State.hh"
+#include "MeshConnectivity.hh"
 #include "upwind_gravity_flux.hh"
 
 namespace Amanzi {
@@ -43,11 +44,10 @@ void UpwindGravityFlux::CalculateCoefficientsOnFaces(
         const Epetra_Vector& g_vec,
         const Teuchos::Ptr<CompositeVector>& face_coef) {
 
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
   double flow_eps = 1.e-10;
 
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = face_coef->Mesh();
+  Teuchos::RCP<const MeshConnectivity> conn = MeshConnectivity::Get(mesh);
 
   // set up gravity
   AmanziGeometry::Point gravity(g_vec.MyLength());
@@ -73,10 +73,12 @@ void UpwindGravityFlux::CalculateCoefficientsOnFaces(
 
 
   for (unsigned int c=0; c!=cell_coef.size("cell", true); ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &dirs);
+    const int* faces = conn->cell_faces(c);
+    const int* dirs = conn->cell_face_dirs(c);
+    int nfaces = conn->cell_num_faces(c);
     AmanziGeometry::Point Kgravity = (*K_)[c] * gravity;
 
-    for (unsigned int n=0; n!=faces.size(); ++n) {
+    for (int n=0; n!=nfaces; ++n) {
       int f = faces[n];
 
       const AmanziGeometry::Point& normal = mesh->face_normal(f);
@@ -48,7 +48,7 @@ public:
                     const CompositeVector& dconductivity,
                     const std::vector<int>& bc_markers,
                     const std::vector<double>& bc_values,
-                    std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > >* Jpp_faces) const;
+                    FaceJacobian* Jpp_faces) const;
 
   virtual std::string
   CoefficientLocation() { return "upwind: face"; }
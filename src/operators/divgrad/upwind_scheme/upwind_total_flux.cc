@@ -15,6 +15,7 @@
 #include "State.hh"
 #include "Debugger.hh"
 #include "VerboseObject.hh"
+#include "MeshConnectivity.hh"
 #include "upwind_total_flux.hh"
 #include "Epetra_IntVector.h"
 
@@ -43,6 +44,18 @@ void UpwindTotalFlux::Update(const Teuchos::Ptr<State>& S,
 };
 
 
+const UpwindCellCache&
+UpwindTotalFlux::UpwindCells_(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                              const Epetra_MultiVector& flux) const {
+  if (upwind_cells_ == Teuchos::null || upwind_cells_->Mesh() != mesh) {
+    upwind_cells_ = Teuchos::rcp(new UpwindCellCache(mesh,
+            UpwindCellCache::ZERO_FLUX_FIRST_CELL_UPWIND));
+  }
+  upwind_cells_->Update(flux);
+  return *upwind_cells_;
+}
+
+
 void UpwindTotalFlux::CalculateCoefficientsOnFaces(
         const CompositeVector& cell_coef,
         const CompositeVector& flux,
@@ -65,42 +78,14 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(*face_coef->ComponentMap("face",true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(*face_coef->ComponentMap("face",true));
-  downwind_cell.PutValue(-1);
-
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
-  int nfaces_local = flux.size("face",false);
+  const UpwindCellCache& upwind_cells = UpwindCells_(mesh, flux_v);
+  const Epetra_IntVector& upwind_cell = *upwind_cells.upwind_cell();
+  const Epetra_IntVector& downwind_cell = *upwind_cells.downwind_cell();
 
   int ncells = cell_coef.size("cell",true);
-  for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);   
-
-    for (unsigned int n=0; n!=faces.size(); ++n) {
-      int f = faces[n];
-
-      if  (face_coef->HasComponent("cell")) {        
-        (*face_coef->ViewComponent("cell",true))[0][c] = coef_cells[0][c];
-      }
-
-      if (f < nfaces_local) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
+  if (face_coef->HasComponent("cell")) {
+    Epetra_MultiVector& coef_faces_c = *face_coef->ViewComponent("cell",true);
+    for (int c=0; c!=ncells; ++c) coef_faces_c[0][c] = coef_cells[0][c];
   }
 
   // Determine the face coefficient of local faces.
@@ -177,7 +162,7 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
                                         const CompositeVector& dconductivity,
                                         const std::vector<int>& bc_markers,
                                         const std::vector<double>& bc_values,
-                                        std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > >* Jpp_faces) const {
+                                        FaceJacobian* Jpp_faces) const {
   // Grab derivatives
   dconductivity.ScatterMasterToGhosted("cell");
   const Epetra_MultiVector& dcell_v = *dconductivity.ViewComponent("cell",true);
@@ -193,7 +178,7 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
   // Grab mesh and allocate space
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = dconductivity.Mesh();
   unsigned int nfaces_owned = mesh->num_entities(AmanziMesh::FACE,AmanziMesh::Parallel_type::OWNED);
-  Jpp_faces->resize(nfaces_owned);
+  Jpp_faces->Resize(nfaces_owned);
 
   // workspace
   double dK_dp[2];
@@ -202,38 +187,11 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(mesh->face_map(true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(mesh->face_map(true));
-  downwind_cell.PutValue(-1);
-
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
-
-  int ncells = dcell_v.MyLength();
-  for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);
-
-    for (unsigned int n=0; n!=faces.size(); ++n) {
-      int f = faces[n];
-
-      if (f < nfaces_owned) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
-  }
+  const UpwindCellCache& upwind_cells = UpwindCells_(mesh, flux_v);
+  const Epetra_IntVector& upwind_cell = *upwind_cells.upwind_cell();
+  const Epetra_IntVector& downwind_cell = *upwind_cells.downwind_cell();
+
+  Teuchos::RCP<const MeshConnectivity> conn = MeshConnectivity::Get(mesh);
 
 
   for (unsigned int f=0; f!=nfaces_owned; ++f) {
@@ -241,9 +199,8 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
     int dw = downwind_cell[f];
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
 
-    AmanziMesh::Entity_ID_List cells;
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int mcells = cells.size();
+    const int* cells = conn->face_cells(f);
+    int mcells = conn->face_num_cells(f);
 
     // uw coef
     if (uw == -1) {
@@ -291,9 +248,7 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
     }
 
     // create the local matrix
-    Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > Jpp =
-      Teuchos::rcp(new Teuchos::SerialDenseMatrix<int, double>(mcells, mcells));
-    (*Jpp_faces)[f] = Jpp;
+    Jpp_faces->InitializeFace(f, mcells);
 
     if (mcells == 1) {
       if (bc_markers[f] == Operators::OPERATOR_BC_DIRICHLET) {
@@ -302,19 +257,19 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
         p[1] = bc_values[f];
         double dp = p[0] - p[1];
 
-        (*Jpp)(0,0) = dp * mesh->face_area(f) * dK_dp[0];
+        (*Jpp_faces)(f,0,0) = dp * mesh->face_area(f) * dK_dp[0];
       } else {
-        (*Jpp)(0,0) = 0.;
+        (*Jpp_faces)(f,0,0) = 0.;
       }
 
     } else {
       p[0] = pres_v[0][cells[0]];
       p[1] = pres_v[0][cells[1]];
 
-      (*Jpp)(0,0) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[0];
-      (*Jpp)(0,1) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[1];
-      (*Jpp)(1,0) = -(*Jpp)(0,0);
-      (*Jpp)(1,1) = -(*Jpp)(0,1);
+      (*Jpp_faces)(f,0,0) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[0];
+      (*Jpp_faces)(f,0,1) = (p[0] - p[1]) * mesh->face_area(f) * dK_dp[1];
+      (*Jpp_faces)(f,1,0) = -(*Jpp_faces)(f,0,0);
+      (*Jpp_faces)(f,1,1) = -(*Jpp_faces)(f,0,1);
     }
   }
 }
@@ -14,6 +14,7 @@
 #define AMANZI_UPWINDING_TOTALFLUX_SCHEME_
 
 #include "upwinding.hh"
+#include "upwind_cell_cache.hh"
 
 namespace Amanzi {
 
@@ -48,11 +49,18 @@ public:
                     const CompositeVector& dconductivity,
                     const std::vector<int>& bc_markers,
                     const std::vector<double>& bc_values,
-                    std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > >* Jpp_faces) const;
+                    FaceJacobian* Jpp_faces) const;
 
   virtual std::string
   CoefficientLocation() { return "upwind: face"; }
   
+private:
+
+  // upwind cells for the flux, shared by Update() and UpdateDerivatives()
+  const UpwindCellCache&
+  UpwindCells_(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+               const Epetra_MultiVector& flux) const;
+
 private:
 
   std::string pkname_;
@@ -60,6 +68,7 @@ private:
   std::string face_coef_;
   std::string flux_;
   double flux_eps_;
+  mutable Teuchos::RCP<UpwindCellCache> upwind_cells_;
 };
 
 } // namespace
@@ -19,6 +19,7 @@
 #include "dbc.hh"
 #include "OperatorDefs.hh"
 #include "CompositeVector.hh"
+#include "face_jacobian.hh"
 
 namespace Amanzi {
 
@@ -45,13 +46,15 @@ class Upwinding {
   virtual void
   Update(const Teuchos::Ptr<State>& S, const Teuchos::Ptr<Debugger>& db=Teuchos::null) = 0;
 
+  // Jacobian blocks of each owned face with respect to its cells, written
+  // into Jpp_faces, which is resized as needed and may be reused.
   virtual void
   UpdateDerivatives(const Teuchos::Ptr<State>& S, 
                     std::string potential_key,
                     const CompositeVector& dconductivity,
                     const std::vector<int>& bc_markers,
                     const std::vector<double>& bc_values,
-                    std::vector<Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double> > >* Jpp_faces) const {
+                    FaceJacobian* Jpp_faces) const {
     AMANZI_ASSERT(0);
   }
 
@@ -10,10 +10,14 @@
    CURRENT ASSUMPTIONS:
      1. parallel decomp not in the vertical
      2. fields are not ordered along the column, and so must be copied
+        (column cells, depths and thicknesses come from ColumnGeometry)
      3. all columns have the same number of cells
    ------------------------------------------------------------------------- */
 
+#include <algorithm>
+
 #include "MeshPartition.hh"
+#include "ColumnGeometry.hh"
 
 #include "bgc_simple_funcs.hh"
 
@@ -93,12 +97,23 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
   }
 
   int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  pfts_old_.resize(ncols);
-  pfts_.resize(ncols);
+  int npft = pft_names.size();
+  int ncells = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  col_index_.assign(ncells, -1);
+  pft_store_old_.reserve(ncols * npft);
+
+  // -- columns and their depths/thicknesses come from the shared column
+  //    geometry; map each surface cell to the mesh column below it
+  col_geom_ = Operators::ColumnGeometry::Get(mesh_);
+  geom_cols_.resize(ncols);
   for (unsigned int col=0; col!=ncols; ++col) {
     int f = mesh_surf_->entity_get_parent(AmanziMesh::CELL, col);
-    ColIterator col_iter(*mesh_, f);
-    std::size_t ncol_cells = col_iter.size();
+    AmanziMesh::Entity_ID_List facecells;
+    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &facecells);
+    AMANZI_ASSERT(facecells.size() == 1);
+    geom_cols_[col] = mesh_->column_ID(facecells[0]);
+    const int* col_cells = col_geom_->cells(geom_cols_[col]);
+    std::size_t ncol_cells = col_geom_->num_cells(geom_cols_[col]);
 
     // unclear which this should be:
     // -- col area is the true face area
@@ -112,27 +127,44 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
       AMANZI_ASSERT(ncol_cells == ncells_per_col_);
     }
 
-    pfts_old_[col].resize(pft_names.size());
-    pfts_[col].resize(pft_names.size());
+    for (std::size_t i=0; i!=ncol_cells; ++i) {
+      col_index_[col_cells[i]] = col*ncells_per_col_ + i;
+    }
 
-    for (int i=0; i!=pft_names.size(); ++i) {
+    for (int i=0; i!=npft; ++i) {
       std::string pft_name = pft_names[i];
       Teuchos::ParameterList& pft_plist = pft_params.sublist(pft_name);
-      pfts_old_[col][i] = Teuchos::rcp(new PFT(pft_name, ncol_cells));
-      pfts_old_[col][i]->Init(pft_plist,col_area);
-      pfts_[col][i] = Teuchos::rcp(new PFT(*pfts_old_[col][i]));
+      pft_store_old_.push_back(PFT(pft_name, ncol_cells));
+      pft_store_old_.back().Init(pft_plist,col_area);
     }
   }
+  AMANZI_ASSERT(std::find(col_index_.begin(), col_index_.end(), -1) == col_index_.end());
+  pft_store_ = pft_store_old_;
 
-  // -- soil carbon pools
+  // -- point the per-column PFTs into the stores, which are never resized
+  pfts_old_.resize(ncols);
+  pfts_.resize(ncols);
+  for (unsigned int col=0; col!=ncols; ++col) {
+    pfts_old_[col].resize(npft);
+    pfts_[col].resize(npft);
+    for (int i=0; i!=npft; ++i) {
+      pfts_old_[col][i] = Teuchos::rcpFromRef(pft_store_old_[col*npft + i]);
+      pfts_[col][i] = Teuchos::rcpFromRef(pft_store_[col*npft + i]);
+    }
+  }
+
+  // -- soil carbon pools, viewing som_
+  som_.assign(ncells * nPools, 0.);
   soil_carbon_pools_.resize(ncols);
   for (unsigned int col=0; col!=ncols; ++col) {
     soil_carbon_pools_[col].resize(ncells_per_col_);
-    ColIterator col_iter(*mesh_, mesh_surf_->entity_get_parent(AmanziMesh::CELL, col), ncells_per_col_);
+    const int* col_cells = col_geom_->cells(geom_cols_[col]);
 
-    for (std::size_t i=0; i!=col_iter.size(); ++i) {
-      // col_iter[i] = cell id, mp[cell_id] = index into partition list, sc_params_[index] = correct params
-      soil_carbon_pools_[col][i] = Teuchos::rcp(new SoilCarbon(sc_params_[mp[col_iter[i]]]));
+    for (int i=0; i!=ncells_per_col_; ++i) {
+      // col_cells[i] = cell id, mp[cell_id] = index into partition list, sc_params_[index] = correct params
+      AMANZI_ASSERT(sc_params_[mp[col_cells[i]]]->nPools == nPools);
+      soil_carbon_pools_[col][i] = Teuchos::rcp(new SoilCarbon(sc_params_[mp[col_cells[i]]],
+              &som_[(col*ncells_per_col_ + i) * nPools]));
     }
   }
 
@@ -290,8 +322,6 @@ void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
   }
   
   // init root carbon
-  Teuchos::RCP<Epetra_SerialDenseVector> col_temp =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
   Teuchos::RCP<Epetra_SerialDenseVector> col_depth =
       Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
   Teuchos::RCP<Epetra_SerialDenseVector> col_dz =
@@ -301,23 +331,21 @@ void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
   const Epetra_Vector& temp = *(*S->GetFieldData("temperature")
 				->ViewComponent("cell",false))(0);
 
+  FieldToColumns_(temp, temp_cols_);
+
   int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
   for (int col=0; col!=ncols; ++col) {
-    FieldToColumn_(col, temp, col_temp.ptr());
+    Epetra_SerialDenseVector col_temp(View, &temp_cols_[col*ncells_per_col_], ncells_per_col_);
     ColDepthDz_(col, col_depth.ptr(), col_dz.ptr());
 
     for (int i=0; i!=npft; ++i) {
-      pfts_old_[col][i]->InitRoots(*col_temp, *col_depth, *col_dz);
+      pfts_old_[col][i]->InitRoots(col_temp, *col_depth, *col_dz);
     }
   }
 
   // ensure all initialization in both PFTs?  Not sure this is
   // necessary -- likely done in initial call to commit-state --etc
-  for (int col=0; col!=ncols; ++col) {
-    for (int i=0; i!=npft; ++i) {
-      *pfts_[col][i] = *pfts_old_[col][i];
-    }
-  }
+  pft_store_ = pft_store_old_;
 }
 
   
@@ -327,13 +355,7 @@ void BGCSimple::CommitStep(double told, double tnew, const Teuchos::RCP<State>&
   // the step as succesful.
   double dt = tnew - told;
 
-  int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  int npft = pfts_old_[0].size();
-  for (int col=0; col!=ncols; ++col) {
-    for (int i=0; i!=npft; ++i) {
-      *pfts_old_[col][i] = *pfts_[col][i];
-    }
-  }
+  pft_store_old_ = pft_store_;
 }
 
 // -- advance the model
@@ -352,12 +374,7 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
   // this timestep.  This is hackery to get around the fact that PFTs are not
   // (but should be) in state.
   AmanziMesh::Entity_ID ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  for (AmanziMesh::Entity_ID col=0; col!=ncols; ++col) {
-    int npft = pfts_old_[col].size();
-    for (int i=0; i!=npft; ++i) {
-      *pfts_[col][i] = *pfts_old_[col][i];
-    }
-  }
+  pft_store_ = pft_store_old_;
 
   // grab the required fields
   Epetra_MultiVector& sc_pools = *S_next_->GetFieldData(key_, name_)
@@ -417,43 +434,42 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
   const Epetra_MultiVector& scv = *S_inter_->GetFieldData("surface-cell_volume")
       ->ViewComponent("cell", false);
 
-  // Create workspace arrays (these should be removed when data is correctly oriented).
-  Teuchos::RCP<Epetra_SerialDenseVector> temp_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> pres_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
+  // Create workspace arrays
   Teuchos::RCP<Epetra_SerialDenseVector> dz_c =
       Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
   Teuchos::RCP<Epetra_SerialDenseVector> depth_c =
       Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-
-  // Create a workspace array for the result
-  Epetra_SerialDenseVector co2_decomp_c(ncells_per_col_);
-  Epetra_SerialDenseVector trans_c(ncells_per_col_);
   double sw_c(0.);
 
+  // Gather the soil state into column order.  Each pass streams over the
+  // cells of a field; the model then sees contiguous views of each column.
+  FieldToColumns_(*temp(0), temp_cols_);
+  FieldToColumns_(*pres(0), pres_cols_);
+  co2_cols_.resize(col_index_.size());
+  trans_cols_.resize(col_index_.size());
+
+  int nPools = sc_pools.NumVectors();
+  int ncells = col_index_.size();
+  for (int p=0; p!=nPools; ++p) {
+    for (int c=0; c!=ncells; ++c) {
+      som_[col_index_[c]*nPools + p] = sc_pools[p][c];
+    }
+  }
+
   // Grab the mesh partition to get soil properties
   Teuchos::RCP<const Functions::MeshPartition> mp = S_next_->GetMeshPartition(soil_part_name_);
   total_lai.PutScalar(0.);
 
   // loop over columns and apply the model
   for (AmanziMesh::Entity_ID col=0; col!=ncols; ++col) {
-    // update the various soil arrays
-    FieldToColumn_(col, *temp(0), temp_c.ptr());
-    FieldToColumn_(col, *pres(0), pres_c.ptr());
+    // views of the column's soil arrays
+    int offset = col*ncells_per_col_;
+    Epetra_SerialDenseVector temp_c(View, &temp_cols_[offset], ncells_per_col_);
+    Epetra_SerialDenseVector pres_c(View, &pres_cols_[offset], ncells_per_col_);
+    Epetra_SerialDenseVector co2_decomp_c(View, &co2_cols_[offset], ncells_per_col_);
+    Epetra_SerialDenseVector trans_c(View, &trans_cols_[offset], ncells_per_col_);
     ColDepthDz_(col, depth_c.ptr(), dz_c.ptr());
 
-    // copy over the soil carbon arrays
-    ColIterator col_iter(*mesh_, mesh_surf_->entity_get_parent(AmanziMesh::CELL, col), ncells_per_col_);
-    // -- serious cache thrash... --etc
-    for (std::size_t i=0; i!=col_iter.size(); ++i) {
-      AmanziGeometry::Point centroid = mesh_->cell_centroid(col_iter[i]);
-	  //      std::cout << "Col iter col=" << col << ", index i=" << i << ", cell=" << col_iter[i] << " at " << centroid << std::endl;
-      for (int p=0; p!=soil_carbon_pools_[col][i]->nPools; ++p) {
-        soil_carbon_pools_[col][i]->SOM[p] = sc_pools[p][col_iter[i]];
-      }
-    }
-
     // Create the Met data struct
     MetData met;
     met.qSWin = qSWin[0][col];
@@ -467,27 +483,11 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
 
     // call the model
     BGCAdvance(S_inter_->time(), dt, scv[0][col], cryoturbation_coef_, met,
-               *temp_c, *pres_c, *depth_c, *dz_c,
+               temp_c, pres_c, *depth_c, *dz_c,
                pfts_[col], soil_carbon_pools_[col],
                co2_decomp_c, trans_c, sw_c);
 
-    // copy back
-    // -- serious cache thrash... --etc
-    for (std::size_t i=0; i!=col_iter.size(); ++i) {
-      for (int p=0; p!=soil_carbon_pools_[col][i]->nPools; ++p) {
-        sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
-      }
-
-      // and integrate the decomp
-      co2_decomp[0][col_iter[i]] += co2_decomp_c[i];
-
-
-      // and pull in the transpiration, converting to mol/m^3/s, as a sink
-      trans[0][col_iter[i]] = -trans_c[i]/ .01801528;
-      //      std::cout << std::scientific;
-      //      std::cout << "Transpiration at " << col_iter[i] << "," << i << " = " << trans[0][col_iter[i]] << std::endl;
-      sw[0][col] = sw_c;
-    }
+    sw[0][col] = sw_c;
 
     for (int lcv_pft=0; lcv_pft!=pfts_[col].size(); ++lcv_pft) {
       biomass[lcv_pft][col] = pfts_[col][lcv_pft]->totalBiomass;
@@ -502,6 +502,19 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
 
   } // end loop over columns
 
+  // scatter back
+  for (int p=0; p!=nPools; ++p) {
+    for (int c=0; c!=ncells; ++c) {
+      sc_pools[p][c] = som_[col_index_[c]*nPools + p];
+    }
+  }
+  for (int c=0; c!=ncells; ++c) {
+    // integrate the decomp
+    co2_decomp[0][c] += co2_cols_[col_index_[c]];
+    // and pull in the transpiration, converting to mol/m^3/s, as a sink
+    trans[0][c] = -trans_cols_[col_index_[c]] / .01801528;
+  }
+
   // mark primaries as changed
   trans_eval_->SetFieldAsChanged(S_next_.ptr());
   sw_eval_->SetFieldAsChanged(S_next_.ptr());
@@ -510,61 +523,28 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
 }
 
 
-// helper function for pushing field to column
-void BGCSimple::FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& vec,
-        Teuchos::Ptr<Epetra_SerialDenseVector> col_vec, bool copy) {
-  if (col_vec == Teuchos::null) {
-    col_vec = Teuchos::ptr(new Epetra_SerialDenseVector(ncells_per_col_));
-  }
-
-  ColIterator col_iter(*mesh_, mesh_surf_->entity_get_parent(AmanziMesh::CELL, col), ncells_per_col_);
-  for (std::size_t i=0; i!=col_iter.size(); ++i) {
-    (*col_vec)[i] = vec[col_iter[i]];
+// helper function for gathering a field into column order
+void BGCSimple::FieldToColumns_(const Epetra_Vector& vec, std::vector<double>& cols) {
+  int ncells = col_index_.size();
+  cols.resize(ncells);
+  for (int c=0; c!=ncells; ++c) {
+    cols[col_index_[c]] = vec[c];
   }
 }
 
-// helper function for collecting column dz and depth
+// helper function for collecting column dz and depth, copied from the
+// column geometry cache
 void BGCSimple::ColDepthDz_(AmanziMesh::Entity_ID col,
                             Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                             Teuchos::Ptr<Epetra_SerialDenseVector> dz) {
-  AmanziMesh::Entity_ID f_above = mesh_surf_->entity_get_parent(AmanziMesh::CELL, col);
-  ColIterator col_iter(*mesh_, f_above, ncells_per_col_);
-
-  AmanziGeometry::Point surf_centroid = mesh_->face_centroid(f_above);
-  AmanziGeometry::Point neg_z(3);
-  neg_z.set(0.,0.,-1);
-
-  for (std::size_t i=0; i!=col_iter.size(); ++i) {
-    // depth centroid
-    (*depth)[i] = surf_centroid[2] - mesh_->cell_centroid(col_iter[i])[2];
-
-    // dz
-    // -- find face_below
-    AmanziMesh::Entity_ID_List faces;
-    std::vector<int> dirs;
-    mesh_->cell_get_faces_and_dirs(col_iter[i], &faces, &dirs);
-
-    // -- mimics implementation of build_columns() in Mesh
-    double mindp = 999.0;
-    AmanziMesh::Entity_ID f_below = -1;
-    for (std::size_t j=0; j!=faces.size(); ++j) {
-      AmanziGeometry::Point normal = mesh_->face_normal(faces[j]);
-      if (dirs[j] == -1) normal *= -1;
-      normal /= AmanziGeometry::norm(normal);
-
-      double dp = -normal * neg_z;
-      if (dp < mindp) {
-        mindp = dp;
-        f_below = faces[j];
-      }
-    }
-
-    // -- fill the val
-    (*dz)[i] = mesh_->face_centroid(f_above)[2] - mesh_->face_centroid(f_below)[2];
+  int geom_col = geom_cols_[col];
+  const double* col_depth = col_geom_->depth(geom_col);
+  const double* col_dz = col_geom_->dz(geom_col);
+  for (int i=0; i!=ncells_per_col_; ++i) {
+    (*depth)[i] = col_depth[i];
+    (*dz)[i] = col_dz[i];
     AMANZI_ASSERT( (*dz)[i] > 0. );
-    f_above = f_below;
   }
-
 }
 
 
@@ -19,6 +19,7 @@
 
 #include "VerboseObject.hh"
 #include "TreeVector.hh"
+#include "ColumnGeometry.hh"
 
 #include "PK_Factory.hh"
 #include "pk_physical_default.hh"
@@ -67,41 +68,12 @@ class BGCSimple : public PK_Physical_Default {
   virtual std::string name(){return "BGC simple";};
 
  protected:
-  void FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& vec,
-                     Teuchos::Ptr<Epetra_SerialDenseVector> col_vec,
-                     bool copy=true);
+  // Gather a cell field into column order, streaming over cells.
+  void FieldToColumns_(const Epetra_Vector& vec, std::vector<double>& cols);
   void ColDepthDz_(AmanziMesh::Entity_ID col,
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
 
-  class ColIterator {
-   public:
-    ColIterator(const AmanziMesh::Mesh& mesh,
-                AmanziMesh::Entity_ID col_face, int ncells=0) {
-      if (ncells > 0) cells_.reserve(ncells);
-      AmanziMesh::Entity_ID_List facecells;
-      mesh.face_get_cells(col_face, AmanziMesh::Parallel_type::ALL, &facecells);
-      AMANZI_ASSERT(facecells.size() == 1);
-
-      AmanziMesh::Entity_ID c = facecells[0];
-      while (c >= 0) {
-        cells_.push_back(c);
-        c = mesh.cell_get_cell_below(c);
-      }
-    }
-
-    typedef std::vector<AmanziMesh::Entity_ID>::const_iterator const_iterator;
-
-    const_iterator begin() { return cells_.begin(); }
-    const_iterator end() { return cells_.end(); }
-    std::size_t size() { return cells_.size(); }
-    AmanziMesh::Entity_ID operator[](std::size_t i) { return cells_[i]; }
-
-   private:
-    std::vector<AmanziMesh::Entity_ID> cells_;
-  };
-
-
  protected:
   double dt_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_surf_;
@@ -113,6 +85,26 @@ class BGCSimple : public PK_Physical_Default {
   std::vector<std::vector<Teuchos::RCP<PFT> > > pfts_old_;   // need two copies for failed timesteps
   std::vector<std::vector<Teuchos::RCP<SoilCarbon> > > soil_carbon_pools_;
 
+  // Backing store for the above, contiguous over all columns.  pfts_ and
+  // pfts_old_ point into the PFT stores, indexed [col*npft + pft], and each
+  // SoilCarbon views its pools in som_, indexed [col_cell*nPools + pool].
+  std::vector<PFT> pft_store_;
+  std::vector<PFT> pft_store_old_;
+  std::vector<double> som_;
+
+  // Column ordering of subsurface cells: cell c is entry col_index_[c] =
+  // col*ncells_per_col_ + i of column-ordered arrays, where i is its
+  // position from the top of the column.
+  std::vector<int> col_index_;
+
+  // shared column cells/depths/thicknesses, and the mesh column under each
+  // surface cell
+  Teuchos::RCP<const Operators::ColumnGeometry> col_geom_;
+  std::vector<int> geom_cols_;
+
+  // column-ordered workspace, viewed per column by the model
+  std::vector<double> temp_cols_, pres_cols_, co2_cols_, trans_cols_;
+
   // evaluator for transpiration
   Teuchos::RCP<PrimaryVariableFieldEvaluator> trans_eval_;
   Teuchos::RCP<PrimaryVariableFieldEvaluator> sw_eval_;
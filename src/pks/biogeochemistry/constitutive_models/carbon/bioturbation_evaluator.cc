@@ -15,7 +15,7 @@ namespace BGC {
 namespace BGCRelations {
 
 BioturbationEvaluator::BioturbationEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   carbon_key_ = plist_.get<std::string>("SOM key", "soil_organic_matter");
   dependencies_.insert(carbon_key_);
@@ -30,7 +30,7 @@ BioturbationEvaluator::BioturbationEvaluator(Teuchos::ParameterList& plist) :
 
 
 BioturbationEvaluator::BioturbationEvaluator(const BioturbationEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     carbon_key_(other.carbon_key_),
     diffusivity_key_(other.diffusivity_key_) {}
 
@@ -10,13 +10,13 @@
 #define AMANZI_BGCRELATIONS_BIOTURBATION_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace BGC {
 namespace BGCRelations {
 
-class BioturbationEvaluator : public SecondaryVariableFieldEvaluator {
+class BioturbationEvaluator : public TimedSecondaryVariableFieldEvaluator {
  public:
   explicit
   BioturbationEvaluator(Teuchos::ParameterList& plist);
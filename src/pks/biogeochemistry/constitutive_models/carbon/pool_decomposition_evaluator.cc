@@ -16,7 +16,7 @@ namespace BGC {
 namespace BGCRelations {
 
 PoolDecompositionEvaluator::PoolDecompositionEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   carbon_key_ = plist_.get<std::string>("SOM key", "soil_organic_matter");
   dependencies_.insert(carbon_key_);
@@ -30,7 +30,7 @@ PoolDecompositionEvaluator::PoolDecompositionEvaluator(Teuchos::ParameterList& p
 
 
 PoolDecompositionEvaluator::PoolDecompositionEvaluator(const PoolDecompositionEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     carbon_key_(other.carbon_key_),
     decay_key_(other.decay_key_) {}
 
@@ -10,13 +10,13 @@
 #define AMANZI_BGCRELATIONS_POOL_DECOMP_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace BGC {
 namespace BGCRelations {
 
-class PoolDecompositionEvaluator : public SecondaryVariableFieldEvaluator {
+class PoolDecompositionEvaluator : public TimedSecondaryVariableFieldEvaluator {
  public:
   explicit
   PoolDecompositionEvaluator(Teuchos::ParameterList& plist);
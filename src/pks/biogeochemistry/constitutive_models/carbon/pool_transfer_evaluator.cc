@@ -17,7 +17,7 @@ namespace BGC {
 namespace BGCRelations {
 
 PoolTransferEvaluator::PoolTransferEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist) {
+    TimedSecondaryVariablesFieldEvaluator(plist) {
 
   // dependencies
   carbon_key_ = plist_.get<std::string>("SOM key", "soil_organic_matter");
@@ -38,7 +38,7 @@ PoolTransferEvaluator::PoolTransferEvaluator(Teuchos::ParameterList& plist) :
 
 
 PoolTransferEvaluator::PoolTransferEvaluator(const PoolTransferEvaluator& other) :
-    SecondaryVariablesFieldEvaluator(other),
+    TimedSecondaryVariablesFieldEvaluator(other),
     carbon_key_(other.carbon_key_),
     decay_key_(other.decay_key_),
     partition_key_(other.partition_key_),
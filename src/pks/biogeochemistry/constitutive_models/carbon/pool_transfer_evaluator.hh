@@ -10,7 +10,7 @@
 #define AMANZI_BGCRELATIONS_POOL_DECOMP_HH_
 
 #include "Factory.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 class Epetra_SerialDenseVector;
 class Epetra_SerialDenseMatrix;
@@ -19,7 +19,7 @@ namespace Amanzi {
 namespace BGC {
 namespace BGCRelations {
 
-class PoolTransferEvaluator : public SecondaryVariablesFieldEvaluator {
+class PoolTransferEvaluator : public TimedSecondaryVariablesFieldEvaluator {
  public:
   explicit
   PoolTransferEvaluator(Teuchos::ParameterList& plist);
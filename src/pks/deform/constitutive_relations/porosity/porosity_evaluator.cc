@@ -13,7 +13,7 @@ namespace Deform {
 namespace DeformRelations {
 
 PorosityEvaluator::PorosityEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   // add dependency to cell volume
   dependencies_.insert("cell_volume");
@@ -22,7 +22,7 @@ PorosityEvaluator::PorosityEvaluator(Teuchos::ParameterList& plist) :
 
 
 PorosityEvaluator::PorosityEvaluator(const PorosityEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other)
+    TimedSecondaryVariableFieldEvaluator(other)
 { }
 
 Teuchos::RCP<FieldEvaluator>
@@ -10,7 +10,7 @@
 #define AMANZI_DEFORMRELATIONS_POROSITY_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 
 
@@ -18,7 +18,7 @@ namespace Amanzi {
 namespace Deform {
 namespace DeformRelations {
 
-class PorosityEvaluator : public SecondaryVariableFieldEvaluator {
+class PorosityEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
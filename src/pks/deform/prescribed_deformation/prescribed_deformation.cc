@@ -16,6 +16,7 @@
 
 #include "prescribed_deformation.hh"
 #include "porosity_evaluator.hh"
+#include "ColumnGeometry.hh"
 
 namespace Amanzi {
 namespace Deform {
@@ -270,6 +271,7 @@ bool PrescribedDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
 
   // deform the mesh
   write_access_mesh_->deform( nodeids, newpos, true, &finpos); // deforms the mesh itself
+  Operators::ColumnGeometry::MeshDeformed(S_next_->GetMesh());
 
 
   // now we have to adapt the surface mesh to the new volume mesh
@@ -16,6 +16,7 @@
 
 #include "prescribed_volumetric_deformation.hh"
 #include "porosity_evaluator.hh"
+#include "ColumnGeometry.hh"
 
 namespace Amanzi {
 namespace Deform {
@@ -199,6 +200,7 @@ bool PrescribedVolumetricDeformation::advance(double dt) {
   
   // deform the mesh
   write_access_mesh_->deform( target_cell_volumes, min_cell_volumes, bottom_surface_, true); // deforms the mesh itself
+  Operators::ColumnGeometry::MeshDeformed(S_next_->GetMesh());
 
   // for( Amanzi::AmanziMesh::Entity_ID_List::iterator c = cell_ids.begin(); c != cell_ids.end();  c++) {
   //   std::cout << min_cell_volumes[*c] << " " << target_cell_volumes[*c] << " " << cv[0][*c] << " " << write_access_mesh_->cell_volume(*c) <<std::endl;
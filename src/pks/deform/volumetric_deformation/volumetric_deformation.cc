@@ -21,6 +21,7 @@
 
 #include "LinearOperatorFactory.hh"
 #include "CompositeVectorFunctionFactory.hh"
+#include "ColumnGeometry.hh"
 
 #include "volumetric_deformation.hh"
 
@@ -526,6 +527,7 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
 #endif
       
       mesh_nc_->deform(target_cell_vols, min_cell_vols, *below_node_list, true);
+      Operators::ColumnGeometry::MeshDeformed(mesh_nc_);
       solution_evaluator_->SetFieldAsChanged(S_next_.ptr());
       
 
@@ -636,6 +638,7 @@ bool VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
 #endif
       
       mesh_nc_->deform(node_ids, new_positions, true, &final_positions);
+      Operators::ColumnGeometry::MeshDeformed(mesh_nc_);
 
       // INSERT EXTRA CODE TO UNDEFORM THE MESH FOR MIN_VOLS!
 
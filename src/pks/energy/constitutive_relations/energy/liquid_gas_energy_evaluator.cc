@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 LiquidGasEnergyEvaluator::LiquidGasEnergyEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("liquid_gas_energy parameters");
   model_ = Teuchos::rcp(new LiquidGasEnergyModel(sublist));
@@ -23,7 +23,7 @@ LiquidGasEnergyEvaluator::LiquidGasEnergyEvaluator(Teuchos::ParameterList& plist
 
 // Copy constructor
 LiquidGasEnergyEvaluator::LiquidGasEnergyEvaluator(const LiquidGasEnergyEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     phi0_key_(other.phi0_key_),
     sl_key_(other.sl_key_),
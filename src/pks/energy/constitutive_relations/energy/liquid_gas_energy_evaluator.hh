@@ -11,7 +11,7 @@ Energy for a two-phase, liquid+water vapor evaluator.
 #define AMANZI_ENERGY_LIQUID_GAS_ENERGY_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class LiquidGasEnergyModel;
 
-class LiquidGasEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class LiquidGasEnergyEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 LiquidIceEnergyEvaluator::LiquidIceEnergyEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("liquid_ice_energy parameters");
   model_ = Teuchos::rcp(new LiquidIceEnergyModel(sublist));
@@ -23,7 +23,7 @@ LiquidIceEnergyEvaluator::LiquidIceEnergyEvaluator(Teuchos::ParameterList& plist
 
 // Copy constructor
 LiquidIceEnergyEvaluator::LiquidIceEnergyEvaluator(const LiquidIceEnergyEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     phi0_key_(other.phi0_key_),
     sl_key_(other.sl_key_),
@@ -11,7 +11,7 @@ Energy for a two-phase, liquid+ice evaluator.
 #define AMANZI_ENERGY_LIQUID_ICE_ENERGY_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class LiquidIceEnergyModel;
 
-class LiquidIceEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class LiquidIceEnergyEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
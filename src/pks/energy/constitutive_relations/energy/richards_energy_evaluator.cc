@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 RichardsEnergyEvaluator::RichardsEnergyEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("richards_energy parameters");
   model_ = Teuchos::rcp(new RichardsEnergyModel(sublist));
@@ -23,7 +23,7 @@ RichardsEnergyEvaluator::RichardsEnergyEvaluator(Teuchos::ParameterList& plist)
 
 // Copy constructor
 RichardsEnergyEvaluator::RichardsEnergyEvaluator(const RichardsEnergyEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     phi0_key_(other.phi0_key_),
     sl_key_(other.sl_key_),
@@ -11,7 +11,7 @@ Richards energy: the standard form as a function of liquid saturation and specif
 #define AMANZI_ENERGY_RICHARDS_ENERGY_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class RichardsEnergyModel;
 
-class RichardsEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class RichardsEnergyEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
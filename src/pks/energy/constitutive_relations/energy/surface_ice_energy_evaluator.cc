@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 SurfaceIceEnergyEvaluator::SurfaceIceEnergyEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("surface_ice_energy parameters");
   model_ = Teuchos::rcp(new SurfaceIceEnergyModel(sublist));
@@ -23,7 +23,7 @@ SurfaceIceEnergyEvaluator::SurfaceIceEnergyEvaluator(Teuchos::ParameterList& pli
 
 // Copy constructor
 SurfaceIceEnergyEvaluator::SurfaceIceEnergyEvaluator(const SurfaceIceEnergyEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     h_key_(other.h_key_),
     eta_key_(other.eta_key_),
     nl_key_(other.nl_key_),
@@ -11,7 +11,7 @@ Energy evaulator for ice+liquid surface water.
 #define AMANZI_ENERGY_SURFACE_ICE_ENERGY_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class SurfaceIceEnergyModel;
 
-class SurfaceIceEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class SurfaceIceEnergyEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 ThreePhaseEnergyEvaluator::ThreePhaseEnergyEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("three_phase_energy parameters");
   model_ = Teuchos::rcp(new ThreePhaseEnergyModel(sublist));
@@ -23,7 +23,7 @@ ThreePhaseEnergyEvaluator::ThreePhaseEnergyEvaluator(Teuchos::ParameterList& pli
 
 // Copy constructor
 ThreePhaseEnergyEvaluator::ThreePhaseEnergyEvaluator(const ThreePhaseEnergyEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     phi0_key_(other.phi0_key_),
     sl_key_(other.sl_key_),
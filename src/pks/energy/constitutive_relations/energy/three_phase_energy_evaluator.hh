@@ -11,7 +11,7 @@ Energy for a three-phase, gas+liquid+ice evaluator.
 #define AMANZI_ENERGY_THREE_PHASE_ENERGY_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class ThreePhaseEnergyModel;
 
-class ThreePhaseEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class ThreePhaseEnergyEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -15,7 +15,7 @@ namespace Amanzi {
 namespace Energy {
 
 EnthalpyEvaluator::EnthalpyEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   if (my_key_.empty()) {
 
     my_key_ = plist_.get<std::string>("enthalpy key", "surface-enthalpy_liquid");
@@ -40,7 +40,7 @@ EnthalpyEvaluator::EnthalpyEvaluator(Teuchos::ParameterList& plist) :
 };
 
 EnthalpyEvaluator::EnthalpyEvaluator(const EnthalpyEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pres_key_(other.pres_key_),
     dens_key_(other.dens_key_),
     ie_key_(other.ie_key_),
@@ -15,12 +15,12 @@ FieldEvaluator for enthalpy.
 #include "Teuchos_ParameterList.hpp"
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
 
-class EnthalpyEvaluator : public SecondaryVariableFieldEvaluator {
+class EnthalpyEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
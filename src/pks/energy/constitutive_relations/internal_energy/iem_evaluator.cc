@@ -14,7 +14,7 @@ namespace Energy {
 
 
 IEMEvaluator::IEMEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   AMANZI_ASSERT(plist_.isSublist("IEM parameters"));
   Teuchos::ParameterList sublist = plist_.sublist("IEM parameters");
@@ -26,7 +26,7 @@ IEMEvaluator::IEMEvaluator(Teuchos::ParameterList& plist) :
 
 
 IEMEvaluator::IEMEvaluator(Teuchos::ParameterList& plist, const Teuchos::RCP<IEM>& iem) :
-    SecondaryVariableFieldEvaluator(plist),
+    TimedSecondaryVariableFieldEvaluator(plist),
     iem_(iem) {
 
   InitializeFromPlist_();
@@ -34,7 +34,7 @@ IEMEvaluator::IEMEvaluator(Teuchos::ParameterList& plist, const Teuchos::RCP<IEM
 
 
 IEMEvaluator::IEMEvaluator(const IEMEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     iem_(other.iem_),
     temp_key_(other.temp_key_) {}
 
@@ -11,12 +11,12 @@
 
 #include "Factory.hh"
 #include "iem.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
 
-class IEMEvaluator : public SecondaryVariableFieldEvaluator {
+class IEMEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -12,7 +12,7 @@ namespace Amanzi {
 namespace Energy {
 
 IEMWaterVaporEvaluator::IEMWaterVaporEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   // defaults work fine, this sublist need not exist
   Teuchos::ParameterList sublist = plist.sublist("IEM parameters");
   iem_ = Teuchos::rcp(new IEMWaterVapor(sublist));
@@ -21,13 +21,13 @@ IEMWaterVaporEvaluator::IEMWaterVaporEvaluator(Teuchos::ParameterList& plist) :
 }
 
 IEMWaterVaporEvaluator::IEMWaterVaporEvaluator(Teuchos::ParameterList& plist, const Teuchos::RCP<IEMWaterVapor>& iem) :
-    SecondaryVariableFieldEvaluator(plist),
+    TimedSecondaryVariableFieldEvaluator(plist),
     iem_(iem) {
   InitializeFromPlist_();
 }
 
 IEMWaterVaporEvaluator::IEMWaterVaporEvaluator(const IEMWaterVaporEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     iem_(other.iem_),
     temp_key_(other.temp_key_),
     mol_frac_key_(other.mol_frac_key_) {}
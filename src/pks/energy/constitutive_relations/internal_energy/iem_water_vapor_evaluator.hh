@@ -10,13 +10,13 @@
 #define AMANZI_ENERGY_RELATIONS_IEM_WATER_VAPOR_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "iem_water_vapor.hh"
 
 namespace Amanzi {
 namespace Energy {
 
-class IEMWaterVaporEvaluator : public SecondaryVariableFieldEvaluator {
+class IEMWaterVaporEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -13,13 +13,13 @@ namespace Energy {
 
 // constructor format for all derived classes
 AdvectedEnergySourceEvaluator::AdvectedEnergySourceEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   InitializeFromPlist_();
 }
 
 AdvectedEnergySourceEvaluator::AdvectedEnergySourceEvaluator(const AdvectedEnergySourceEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     internal_enthalpy_key_(other.internal_enthalpy_key_),
     external_enthalpy_key_(other.external_enthalpy_key_),
     mass_source_key_(other.mass_source_key_),
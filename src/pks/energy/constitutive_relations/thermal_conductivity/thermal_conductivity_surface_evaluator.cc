@@ -14,7 +14,7 @@ namespace Energy {
 
 ThermalConductivitySurfaceEvaluator::ThermalConductivitySurfaceEvaluator(
       Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   if (my_key_ == std::string("")) {
     my_key_ = plist_.get<std::string>("thermal conductivity key",
             "surface-thermal_conductivity");
@@ -37,7 +37,7 @@ ThermalConductivitySurfaceEvaluator::ThermalConductivitySurfaceEvaluator(
 
 ThermalConductivitySurfaceEvaluator::ThermalConductivitySurfaceEvaluator(
       const ThermalConductivitySurfaceEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     uf_key_(other.uf_key_),
     height_key_(other.height_key_),
     K_liq_(other.K_liq_),
@@ -10,13 +10,13 @@
 #ifndef AMANZI_ENERGY_RELATIONS_TC_SURFACE_EVALUATOR_HH_
 #define AMANZI_ENERGY_RELATIONS_TC_SURFACE_EVALUATOR_HH_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
 
 class ThermalConductivitySurfaceEvaluator :
-    public SecondaryVariableFieldEvaluator {
+    public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
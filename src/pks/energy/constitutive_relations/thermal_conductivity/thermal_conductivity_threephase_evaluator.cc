@@ -17,7 +17,7 @@ namespace Energy {
 
 ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
     Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   
   if (my_key_ == std::string("")) {
     my_key_ = plist_.get<std::string>("thermal conductivity key", "thermal_conductivity");
@@ -59,7 +59,7 @@ ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
 
 ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
     const ThermalConductivityThreePhaseEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     poro_key_(other.poro_key_),
     temp_key_(other.temp_key_),
     sat_key_(other.sat_key_),
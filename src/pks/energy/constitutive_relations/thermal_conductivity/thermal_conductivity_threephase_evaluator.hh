@@ -10,7 +10,7 @@
 #ifndef AMANZI_ENERGY_RELATIONS_TC_THREEPHASE_EVALUATOR_HH_
 #define AMANZI_ENERGY_RELATIONS_TC_THREEPHASE_EVALUATOR_HH_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "thermal_conductivity_threephase.hh"
 
 namespace Amanzi {
@@ -18,7 +18,7 @@ namespace Energy {
 
 // Equation of State model
 class ThermalConductivityThreePhaseEvaluator :
-    public SecondaryVariableFieldEvaluator {
+    public TimedSecondaryVariableFieldEvaluator {
 
  public:
 
@@ -10,7 +10,7 @@
 #ifndef AMANZI_ENERGY_RELATIONS_TC_TWOPHASE_EVALUATOR_HH_
 #define AMANZI_ENERGY_RELATIONS_TC_TWOPHASE_EVALUATOR_HH_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "thermal_conductivity_twophase.hh"
 
 namespace Amanzi {
@@ -18,7 +18,7 @@ namespace Energy {
 
 // Equation of State model
 class ThermalConductivityTwoPhaseEvaluator :
-    public SecondaryVariableFieldEvaluator {
+    public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -22,7 +22,7 @@ namespace Amanzi {
 namespace Energy {
 
 InterfrostEnergyEvaluator::InterfrostEnergyEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   my_key_ = plist_.get<std::string>("energy key", "energy");
  
   dependencies_.insert(std::string("porosity"));
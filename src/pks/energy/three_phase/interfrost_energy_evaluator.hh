@@ -24,12 +24,12 @@ This is simply the conserved quantity in the energy equation.
 #include "Teuchos_ParameterList.hpp"
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
 
-class InterfrostEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class InterfrostEnergyEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
 public:
   explicit
@@ -12,7 +12,7 @@ namespace Amanzi {
 namespace Flow {
 
 ElevationEvaluator::ElevationEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist),
+    TimedSecondaryVariablesFieldEvaluator(plist),
     updated_once_(false), 
     dynamic_mesh_(false) {
 
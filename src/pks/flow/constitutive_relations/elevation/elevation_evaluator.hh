@@ -14,12 +14,12 @@
 #ifndef AMANZI_FLOWRELATIONS_ELEVATION_EVALUATOR_
 #define AMANZI_FLOWRELATIONS_ELEVATION_EVALUATOR_
 
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class ElevationEvaluator : public SecondaryVariablesFieldEvaluator {
+class ElevationEvaluator : public TimedSecondaryVariablesFieldEvaluator {
 
  public:
   explicit
@@ -21,7 +21,8 @@ ElevationEvaluatorColumn::ElevationEvaluatorColumn(Teuchos::ParameterList& plist
 
 ElevationEvaluatorColumn::ElevationEvaluatorColumn(const ElevationEvaluatorColumn& other) :
   ElevationEvaluator(other),
-  base_por_key_(other.base_por_key_)
+  base_por_key_(other.base_por_key_),
+  col_meshes_(other.col_meshes_)
 {};
 
 Teuchos::RCP<FieldEvaluator>
@@ -51,16 +52,10 @@ void ElevationEvaluatorColumn::EvaluateElevationAndSlope_(const Teuchos::Ptr<Sta
   std::vector<AmanziGeometry::Point> my_centroid;
 
   //get elevation on all cells first
+  AMANZI_ASSERT(col_meshes_.size() == ncells);
   for (int c=0; c !=ncells; c++){
-    std::stringstream my_name;
-    int id = S->GetMesh("surface_star")->cell_map(false).GID(c);
-    my_name << "column_" << id;
-    
-    //int nfaces = S->GetMesh(my_name.str())->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
-    
-    std::vector<AmanziGeometry::Point> coord; 
-    // S->GetMesh(my_name.str())->face_get_coordinates(nfaces-1, &coord);
-    S->GetMesh(my_name.str())->face_get_coordinates(0, &coord); // 0 is the id of top face of the column mesh
+    std::vector<AmanziGeometry::Point> coord;
+    col_meshes_[c]->face_get_coordinates(0, &coord); // 0 is the id of top face of the column mesh
     
     elev_c[0][c] = coord[0][2];
   }
@@ -74,8 +69,6 @@ void ElevationEvaluatorColumn::EvaluateElevationAndSlope_(const Teuchos::Ptr<Sta
 
     //get all cell centroids
     for (int c=0; c!=ncells; ++c) {
-      std::stringstream my_name;
-      int id = S->GetMesh("surface_star")->cell_map(true).GID(c);
       AmanziGeometry::Point P1 = S->GetMesh("surface_star")->cell_centroid(c);
       P1.set(P1[0], P1[1], elev_ngb_c[0][c]);
       my_centroid.push_back(P1);
@@ -97,11 +90,7 @@ void ElevationEvaluatorColumn::EvaluateElevationAndSlope_(const Teuchos::Ptr<Sta
         ngb_centroids[i].set(P2[0], P2[1], elev_ngb_c[0][nadj_cellids[i]]);
       }
 
-    
-      std::stringstream my_name;
-      int id = S->GetMesh("surface_star")->cell_map(false).GID(c);
-      my_name << "column_" << id;
-      
+
       std::vector<AmanziGeometry::Point> Normal;
       AmanziGeometry::Point N, PQ, PR, Nor_avg(3);
       
@@ -115,7 +104,7 @@ void ElevationEvaluatorColumn::EvaluateElevationAndSlope_(const Teuchos::Ptr<Sta
 	  Normal.push_back(N);
 	}
 
-        AmanziGeometry::Point fnor = S->GetMesh(my_name.str())->face_normal(0); //0 is the id of top face
+        AmanziGeometry::Point fnor = col_meshes_[c]->face_normal(0); //0 is the id of top face
 	Nor_avg = (nface_pcell - Normal.size()) * fnor; 
 	for (int i=0; i <Normal.size(); i++)
 	  Nor_avg += Normal[i];
@@ -167,19 +156,23 @@ void ElevationEvaluatorColumn::EnsureCompatibility(const Teuchos::Ptr<State>& S)
 
   int ncells = S->GetMesh("surface_star")->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
  
-  if (domain == "surface_star") {
-    for (int c =0; c < ncells; c++){
-      std::stringstream name;
-      int id = S->GetMesh("surface_star")->cell_map(false).GID(c);
-      name << "column_"<< id;
-      base_por_key_ = Keys::readKey(plist_, name.str(), "base porosity", "base_porosity");
-      dependencies_.insert(base_por_key_);
-    }
-  } else {
+  if (domain != "surface_star") {
     Errors::Message msg("ElevationEvaluatorColumn: this evaluator should be used for columnar meshes only.");
     Exceptions::amanzi_throw(msg);
   }
 
+  // resolve the column meshes for every surface_star cell, as the elevation
+  // of each is read in EvaluateElevationAndSlope_
+  col_meshes_.resize(ncells);
+  for (int c =0; c < ncells; c++){
+    std::stringstream name;
+    int id = S->GetMesh("surface_star")->cell_map(false).GID(c);
+    name << "column_"<< id;
+    col_meshes_[c] = S->GetMesh(name.str());
+    base_por_key_ = Keys::readKey(plist_, name.str(), "base porosity", "base_porosity");
+    dependencies_.insert(base_por_key_);
+  }
+
   ElevationEvaluator::EnsureCompatibility(S.ptr());
 }
 } //namespace
@@ -57,6 +57,9 @@ class ElevationEvaluatorColumn : public ElevationEvaluator {
   static Utils::RegisteredFactory<FieldEvaluator,ElevationEvaluatorColumn> reg_;
 
   Key slope_key_, base_por_key_;
+
+  // column meshes, in surface_star cell order, resolved in EnsureCompatibility
+  std::vector<Teuchos::RCP<const AmanziMesh::Mesh> > col_meshes_;
 };
 
 } //namespace
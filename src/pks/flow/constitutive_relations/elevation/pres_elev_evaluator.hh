@@ -32,12 +32,12 @@ NOTE: This could easily be replaced by a generic AdditiveEvaluator_
 #ifndef AMANZI_FLOWRELATIONS_PRES_ELEV_EVALUATOR_
 #define AMANZI_FLOWRELATIONS_PRES_ELEV_EVALUATOR_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class PresElevEvaluator : public SecondaryVariableFieldEvaluator {
+class PresElevEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
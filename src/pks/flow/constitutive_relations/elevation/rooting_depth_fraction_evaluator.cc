@@ -15,6 +15,7 @@ an artificial cutoff is generated.
 
 #include "rooting_depth_fraction_evaluator.hh"
 #include "rooting_depth_fraction_model.hh"
+#include "ColumnGeometry.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -22,7 +23,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 RootingDepthFractionEvaluator::RootingDepthFractionEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   if (!plist_.isSublist("rooting_depth_fraction parameters")) {
     Errors::Message message("RootingDepthFractionEvaluator: changed spec -- now must be list of models to match list of PFTs.");
@@ -42,7 +43,7 @@ RootingDepthFractionEvaluator::RootingDepthFractionEvaluator(Teuchos::ParameterL
 
 // Copy constructor
 RootingDepthFractionEvaluator::RootingDepthFractionEvaluator(const RootingDepthFractionEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     z_key_(other.z_key_),    
     cv_key_(other.cv_key_),    
     surf_cv_key_(other.surf_cv_key_),    
@@ -99,18 +100,22 @@ RootingDepthFractionEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& cv = *S->GetFieldData(cv_key_)->ViewComponent("cell", false);
   const Epetra_MultiVector& surf_cv = *S->GetFieldData(surf_cv_key_)->ViewComponent("cell", false);
   Epetra_MultiVector& result_v = *result->ViewComponent("cell", false);
-  auto& subsurf_mesh = *result->Mesh();
+  const Operators::ColumnGeometry& cols = *Operators::ColumnGeometry::Get(result->Mesh());
 
   for (int pft=0; pft!=models_.size(); ++pft) {
     for (int sc=0; sc!=surf_cv.MyLength(); ++sc) {
+      const int* col_cells = cols.cells(sc);
+      int ncol_cells = cols.num_cells(sc);
       double column_total = 0.;
       double f_root_total = 0.;
-      for (auto c : subsurf_mesh.cells_of_column(sc)) {
+      for (int i=0; i!=ncol_cells; ++i) {
+        int c = col_cells[i];
         result_v[pft][c] = models_[pft]->RootingDepthFraction(z[0][c]);
         column_total += result_v[pft][c] * cv[0][c];
       }
       
-      for (auto c : subsurf_mesh.cells_of_column(sc)) {
+      for (int i=0; i!=ncol_cells; ++i) {
+        int c = col_cells[i];
         result_v[pft][c] = result_v[pft][c] * 1.0 * surf_cv[0][sc] / column_total;  // normalize to 1
       }
     }
@@ -20,7 +20,7 @@ an artificial cutoff is generated.
 #define AMANZI_FLOW_ROOTING_DEPTH_FRACTION_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -28,7 +28,7 @@ namespace Relations {
 
 class RootingDepthFractionModel;
 
-class RootingDepthFractionEvaluator : public SecondaryVariableFieldEvaluator {
+class RootingDepthFractionEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
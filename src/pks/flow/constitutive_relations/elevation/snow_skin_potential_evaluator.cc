@@ -13,7 +13,7 @@ namespace Amanzi {
 namespace Flow {
 
 SnowSkinPotentialEvaluator::SnowSkinPotentialEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   Key domain = Keys::getDomain(my_key_);
   Key surf_domain;
@@ -43,7 +43,7 @@ SnowSkinPotentialEvaluator::SnowSkinPotentialEvaluator(Teuchos::ParameterList& p
 
 
 SnowSkinPotentialEvaluator::SnowSkinPotentialEvaluator(const SnowSkinPotentialEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     elev_key_(other.elev_key_),
     pd_key_(other.pd_key_),
     sd_key_(other.sd_key_),
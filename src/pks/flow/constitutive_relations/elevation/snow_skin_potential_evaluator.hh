@@ -39,13 +39,13 @@ Example:
 #ifndef AMANZI_FLOWRELATIONS_SNOW_SKIN_POTENTIAL_EVALUATOR_
 #define AMANZI_FLOWRELATIONS_SNOW_SKIN_POTENTIAL_EVALUATOR_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class SnowSkinPotentialEvaluator : public SecondaryVariableFieldEvaluator {
+class SnowSkinPotentialEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -7,7 +7,7 @@ namespace Flow {
 namespace FlowRelations {
 
 FractionalConductanceEvaluator::FractionalConductanceEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   Key domain = Keys::getDomain(my_key_);
 
@@ -29,7 +29,7 @@ FractionalConductanceEvaluator::FractionalConductanceEvaluator(Teuchos::Paramete
 
 
 FractionalConductanceEvaluator::FractionalConductanceEvaluator(const FractionalConductanceEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pdd_key_(other.pdd_key_),
     vpd_key_(other.vpd_key_),
     delta_ex_key_(other.delta_ex_key_),
@@ -17,13 +17,13 @@
 #define AMANZI_FLOWRELATIONS_FRACTIONAL_CONDUCTANCE_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 namespace FlowRelations {
 
-class FractionalConductanceEvaluator : public SecondaryVariableFieldEvaluator {
+class FractionalConductanceEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -17,7 +17,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 ManningCoefficientLitterEvaluator::ManningCoefficientLitterEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("manning coefficient parameters");
   models_ = createManningCoefPartition(sublist);
@@ -27,7 +27,7 @@ ManningCoefficientLitterEvaluator::ManningCoefficientLitterEvaluator(Teuchos::Pa
 
 // Copy constructor
 ManningCoefficientLitterEvaluator::ManningCoefficientLitterEvaluator(const ManningCoefficientLitterEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     ld_key_(other.ld_key_),
     pd_key_(other.pd_key_),    
     models_(other.models_) {}
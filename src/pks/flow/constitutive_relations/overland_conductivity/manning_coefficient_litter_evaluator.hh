@@ -13,7 +13,7 @@ Manning's coefficient that varies based on litter thickness and ponded depth.
 #include "Teuchos_RCP.hpp"
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -25,7 +25,7 @@ typedef std::vector<Teuchos::RCP<ManningCoefficientLitterModel> > ManningCoefLis
 typedef std::pair<Teuchos::RCP<Functions::MeshPartition>, ManningCoefList> ManningCoefPartition;
 
   
-class ManningCoefficientLitterEvaluator : public SecondaryVariableFieldEvaluator {
+class ManningCoefficientLitterEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
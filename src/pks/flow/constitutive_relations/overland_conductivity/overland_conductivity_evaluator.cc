@@ -16,7 +16,7 @@ namespace Amanzi {
 namespace Flow {
 
 OverlandConductivityEvaluator::OverlandConductivityEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   Key domain = Keys::getDomain(my_key_);
 
   if (plist_.isParameter("height key") || plist_.isParameter("ponded depth key")
@@ -84,7 +84,7 @@ OverlandConductivityEvaluator::OverlandConductivityEvaluator(Teuchos::ParameterL
 
 
 OverlandConductivityEvaluator::OverlandConductivityEvaluator(const OverlandConductivityEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     depth_key_(other.depth_key_),
     slope_key_(other.slope_key_),
     coef_key_(other.coef_key_),
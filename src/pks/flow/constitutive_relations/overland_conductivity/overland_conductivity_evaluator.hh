@@ -10,14 +10,14 @@
 #define AMANZI_FLOWRELATIONS_OVERLAND_CONDUCTIVITY_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
 class OverlandConductivityModel;
 
-class OverlandConductivityEvaluator : public SecondaryVariableFieldEvaluator {
+class OverlandConductivityEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   OverlandConductivityEvaluator(Teuchos::ParameterList& plist);
@@ -7,7 +7,7 @@ namespace Flow {
 namespace FlowRelations {
 
 SubgridManningCoefficientEvaluator::SubgridManningCoefficientEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   Key domain = Keys::getDomain(my_key_);
   mann_key_ = Keys::readKey(plist_, domain, "manning coefficient", "manning_coefficient");
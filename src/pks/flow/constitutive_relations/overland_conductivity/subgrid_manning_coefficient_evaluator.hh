@@ -17,13 +17,13 @@
 #define AMANZI_FLOWRELATIONS_SUBGRID_MANNING_COEF_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 namespace FlowRelations {
 
-class SubgridManningCoefficientEvaluator : public SecondaryVariableFieldEvaluator {
+class SubgridManningCoefficientEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Amanzi {
 namespace Flow {
 
 SurfaceRelPermEvaluator::SurfaceRelPermEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   // create the model
   SurfaceRelPermModelFactory fac;
   model_ = fac.createModel(plist_.sublist("surface rel perm model"));
@@ -43,7 +43,7 @@ SurfaceRelPermEvaluator::SurfaceRelPermEvaluator(Teuchos::ParameterList& plist)
 
 
 SurfaceRelPermEvaluator::SurfaceRelPermEvaluator(const SurfaceRelPermEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     is_temp_(other.is_temp_),
     uf_key_(other.uf_key_),
     h_key_(other.h_key_),
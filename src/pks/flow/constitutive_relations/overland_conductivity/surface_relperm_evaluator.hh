@@ -10,7 +10,7 @@
 #define AMANZI_FLOWRELATIONS_SURFACE_KR_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "surface_relperm_model.hh"
 
 namespace Amanzi {
@@ -18,7 +18,7 @@ namespace Flow {
 
 class SurfaceRelPermModel;
 
-class SurfaceRelPermEvaluator : public SecondaryVariableFieldEvaluator {
+class SurfaceRelPermEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   SurfaceRelPermEvaluator(Teuchos::ParameterList& plist);
@@ -12,7 +12,7 @@ namespace Amanzi {
 namespace Flow {
 
 UnfrozenEffectiveDepthEvaluator::UnfrozenEffectiveDepthEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   Key domain = Keys::getDomain(my_key_);
 
@@ -10,14 +10,14 @@
 #define AMANZI_FLOWRELATIONS_UNFROZEN_EFFECTIVE_DEPTH_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
 class UnfrozenEffectiveDepthModel;
 
-class UnfrozenEffectiveDepthEvaluator : public SecondaryVariableFieldEvaluator {
+class UnfrozenEffectiveDepthEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Amanzi {
 namespace Flow {
 
 UnfrozenFractionEvaluator::UnfrozenFractionEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   Key domain = Keys::getDomain(my_key_);
 
@@ -33,7 +33,7 @@ UnfrozenFractionEvaluator::UnfrozenFractionEvaluator(Teuchos::ParameterList& pli
 
 
 UnfrozenFractionEvaluator::UnfrozenFractionEvaluator(const UnfrozenFractionEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     temp_key_(other.temp_key_),
     model_(other.model_) {}
 
@@ -10,14 +10,14 @@
 #define AMANZI_FLOWRELATIONS_UNFROZEN_FRACTION_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
 class UnfrozenFractionModel;
 
-class UnfrozenFractionEvaluator : public SecondaryVariableFieldEvaluator {
+class UnfrozenFractionEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   UnfrozenFractionEvaluator(Teuchos::ParameterList& plist);
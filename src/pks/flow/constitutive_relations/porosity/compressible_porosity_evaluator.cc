@@ -13,7 +13,7 @@ namespace Amanzi {
 namespace Flow {
 
 CompressiblePorosityEvaluator::CompressiblePorosityEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   std::string domain_name=Keys::getDomain(my_key_);
   pres_key_ = plist_.get<std::string>("pressure key", Keys::getKey(domain_name, "pressure"));
   dependencies_.insert(pres_key_);
@@ -34,7 +34,7 @@ CompressiblePorosityEvaluator::CompressiblePorosityEvaluator(Teuchos::ParameterL
 
 
 CompressiblePorosityEvaluator::CompressiblePorosityEvaluator(const CompressiblePorosityEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pres_key_(other.pres_key_),
     poro_key_(other.poro_key_),
     models_(other.models_) {}
@@ -14,13 +14,13 @@
 #define AMANZI_FLOWRELATIONS_COMPRESSIBLE_POROSITY_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "compressible_porosity_model_partition.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class CompressiblePorosityEvaluator : public SecondaryVariableFieldEvaluator {
+class CompressiblePorosityEvaluator : public TimedSecondaryVariableFieldEvaluator {
  public:
   explicit
   CompressiblePorosityEvaluator(Teuchos::ParameterList& plist);
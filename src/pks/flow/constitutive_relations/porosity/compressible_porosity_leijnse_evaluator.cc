@@ -13,7 +13,7 @@ namespace Amanzi {
 namespace Flow {
 
 CompressiblePorosityLeijnseEvaluator::CompressiblePorosityLeijnseEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   
   std::string domain_name=Keys::getDomain(my_key_);
   pres_key_ = plist_.get<std::string>("pressure key", Keys::getKey(domain_name, "pressure"));
@@ -33,7 +33,7 @@ CompressiblePorosityLeijnseEvaluator::CompressiblePorosityLeijnseEvaluator(Teuch
 
 
 CompressiblePorosityLeijnseEvaluator::CompressiblePorosityLeijnseEvaluator(const CompressiblePorosityLeijnseEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pres_key_(other.pres_key_),
     poro_key_(other.poro_key_),
     models_(other.models_) {}
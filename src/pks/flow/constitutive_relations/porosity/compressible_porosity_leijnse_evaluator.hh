@@ -15,13 +15,13 @@
 #define AMANZI_FLOWRELATIONS_COMPRESSIBLE_POROSITY_LEIJNSE_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "compressible_porosity_leijnse_model_partition.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class CompressiblePorosityLeijnseEvaluator : public SecondaryVariableFieldEvaluator {
+class CompressiblePorosityLeijnseEvaluator : public TimedSecondaryVariableFieldEvaluator {
  public:
   explicit
   CompressiblePorosityLeijnseEvaluator(Teuchos::ParameterList& plist);
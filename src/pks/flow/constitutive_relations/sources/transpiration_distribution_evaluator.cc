@@ -4,6 +4,7 @@
 
 #include "Function.hh"
 #include "FunctionFactory.hh"
+#include "ColumnGeometry.hh"
 #include "transpiration_distribution_evaluator.hh"
 
 namespace Amanzi {
@@ -12,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 TranspirationDistributionEvaluator::TranspirationDistributionEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   InitializeFromPlist_();
 }
@@ -90,15 +91,18 @@ TranspirationDistributionEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   double p_atm = *S->GetScalarData("atmospheric_pressure");
 
   // result, on the subsurface
-  const AmanziMesh::Mesh& subsurf_mesh = *result->Mesh();
+  const Operators::ColumnGeometry& cols = *Operators::ColumnGeometry::Get(result->Mesh());
   Epetra_MultiVector& result_v = *result->ViewComponent("cell", false);
   
   for (int pft=0; pft!=result_v.NumVectors(); ++pft) {
     for (int sc=0; sc!=trans_total.MyLength(); ++sc) {
+      const int* col_cells = cols.cells(sc);
+      int ncol_cells = cols.num_cells(sc);
       double column_total = 0.;
       double f_root_total = 0.;
       double f_wp_total = 0.;
-      for (auto c : subsurf_mesh.cells_of_column(sc)) {
+      for (int i=0; i!=ncol_cells; ++i) {
+        int c = col_cells[i];
         column_total += f_wp[0][c] * f_root[pft][c] * cv[0][c];
         result_v[pft][c] = f_wp[0][c] * f_root[pft][c];
       }
@@ -117,7 +121,8 @@ TranspirationDistributionEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
           coef *= limiting_factor;
         }
         
-        for (auto c : subsurf_mesh.cells_of_column(sc)) {
+        for (int i=0; i!=ncol_cells; ++i) {
+          int c = col_cells[i];
           result_v[pft][c] = result_v[pft][c] * coef;
           if (limiter_local_) {
             result_v[pft][c] *= f_wp[0][c];
@@ -128,7 +133,8 @@ TranspirationDistributionEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 // THIS ENFORCES no limiter
 // #ifdef ENABLE_DBC
 //       double new_col_total = 0.;
-//       for (auto c : subsurf_mesh.cells_of_column(sc)) {
+//       for (int i=0; i!=ncol_cells; ++i) {
+//         int c = col_cells[i];
 //         new_col_total += result_v[pft][c] * cv[0][c];
 //       }
 //       AMANZI_ASSERT(std::abs(new_col_total - trans_total[pft][sc]*surf_cv[0][sc]) < 1.e-8);
@@ -12,7 +12,7 @@ Distributes transpiration based upon a rooting depth and a wilting-point water-p
 #define AMANZI_FLOW_TRANSPIRATION_DISTRIBUTION_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 
@@ -21,7 +21,7 @@ class Function;
 namespace Flow {
 namespace Relations {
 
-class TranspirationDistributionEvaluator : public SecondaryVariableFieldEvaluator {
+class TranspirationDistributionEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -14,7 +14,7 @@ namespace Flow {
   
 
 MaxThawDepthEvaluator::MaxThawDepthEvaluator(Teuchos::ParameterList& plist) :
-   SecondaryVariableFieldEvaluator(plist){
+   TimedSecondaryVariableFieldEvaluator(plist){
   threshold_td_ = plist_.get<double>("threshold value", 0.4);
 
   std::string domain_name=Keys::getDomain(my_key_);
@@ -25,7 +25,7 @@ MaxThawDepthEvaluator::MaxThawDepthEvaluator(Teuchos::ParameterList& plist) :
 
   
 MaxThawDepthEvaluator::MaxThawDepthEvaluator(const MaxThawDepthEvaluator& other) :
-  SecondaryVariableFieldEvaluator(other),
+  TimedSecondaryVariableFieldEvaluator(other),
     td_key_(other.td_key_),
     threshold_td_(other.threshold_td_){}
 
@@ -11,12 +11,12 @@
 
 #include "Factory.hh"
 //#include "thaw_depth_evaluator.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class MaxThawDepthEvaluator : public SecondaryVariableFieldEvaluator {
+class MaxThawDepthEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
 public:
   explicit
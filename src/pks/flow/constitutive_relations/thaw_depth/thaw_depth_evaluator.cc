@@ -15,7 +15,7 @@ namespace Flow {
 
 
 ThawDepthEvaluator::ThawDepthEvaluator(Teuchos::ParameterList& plist)
-    : SecondaryVariableFieldEvaluator(plist)
+    : TimedSecondaryVariableFieldEvaluator(plist)
 {
   std::string domain_name=Keys::getDomain(my_key_);
   my_key_ = plist_.get<std::string>("thaw depth key", Keys::getKey(domain_name, "thaw_depth"));
@@ -23,7 +23,9 @@ ThawDepthEvaluator::ThawDepthEvaluator(Teuchos::ParameterList& plist)
   
 
 ThawDepthEvaluator::ThawDepthEvaluator(const ThawDepthEvaluator& other)
-    : SecondaryVariableFieldEvaluator(other)
+    : TimedSecondaryVariableFieldEvaluator(other),
+      temp_keys_(other.temp_keys_),
+      col_meshes_(other.col_meshes_)
 {}
   
 Teuchos::RCP<FieldEvaluator>
@@ -40,21 +42,18 @@ ThawDepthEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
   
   int ncells = res_c.MyLength();
+  AMANZI_ASSERT(col_meshes_.size() == ncells);
   for (int c=0; c!=ncells; c++){
-    int id = S->GetMesh("surface_star")->cell_map(false).GID(c);
-    std::stringstream domain;
-    domain << "column_" << id;
-
-    const auto& top_z_centroid = S->GetMesh(domain.str())->face_centroid(0);
+    const AmanziMesh::Mesh& col_mesh = *col_meshes_[c];
+    const auto& top_z_centroid = col_mesh.face_centroid(0);
     AmanziGeometry::Point z_centroid(top_z_centroid);
 
     // search through the column and find the deepest unfrozen cell
-    const auto& temp_c = *S->GetFieldData(Keys::getKey(domain.str(),"temperature"))
-                         ->ViewComponent("cell", false);
+    const auto& temp_c = *S->GetFieldData(temp_keys_[c])->ViewComponent("cell", false);
     int col_cells = temp_c.MyLength();
     for (int i=0; i!=col_cells; ++i) {
       if (temp_c[0][i] >= 273.25) { // this hard codes in the transition width to 0.2 K
-        z_centroid = S->GetMesh(domain.str())->face_centroid(i+1);
+        z_centroid = col_mesh.face_centroid(i+1);
       }
     }
     
@@ -92,15 +91,18 @@ ThawDepthEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
   int ncells = S->GetMesh("surface_star")->num_entities(AmanziMesh::CELL,
           AmanziMesh::Parallel_type::OWNED);
   
-  if (domain == "surface_star") {
-    for (int c =0; c < ncells; c++){
-      std::stringstream name;
-      int id = S->GetMesh("surface_star")->cell_map(false).GID(c);
-      name << "column_"<< id;
-      Key temp_key = Keys::getKey(name.str(),"temperature");
-      dependencies_.insert(temp_key);
-    }
-  } 
+  // EvaluateField_ reads a column per surface_star cell whatever the domain,
+  // so resolve the columns for every domain
+  temp_keys_.resize(ncells);
+  col_meshes_.resize(ncells);
+  for (int c =0; c < ncells; c++){
+    std::stringstream name;
+    int id = S->GetMesh("surface_star")->cell_map(false).GID(c);
+    name << "column_"<< id;
+    temp_keys_[c] = Keys::getKey(name.str(),"temperature");
+    col_meshes_[c] = S->GetMesh(name.str());
+    if (domain == "surface_star") dependencies_.insert(temp_keys_[c]);
+  }
   
   // Ensure my field exists.  Requirements should be already set.
   AMANZI_ASSERT(my_key_ != std::string(""));
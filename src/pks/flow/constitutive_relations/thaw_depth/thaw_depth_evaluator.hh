@@ -12,12 +12,12 @@
 #define AMANZI_FLOWRELATIONS_THAWDEPTH_EVALUATOR_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class ThawDepthEvaluator : public SecondaryVariableFieldEvaluator {
+class ThawDepthEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
 public:
   explicit
@@ -40,6 +40,10 @@ protected:
 
   bool updated_once_;
 
+  // per-column temperature keys and meshes, resolved in EnsureCompatibility
+  std::vector<Key> temp_keys_;
+  std::vector<Teuchos::RCP<const AmanziMesh::Mesh> > col_meshes_;
+
 private:
   static Utils::RegisteredFactory<FieldEvaluator,ThawDepthEvaluator> reg_;
 
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 InterfrostDenergyDtemperatureEvaluator::InterfrostDenergyDtemperatureEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("interfrost_denergy_dtemperature parameters");
   model_ = Teuchos::rcp(new InterfrostDenergyDtemperatureModel(sublist));
@@ -23,7 +23,7 @@ InterfrostDenergyDtemperatureEvaluator::InterfrostDenergyDtemperatureEvaluator(T
 
 // Copy constructor
 InterfrostDenergyDtemperatureEvaluator::InterfrostDenergyDtemperatureEvaluator(const InterfrostDenergyDtemperatureEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     sl_key_(other.sl_key_),
     nl_key_(other.nl_key_),
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 InterfrostDthetaDpressureEvaluator::InterfrostDthetaDpressureEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("interfrost_dtheta_dpressure parameters");
   model_ = Teuchos::rcp(new InterfrostDthetaDpressureModel(sublist));
@@ -23,7 +23,7 @@ InterfrostDthetaDpressureEvaluator::InterfrostDthetaDpressureEvaluator(Teuchos::
 
 // Copy constructor
 InterfrostDthetaDpressureEvaluator::InterfrostDthetaDpressureEvaluator(const InterfrostDthetaDpressureEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     nl_key_(other.nl_key_),
     sl_key_(other.sl_key_),
     phi_key_(other.phi_key_),    
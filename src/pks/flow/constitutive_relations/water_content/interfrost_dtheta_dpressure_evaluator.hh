@@ -11,7 +11,7 @@ Interfrost water content portion sl.
 #define AMANZI_FLOW_INTERFROST_DTHETA_DPRESSURE_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class InterfrostDthetaDpressureModel;
 
-class InterfrostDthetaDpressureEvaluator : public SecondaryVariableFieldEvaluator {
+class InterfrostDthetaDpressureEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 InterfrostSlWcEvaluator::InterfrostSlWcEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("interfrost_sl_wc parameters");
   model_ = Teuchos::rcp(new InterfrostSlWcModel(sublist));
@@ -23,7 +23,7 @@ InterfrostSlWcEvaluator::InterfrostSlWcEvaluator(Teuchos::ParameterList& plist)
 
 // Copy constructor
 InterfrostSlWcEvaluator::InterfrostSlWcEvaluator(const InterfrostSlWcEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     sl_key_(other.sl_key_),
     nl_key_(other.nl_key_),
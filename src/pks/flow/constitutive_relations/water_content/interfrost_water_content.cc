@@ -20,7 +20,7 @@ namespace Flow {
 namespace Relations {
 
 InterfrostWaterContent::InterfrostWaterContent(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   my_key_ = std::string("water_content");
 
   dependencies_.insert(std::string("porosity"));
@@ -20,13 +20,13 @@ it needs a special evaluator.
 #include "Teuchos_ParameterList.hpp"
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
 
-class InterfrostWaterContent : public SecondaryVariableFieldEvaluator {
+class InterfrostWaterContent : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 LiquidGasWaterContentEvaluator::LiquidGasWaterContentEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("liquid_gas_water_content parameters");
   model_ = Teuchos::rcp(new LiquidGasWaterContentModel(sublist));
@@ -23,7 +23,7 @@ LiquidGasWaterContentEvaluator::LiquidGasWaterContentEvaluator(Teuchos::Paramete
 
 // Copy constructor
 LiquidGasWaterContentEvaluator::LiquidGasWaterContentEvaluator(const LiquidGasWaterContentEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     sl_key_(other.sl_key_),
     nl_key_(other.nl_key_),
@@ -11,7 +11,7 @@ Water content for a two-phase, liquid+water vapor evaluator.
 #define AMANZI_FLOW_LIQUID_GAS_WATER_CONTENT_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class LiquidGasWaterContentModel;
 
-class LiquidGasWaterContentEvaluator : public SecondaryVariableFieldEvaluator {
+class LiquidGasWaterContentEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 LiquidIceWaterContentEvaluator::LiquidIceWaterContentEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("liquid_ice_water_content parameters");
   model_ = Teuchos::rcp(new LiquidIceWaterContentModel(sublist));
@@ -23,7 +23,7 @@ LiquidIceWaterContentEvaluator::LiquidIceWaterContentEvaluator(Teuchos::Paramete
 
 // Copy constructor
 LiquidIceWaterContentEvaluator::LiquidIceWaterContentEvaluator(const LiquidIceWaterContentEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     sl_key_(other.sl_key_),
     nl_key_(other.nl_key_),
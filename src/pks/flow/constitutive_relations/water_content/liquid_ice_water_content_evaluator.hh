@@ -11,7 +11,7 @@ Water content for a two-phase, liquid+ice evaluator.
 #define AMANZI_FLOW_LIQUID_ICE_WATER_CONTENT_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class LiquidIceWaterContentModel;
 
-class LiquidIceWaterContentEvaluator : public SecondaryVariableFieldEvaluator {
+class LiquidIceWaterContentEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
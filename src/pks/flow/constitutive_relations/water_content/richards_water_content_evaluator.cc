@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 RichardsWaterContentEvaluator::RichardsWaterContentEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("richards_water_content parameters");
   model_ = Teuchos::rcp(new RichardsWaterContentModel(sublist));
@@ -23,7 +23,7 @@ RichardsWaterContentEvaluator::RichardsWaterContentEvaluator(Teuchos::ParameterL
 
 // Copy constructor
 RichardsWaterContentEvaluator::RichardsWaterContentEvaluator(const RichardsWaterContentEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     sl_key_(other.sl_key_),
     nl_key_(other.nl_key_),
@@ -34,7 +34,7 @@ EVALUATORS:
 #define AMANZI_FLOW_RICHARDS_WATER_CONTENT_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -42,7 +42,7 @@ namespace Relations {
 
 class RichardsWaterContentModel;
 
-class RichardsWaterContentEvaluator : public SecondaryVariableFieldEvaluator {
+class RichardsWaterContentEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -13,7 +13,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 ThreePhaseWaterContentEvaluator::ThreePhaseWaterContentEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("three_phase_water_content parameters");
   model_ = Teuchos::rcp(new ThreePhaseWaterContentModel(sublist));
@@ -23,7 +23,7 @@ ThreePhaseWaterContentEvaluator::ThreePhaseWaterContentEvaluator(Teuchos::Parame
 
 // Copy constructor
 ThreePhaseWaterContentEvaluator::ThreePhaseWaterContentEvaluator(const ThreePhaseWaterContentEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     phi_key_(other.phi_key_),
     sl_key_(other.sl_key_),
     nl_key_(other.nl_key_),
@@ -11,7 +11,7 @@ Water content for a three-phase, gas+liquid+ice evaluator.
 #define AMANZI_FLOW_THREE_PHASE_WATER_CONTENT_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -19,7 +19,7 @@ namespace Relations {
 
 class ThreePhaseWaterContentModel;
 
-class ThreePhaseWaterContentEvaluator : public SecondaryVariableFieldEvaluator {
+class ThreePhaseWaterContentEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -0,0 +1,117 @@
+#include <cmath>
+#include <iostream>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_van_genuchten_reg.hh"
+#include "wrm_tabulated.hh"
+
+using namespace Amanzi::Flow;
+
+struct tabulated_vG {
+  Teuchos::ParameterList plist;
+  Teuchos::RCP<WRMVanGenuchten> vG;
+  double sr, pc_max, s_min;
+  int npoints;
+
+  tabulated_vG() :
+      sr(0.1),
+      pc_max(1.e5),
+      s_min(0.1),
+      npoints(1000) {
+    Teuchos::ParameterList& vG_list = plist.sublist("WRM parameters");
+    vG_list.set("WRM Type", "van Genuchten");
+    vG_list.set("van Genuchten m", 0.5);
+    vG_list.set("van Genuchten alpha", 2.e-4);
+    vG_list.set("residual saturation", sr);
+    vG_list.set("smoothing interval width [saturation]", 0.05);
+    vG = Teuchos::rcp(new WRMVanGenuchten(vG_list));
+
+    Teuchos::Array<double> pc_range(2);
+    pc_range[0] = 0.;
+    pc_range[1] = pc_max;
+    plist.set("capillary pressure range [Pa]", pc_range);
+    plist.set("number of points", npoints);
+  }
+
+  double pc_node(int i) { return i * pc_max / (npoints-1); }
+  double s_node(int i) { return s_min + i * (1.0 - s_min) / (npoints-1); }
+};
+
+
+// Values at the table nodes are those of the tabulated model.
+TEST_FIXTURE(tabulated_vG, TabulatedWRMNodes) {
+  WRMTabulated tab(plist);
+  for (int i=0; i!=npoints; ++i) {
+    CHECK_CLOSE(vG->saturation(pc_node(i)), tab.saturation(pc_node(i)), 1.e-12);
+    CHECK_CLOSE(vG->k_relative(s_node(i)), tab.k_relative(s_node(i)), 1.e-12);
+  }
+  CHECK_EQUAL(1.0, tab.saturation(0.));
+  CHECK_EQUAL(1.0, tab.k_relative(1.0));
+  CHECK_EQUAL(vG->residualSaturation(), tab.residualSaturation());
+}
+
+
+// Values and derivatives at midpoints between nodes.  The end intervals
+// use one-sided slopes, and k_relative has a kink in its second derivative
+// where its smoothing interval starts, so those are checked more loosely.
+TEST_FIXTURE(tabulated_vG, TabulatedWRMMidpoints) {
+  WRMTabulated tab(plist);
+  for (int i=0; i!=npoints-1; ++i) {
+    bool end = i == 0 || i == npoints-2;
+
+    double pc = 0.5 * (pc_node(i) + pc_node(i+1));
+    CHECK_CLOSE(vG->saturation(pc), tab.saturation(pc), end ? 1.e-4 : 1.e-6);
+    if (!end) CHECK_CLOSE(vG->d_saturation(pc), tab.d_saturation(pc), 1.e-7);
+
+    double s = 0.5 * (s_node(i) + s_node(i+1));
+    CHECK_CLOSE(vG->k_relative(s), tab.k_relative(s), end ? 1.e-4 : 5.e-5);
+    if (!end) {
+      double dkr = vG->d_k_relative(s);
+      CHECK_CLOSE(dkr, tab.d_k_relative(s), 1.e-2 * std::max(1., std::abs(dkr)));
+    }
+  }
+}
+
+
+// Saturation decreases with capillary pressure, and relative permeability
+// increases with saturation, between the nodes as well.
+TEST_FIXTURE(tabulated_vG, TabulatedWRMMonotone) {
+  WRMTabulated tab(plist);
+  int nsamples = 10 * npoints;
+
+  double last = tab.saturation(0.);
+  for (int i=1; i<=nsamples; ++i) {
+    double sat = tab.saturation(i * pc_max / nsamples);
+    CHECK(sat <= last + 1.e-14);
+    last = sat;
+  }
+
+  last = tab.k_relative(s_min);
+  for (int i=1; i<=nsamples; ++i) {
+    double kr = tab.k_relative(s_min + i * (1.0 - s_min) / nsamples);
+    CHECK(kr >= last - 1.e-14);
+    last = kr;
+  }
+}
+
+
+// Outside the tables the wrapped model is evaluated.
+TEST_FIXTURE(tabulated_vG, TabulatedWRMOutOfRange) {
+  Teuchos::Array<double> s_range(2);
+  s_range[0] = 0.5;
+  s_range[1] = 1.0;
+  plist.set("saturation range [-]", s_range);
+  WRMTabulated tab(plist);
+
+  CHECK_EQUAL(vG->saturation(-1000.), tab.saturation(-1000.));
+  CHECK_EQUAL(vG->d_saturation(-1000.), tab.d_saturation(-1000.));
+  CHECK_EQUAL(vG->saturation(3.*pc_max), tab.saturation(3.*pc_max));
+  CHECK_EQUAL(vG->d_saturation(3.*pc_max), tab.d_saturation(3.*pc_max));
+  CHECK_EQUAL(vG->k_relative(0.3), tab.k_relative(0.3));
+  CHECK_EQUAL(vG->d_k_relative(0.3), tab.d_k_relative(0.3));
+
+  // capillary pressure is never tabulated
+  CHECK_EQUAL(vG->capillaryPressure(0.7), tab.capillaryPressure(0.7));
+  CHECK_EQUAL(vG->d_capillaryPressure(0.7), tab.d_capillaryPressure(0.7));
+}
@@ -1,4 +1,6 @@
+#include <cmath>
 #include <iostream>
+#include <vector>
 #include "UnitTest++.h"
 
 #include "wrm_van_genuchten.hh"
@@ -59,3 +61,81 @@ TEST(vanGenuchten) {
   CHECK_CLOSE(vG.d_capillaryPressure( vG.saturation(pc) ),
               1.0 / vG.d_saturation(pc), 1.);
 }
+
+
+// The batched methods match the scalar ones, including in the saturated
+// and regularized intervals, and give no NaNs at or below residual
+// saturation or for pc <= 0.
+TEST(vanGenuchtenBatched) {
+  using namespace Amanzi::Flow;
+
+  double sr = 0.4;
+  for (int smoothed=0; smoothed!=2; ++smoothed) {
+    Teuchos::ParameterList plist;
+    plist.set("van Genuchten m", 0.5);
+    plist.set("van Genuchten alpha", 0.1);
+    plist.set("residual saturation", sr);
+    plist.set("smoothing interval width [saturation]", smoothed ? 0.05 : 0.0);
+    WRMVanGenuchten vG(plist);
+
+    // called through the base class, as the evaluators do
+    WRM& wrm = vG;
+
+    const int n = 41;
+    std::vector<double> pc(n), s(n), out(n);
+    for (int i=0; i!=n; ++i) pc[i] = -100. + 10. * i * i;
+
+    wrm.saturation(&pc[0], &out[0], n);
+    for (int i=0; i!=n; ++i) {
+      CHECK(!std::isnan(out[i]));
+      CHECK_CLOSE(vG.saturation(pc[i]), out[i], 1e-14);
+    }
+
+    wrm.d_saturation(&pc[0], &out[0], n);
+    for (int i=0; i!=n; ++i) {
+      CHECK(!std::isnan(out[i]));
+      CHECK_CLOSE(vG.d_saturation(pc[i]), out[i], 1e-14);
+    }
+
+    // saturations from residual to 1
+    for (int i=0; i!=n; ++i) s[i] = sr + (1.0 - sr) * i / (n-1);
+
+    wrm.k_relative(&s[0], &out[0], n);
+    for (int i=0; i!=n; ++i) {
+      CHECK(!std::isnan(out[i]));
+      CHECK_CLOSE(vG.k_relative(s[i]), out[i], 1e-14);
+    }
+
+    wrm.d_k_relative(&s[0], &out[0], n);
+    CHECK_EQUAL(0.0, out[0]);
+    for (int i=1; i!=n; ++i) {
+      CHECK(!std::isnan(out[i]));
+      CHECK_CLOSE(vG.d_k_relative(s[i]), out[i], 1e-12 * (1. + std::abs(out[i])));
+    }
+
+    // below residual saturation the closed form is clamped
+    double s_dry = sr - 0.1;
+    wrm.k_relative(&s_dry, &out[0], 1);
+    CHECK_EQUAL(0.0, out[0]);
+    wrm.d_k_relative(&s_dry, &out[0], 1);
+    CHECK_EQUAL(0.0, out[0]);
+  }
+}
+
+
+// Derived models keep the batched methods next to their scalar overrides.
+TEST(WRMBatchedNotHidden) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten m", 0.5);
+  plist.set("van Genuchten alpha", 0.1);
+  plist.set("residual saturation", 0.4);
+  WRMVanGenuchten vG(plist);
+
+  double pc[2] = { -1., 1.e4 };
+  double s[2];
+  vG.saturation(pc, s, 2);
+  CHECK_EQUAL(1.0, s[0]);
+  CHECK_CLOSE(vG.saturation(pc[1]), s[1], 1e-14);
+}
@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Flow {
 
 PCIceEvaluator::PCIceEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   // my keys
   if (my_key_ == std::string("")) {
@@ -43,7 +43,7 @@ PCIceEvaluator::PCIceEvaluator(Teuchos::ParameterList& plist) :
 
 
 PCIceEvaluator::PCIceEvaluator(const PCIceEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     model_(other.model_),
     temp_key_(other.temp_key_),
     dens_key_(other.dens_key_) {}
@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Flow {
 
 PCLiquidEvaluator::PCLiquidEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   // my keys
   if (my_key_.empty()) {
@@ -39,7 +39,7 @@ PCLiquidEvaluator::PCLiquidEvaluator(Teuchos::ParameterList& plist) :
 
 
 PCLiquidEvaluator::PCLiquidEvaluator(const PCLiquidEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     model_(other.model_),
     pres_key_(other.pres_key_),
     p_atm_key_(other.p_atm_key_) {}
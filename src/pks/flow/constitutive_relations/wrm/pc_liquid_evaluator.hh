@@ -10,7 +10,7 @@
 #ifndef AMANZI_RELATIONS_PC_LIQUID_EVALUATOR_HH_
 #define AMANZI_RELATIONS_PC_LIQUID_EVALUATOR_HH_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
@@ -18,7 +18,7 @@ namespace Flow {
 
 class PCLiqAtm;
 
-class PCLiquidEvaluator : public SecondaryVariableFieldEvaluator {
+class PCLiquidEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
 
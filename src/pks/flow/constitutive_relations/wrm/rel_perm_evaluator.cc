@@ -12,7 +12,7 @@ namespace Amanzi {
 namespace Flow {
 
 RelPermEvaluator::RelPermEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist),
+    TimedSecondaryVariableFieldEvaluator(plist),
     min_val_(0.) {
 
   AMANZI_ASSERT(plist_.isSublist("WRM parameters"));
@@ -23,14 +23,14 @@ RelPermEvaluator::RelPermEvaluator(Teuchos::ParameterList& plist) :
 
 RelPermEvaluator::RelPermEvaluator(Teuchos::ParameterList& plist,
         const Teuchos::RCP<WRMPartition>& wrms) :
-    SecondaryVariableFieldEvaluator(plist),
+    TimedSecondaryVariableFieldEvaluator(plist),
     wrms_(wrms),
     min_val_(0.) {
   InitializeFromPlist_();
 }
 
 RelPermEvaluator::RelPermEvaluator(const RelPermEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     wrms_(other.wrms_),
     sat_key_(other.sat_key_),
     dens_key_(other.dens_key_),
@@ -162,9 +162,10 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
   int ncells = res_c.MyLength();
+  region_cells_.Initialize(*wrms_, ncells);
+  region_cells_.Evaluate(*wrms_, &WRM::k_relative, sat_c[0], res_c[0]);
   for (unsigned int c=0; c!=ncells; ++c) {
-    int index = (*wrms_->first)[c];
-    res_c[0][c] = std::max(wrms_->second[index]->k_relative(sat_c[0][c]), min_val_);
+    res_c[0][c] = std::max(res_c[0][c], min_val_);
   }
 
   // -- Potentially evaluate the model on boundary faces as well.
@@ -264,9 +265,9 @@ void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
     Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
     int ncells = res_c.MyLength();
+    region_cells_.Initialize(*wrms_, ncells);
+    region_cells_.Evaluate(*wrms_, &WRM::d_k_relative, sat_c[0], res_c[0]);
     for (unsigned int c=0; c!=ncells; ++c) {
-      int index = (*wrms_->first)[c];
-      res_c[0][c] = wrms_->second[index]->d_k_relative(sat_c[0][c]);
       AMANZI_ASSERT(res_c[0][c] >= 0.);
     }
 
@@ -11,13 +11,13 @@
 
 #include "wrm.hh"
 #include "wrm_partition.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class RelPermEvaluator : public SecondaryVariableFieldEvaluator {
+class RelPermEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -46,6 +46,7 @@ class RelPermEvaluator : public SecondaryVariableFieldEvaluator {
   void InitializeFromPlist_();
 
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMRegionCells region_cells_;
   Key sat_key_;
   Key dens_key_;
   Key visc_key_;
@@ -35,9 +35,26 @@ public:
   virtual double d_capillaryPressure(double saturation) = 0;
   virtual double residualSaturation() = 0;
 
+  // Batched versions of the above, evaluated on n values at once.  The
+  // defaults loop over the scalar methods; models override these with loops
+  // that the compiler can vectorize.
+  virtual void k_relative(const double* saturation, double* kr, int n) {
+    for (int i=0; i!=n; ++i) kr[i] = k_relative(saturation[i]);
+  }
+  virtual void d_k_relative(const double* saturation, double* dkr, int n) {
+    for (int i=0; i!=n; ++i) dkr[i] = d_k_relative(saturation[i]);
+  }
+  virtual void saturation(const double* pc, double* s, int n) {
+    for (int i=0; i!=n; ++i) s[i] = saturation(pc[i]);
+  }
+  virtual void d_saturation(const double* pc, double* ds, int n) {
+    for (int i=0; i!=n; ++i) ds[i] = d_saturation(pc[i]);
+  }
+
 };
 
 typedef double(WRM::*KRelFn)(double pc);
+typedef void(WRM::*WRMBatchFn)(const double* x, double* y, int n);
 
 } //namespace
 } //namespace
@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Flow {
 
 WRMEvaluator::WRMEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist),
+    TimedSecondaryVariablesFieldEvaluator(plist),
     calc_other_sat_(true) {
 
   AMANZI_ASSERT(plist_.isSublist("WRM parameters"));
@@ -26,13 +26,13 @@ WRMEvaluator::WRMEvaluator(Teuchos::ParameterList& plist) :
 
 WRMEvaluator::WRMEvaluator(Teuchos::ParameterList& plist,
                            const Teuchos::RCP<WRMPartition>& wrms) :
-    SecondaryVariablesFieldEvaluator(plist),
+    TimedSecondaryVariablesFieldEvaluator(plist),
     wrms_(wrms) {
   InitializeFromPlist_();
 }
 
 WRMEvaluator::WRMEvaluator(const WRMEvaluator& other) :
-    SecondaryVariablesFieldEvaluator(other),
+    TimedSecondaryVariablesFieldEvaluator(other),
     calc_other_sat_(other.calc_other_sat_),
     cap_pres_key_(other.cap_pres_key_),
     wrms_(other.wrms_) {}
@@ -85,11 +85,10 @@ void WRMEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pres_c = *S->GetFieldData(cap_pres_key_)
       ->ViewComponent("cell",false);
 
-  // calculate cell values
+  // calculate cell values, one batched call per region
   AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->saturation(pres_c[0][c]);
-  }
+  region_cells_.Initialize(*wrms_, ncells);
+  region_cells_.Evaluate(*wrms_, &WRM::saturation, pres_c[0], sat_c[0]);
 
   // Potentially do face values as well.
   if (results[0]->HasComponent("boundary_face")) {
@@ -152,11 +151,10 @@ void WRMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pres_c = *S->GetFieldData(cap_pres_key_)
       ->ViewComponent("cell",false);
 
-  // calculate cell values
+  // calculate cell values, one batched call per region
   AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->d_saturation(pres_c[0][c]);
-  }
+  region_cells_.Initialize(*wrms_, ncells);
+  region_cells_.Evaluate(*wrms_, &WRM::d_saturation, pres_c[0], sat_c[0]);
 
   // Potentially do face values as well.
   if (results[0]->HasComponent("boundary_face")) {
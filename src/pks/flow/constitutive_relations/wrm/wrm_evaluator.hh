@@ -31,13 +31,13 @@ Evaluates a set of WRMs on a partition of the mesh.
 
 #include "wrm_partition.hh"
 #include "wrm.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class WRMEvaluator : public SecondaryVariablesFieldEvaluator {
+class WRMEvaluator : public TimedSecondaryVariablesFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -62,6 +62,7 @@ class WRMEvaluator : public SecondaryVariablesFieldEvaluator {
 
  protected:
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMRegionCells region_cells_;
   bool calc_other_sat_;
   Key cap_pres_key_;
 
@@ -22,6 +22,12 @@ class WRMInterfrost : public WRM {
 public:
   explicit WRMInterfrost(Teuchos::ParameterList& plist) {}
 
+  // batched versions from WRM, which the scalar overrides would hide
+  using WRM::k_relative;
+  using WRM::d_k_relative;
+  using WRM::saturation;
+  using WRM::d_saturation;
+
   // required methods from the base class
   double k_relative(double sat) { return std::pow(10, -50*0.37*(1-sat)); }
   double d_k_relative(double pc) { return 0.; }
@@ -22,6 +22,12 @@ class WRMLinearRelPerm : public WRM {
  public:
   explicit WRMLinearRelPerm(Teuchos::ParameterList& plist);
 
+  // batched versions from WRM, which the scalar overrides would hide
+  using WRM::k_relative;
+  using WRM::d_k_relative;
+  using WRM::saturation;
+  using WRM::d_saturation;
+
   double k_relative(double s) { return s; }
   double d_k_relative(double s) { return 1.0; }
   double saturation(double pc) { return wrm_->saturation(pc); }
@@ -30,6 +36,10 @@ class WRMLinearRelPerm : public WRM {
   double d_capillaryPressure(double sat) { return wrm_->d_capillaryPressure(sat); }
   double residualSaturation() { return wrm_->residualSaturation(); }
 
+  // forward batched saturation to the wrapped model
+  void saturation(const double* pc, double* s, int n) { wrm_->saturation(pc, s, n); }
+  void d_saturation(const double* pc, double* ds, int n) { wrm_->d_saturation(pc, ds, n); }
+
  private:
   void InitializeFromPlist_();
 
@@ -25,6 +25,12 @@ class WRMLinearSystem : public WRM {
 public:
   explicit WRMLinearSystem(Teuchos::ParameterList& plist);
 
+  // batched versions from WRM, which the scalar overrides would hide
+  using WRM::k_relative;
+  using WRM::d_k_relative;
+  using WRM::saturation;
+  using WRM::d_saturation;
+
   // required methods from the base class
   virtual double k_relative(double pc) { return 1.0; }
   virtual double d_k_relative(double pc) { return 0.0; }
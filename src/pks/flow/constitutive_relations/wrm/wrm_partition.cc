@@ -5,6 +5,8 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include <algorithm>
+
 #include "dbc.hh"
 #include "wrm_factory.hh"
 #include "wrm_permafrost_factory.hh"
@@ -40,6 +42,48 @@ createWRMPartition(Teuchos::ParameterList& plist) {
 }
 
 
+void
+WRMRegionCells::Initialize(const WRMPartition& wrms, int ncells) {
+  if (ncells == ncells_) return;
+
+  ncells_ = ncells;
+  cells_.assign(wrms.second.size(), std::vector<int>());
+  for (int c=0; c!=ncells; ++c) {
+    int index = (*wrms.first)[c];
+    if (index >= 0) cells_[index].push_back(c);
+  }
+
+  int nmax = 0;
+  for (int r=0; r!=cells_.size(); ++r) {
+    nmax = std::max(nmax, (int) cells_[r].size());
+  }
+  x_buf_.resize(nmax);
+  y_buf_.resize(nmax);
+}
+
+
+void
+WRMRegionCells::Evaluate(const WRMPartition& wrms, WRMBatchFn fn,
+                         const double* x, double* y) const {
+  AMANZI_ASSERT(ncells_ >= 0);
+  for (int r=0; r!=cells_.size(); ++r) {
+    const std::vector<int>& cells = cells_[r];
+    int n = cells.size();
+    if (n == 0) continue;
+
+    WRM& wrm = *wrms.second[r];
+    if (n == ncells_) {
+      // one region covers all cells, no need to gather
+      (wrm.*fn)(x, y, n);
+    } else {
+      for (int i=0; i!=n; ++i) x_buf_[i] = x[cells[i]];
+      (wrm.*fn)(&x_buf_[0], &y_buf_[0], n);
+      for (int i=0; i!=n; ++i) y[cells[i]] = y_buf_[i];
+    }
+  }
+}
+
+
 // Non-member factory
 Teuchos::RCP<WRMPermafrostModelPartition>
 createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
@@ -41,6 +41,29 @@ typedef std::pair<Teuchos::RCP<Functions::MeshPartition>, WRMPermafrostModelList
 Teuchos::RCP<WRMPartition>
 createWRMPartition(Teuchos::ParameterList& plist);
 
+
+// The cells of each region of a WRMPartition, grouped once so that each
+// region's WRM is evaluated with a single batched call instead of a virtual
+// call per cell.
+class WRMRegionCells {
+ public:
+  WRMRegionCells() : ncells_(-1) {}
+
+  // Groups cells [0, ncells) by region.  Cheap if already grouped for ncells.
+  void Initialize(const WRMPartition& wrms, int ncells);
+
+  // y[c] = (wrm(c)->*fn)(x[c]) for c in [0, ncells)
+  void Evaluate(const WRMPartition& wrms, WRMBatchFn fn,
+                const double* x, double* y) const;
+
+ private:
+  int ncells_;
+  std::vector<std::vector<int> > cells_;  // cells_[region] = cell LIDs
+
+  // scratch for gathering and scattering non-contiguous regions
+  mutable std::vector<double> x_buf_, y_buf_;
+};
+
 Teuchos::RCP<WRMPermafrostModelPartition>
 createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
         Teuchos::RCP<WRMPartition>& wrms);
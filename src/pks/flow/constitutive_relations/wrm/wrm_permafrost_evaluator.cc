@@ -17,7 +17,7 @@ namespace Flow {
   Constructor from just a ParameterList, reads WRMs and permafrost models from list.
  -------------------------------------------------------------------------------- */
 WRMPermafrostEvaluator::WRMPermafrostEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist) {
+    TimedSecondaryVariablesFieldEvaluator(plist) {
 
   // get the WRMs
   AMANZI_ASSERT(plist_.isSublist("WRM parameters"));
@@ -38,7 +38,7 @@ WRMPermafrostEvaluator::WRMPermafrostEvaluator(Teuchos::ParameterList& plist) :
  -------------------------------------------------------------------------------- */
 WRMPermafrostEvaluator::WRMPermafrostEvaluator(Teuchos::ParameterList& plist,
         const Teuchos::RCP<WRMPartition>& wrms) :
-    SecondaryVariablesFieldEvaluator(plist),
+    TimedSecondaryVariablesFieldEvaluator(plist),
     wrms_(wrms) {
 
   // and the permafrost models
@@ -55,7 +55,7 @@ WRMPermafrostEvaluator::WRMPermafrostEvaluator(Teuchos::ParameterList& plist,
  -------------------------------------------------------------------------------- */
 WRMPermafrostEvaluator::WRMPermafrostEvaluator(Teuchos::ParameterList& plist,
         const Teuchos::RCP<WRMPermafrostModelPartition>& models) :
-    SecondaryVariablesFieldEvaluator(plist),
+    TimedSecondaryVariablesFieldEvaluator(plist),
     permafrost_models_(models) {
 
   InitializeFromPlist_();
@@ -66,7 +66,7 @@ WRMPermafrostEvaluator::WRMPermafrostEvaluator(Teuchos::ParameterList& plist,
   Copy constructor
  -------------------------------------------------------------------------------- */
 WRMPermafrostEvaluator::WRMPermafrostEvaluator(const WRMPermafrostEvaluator& other) :
-    SecondaryVariablesFieldEvaluator(other),
+    TimedSecondaryVariablesFieldEvaluator(other),
     pc_liq_key_(other.pc_liq_key_),
     pc_ice_key_(other.pc_ice_key_),
     permafrost_models_(other.permafrost_models_) {}
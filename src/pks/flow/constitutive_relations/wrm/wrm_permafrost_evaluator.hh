@@ -12,13 +12,13 @@
 #include "wrm.hh"
 #include "wrm_partition.hh"
 #include "wrm_permafrost_model.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class WRMPermafrostEvaluator : public SecondaryVariablesFieldEvaluator {
+class WRMPermafrostEvaluator : public TimedSecondaryVariablesFieldEvaluator {
  public:
 
   explicit
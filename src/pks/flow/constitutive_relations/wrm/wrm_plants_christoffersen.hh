@@ -30,6 +30,12 @@ class WRMPlantChristoffersen : public WRM {
 public:
   explicit WRMPlantChristoffersen(Teuchos::ParameterList& plist);
 
+  // batched versions from WRM, which the scalar overrides would hide
+  using WRM::k_relative;
+  using WRM::d_k_relative;
+  using WRM::saturation;
+  using WRM::d_saturation;
+
   // required methods from the base class
 
   double k_relative(double pc);
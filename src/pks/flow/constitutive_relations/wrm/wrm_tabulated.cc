@@ -0,0 +1,70 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  WRM which tabulates another WRM.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "errors.hh"
+#include "VerboseObject.hh"
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+WRMTabulated::WRMTabulated(Teuchos::ParameterList& plist) :
+    plist_(plist) {
+  InitializeFromPlist_();
+};
+
+
+void WRMTabulated::InitializeFromPlist_() {
+  if (!plist_.isSublist("WRM parameters")) {
+    Errors::Message msg("WRM: tabulated WRM requires a sublist \"WRM parameters\".");
+    Exceptions::amanzi_throw(msg);
+  }
+  Teuchos::ParameterList& sublist = plist_.sublist("WRM parameters");
+  WRMFactory fac;
+  wrm_ = fac.createWRM(sublist);
+
+  int npoints = plist_.get<int>("number of points", 1000);
+
+  Teuchos::Array<double> pc_range =
+      plist_.get<Teuchos::Array<double> >("capillary pressure range [Pa]");
+  Teuchos::Array<double> s_range(2);
+  s_range[0] = wrm_->residualSaturation();
+  s_range[1] = 1.0;
+  s_range = plist_.get<Teuchos::Array<double> >("saturation range [-]", s_range);
+  if (pc_range.size() != 2 || s_range.size() != 2) {
+    Errors::Message msg("WRM: tabulated WRM ranges must be of the form {min, max}.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  WRM* wrm = wrm_.get();
+  sat_table_.Setup(pc_range[0], pc_range[1], npoints,
+                   [wrm](double pc) { return wrm->saturation(pc); });
+  kr_table_.Setup(s_range[0], s_range[1], npoints,
+                  [wrm](double s) { return wrm->k_relative(s); });
+
+  // report table accuracy
+  Teuchos::RCP<VerboseObject> vo = Teuchos::rcp(new VerboseObject("WRMTabulated", plist_));
+  if (vo->os_OK(Teuchos::VERB_LOW)) {
+    Teuchos::OSTab tab = vo->getOSTab();
+    *vo->os() << "tabulated \"" << sublist.get<std::string>("WRM Type")
+              << "\" with " << npoints << " points:" << std::endl
+              << "  saturation on [" << pc_range[0] << ", " << pc_range[1] << "]: max error = "
+              << sat_table_.MaxError([wrm](double pc) { return wrm->saturation(pc); })
+              << ", derivative max error = "
+              << sat_table_.MaxDerivativeError([wrm](double pc) { return wrm->d_saturation(pc); })
+              << std::endl
+              << "  rel perm on [" << s_range[0] << ", " << s_range[1] << "]: max error = "
+              << kr_table_.MaxError([wrm](double s) { return wrm->k_relative(s); })
+              << ", derivative max error = "
+              << kr_table_.MaxDerivativeError([wrm](double s) { return wrm->d_k_relative(s); })
+              << std::endl;
+  }
+};
+
+} // namespace
+} // namespace
@@ -0,0 +1,108 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! WRMTabulated : lookup-table wrapper around another WRM.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Tabulates saturation (as a function of capillary pressure) and relative
+permeability (as a function of saturation) of another WRM with monotone
+cubic interpolants at setup.  Values outside the tabulated ranges, and
+capillary pressure as a function of saturation, are evaluated by the wrapped
+model.  The maximum table errors are reported at startup.
+
+Derivatives are those of the interpolants, so they are consistent with the
+tabulated values.
+
+* `"WRM parameters`" ``[WRM-typed-spec]`` The WRM to tabulate.
+* `"capillary pressure range [Pa]`" ``[Array(double)]`` Range of the
+  saturation table, {min, max}.
+* `"saturation range [-]`" ``[Array(double)]`` **{residual saturation, 1}**
+  Range of the relative permeability table, {min, max}.
+* `"number of points`" ``[int]`` **1000** Number of nodes in each table.
+
+Example:
+
+.. code-block:: xml
+
+    <ParameterList name="peat" type="ParameterList">
+      <Parameter name="region" type="string" value="peat" />
+      <Parameter name="WRM Type" type="string" value="tabulated" />
+      <Parameter name="capillary pressure range [Pa]" type="Array(double)" value="{0., 1.e6}" />
+      <ParameterList name="WRM parameters" type="ParameterList">
+        <Parameter name="WRM Type" type="string" value="van Genuchten" />
+        ...
+      </ParameterList>
+    </ParameterList>
+
+*/
+
+#ifndef ATS_FLOWRELATIONS_WRM_TABULATED_
+#define ATS_FLOWRELATIONS_WRM_TABULATED_
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "MonotoneCubicTable.hh"
+#include "wrm.hh"
+#include "wrm_factory.hh"
+#include "Factory.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class WRMTabulated : public WRM {
+
+ public:
+  explicit WRMTabulated(Teuchos::ParameterList& plist);
+
+  // batched versions from WRM, which the scalar overrides would hide
+  using WRM::k_relative;
+  using WRM::d_k_relative;
+  using WRM::saturation;
+  using WRM::d_saturation;
+
+  // required methods from the base class
+  double k_relative(double s) {
+    return kr_table_.InRange(s) ? kr_table_(s) : wrm_->k_relative(s); }
+  double d_k_relative(double s) {
+    return kr_table_.InRange(s) ? kr_table_.Derivative(s) : wrm_->d_k_relative(s); }
+  double saturation(double pc) {
+    return sat_table_.InRange(pc) ? sat_table_(pc) : wrm_->saturation(pc); }
+  double d_saturation(double pc) {
+    return sat_table_.InRange(pc) ? sat_table_.Derivative(pc) : wrm_->d_saturation(pc); }
+  double capillaryPressure(double s) { return wrm_->capillaryPressure(s); }
+  double d_capillaryPressure(double s) { return wrm_->d_capillaryPressure(s); }
+  double residualSaturation() { return wrm_->residualSaturation(); }
+
+  // batched versions, without a virtual call per entry
+  void k_relative(const double* s, double* kr, int n) {
+    for (int i=0; i!=n; ++i) kr[i] = WRMTabulated::k_relative(s[i]); }
+  void d_k_relative(const double* s, double* dkr, int n) {
+    for (int i=0; i!=n; ++i) dkr[i] = WRMTabulated::d_k_relative(s[i]); }
+  void saturation(const double* pc, double* s, int n) {
+    for (int i=0; i!=n; ++i) s[i] = WRMTabulated::saturation(pc[i]); }
+  void d_saturation(const double* pc, double* ds, int n) {
+    for (int i=0; i!=n; ++i) ds[i] = WRMTabulated::d_saturation(pc[i]); }
+
+ private:
+  void InitializeFromPlist_();
+
+  Teuchos::ParameterList plist_;
+  Teuchos::RCP<WRM> wrm_;
+
+  Relations::MonotoneCubicTable sat_table_;
+  Relations::MonotoneCubicTable kr_table_;
+
+  static Utils::RegisteredFactory<WRM,WRMTabulated> factory_;
+};
+
+} //namespace
+} //namespace
+
+#endif
@@ -0,0 +1,17 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  WRM which tabulates another WRM.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+Utils::RegisteredFactory<WRM,WRMTabulated> WRMTabulated::factory_("tabulated");
+
+} // namespace
+} // namespace
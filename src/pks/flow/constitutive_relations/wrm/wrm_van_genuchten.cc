@@ -5,7 +5,9 @@
   Konstantin Lipnikov (lipnikov@lanl.gov)
 */
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include "dbc.hh"
 #include "errors.hh"
 #include "Spline.hh"
@@ -132,6 +134,84 @@ double WRMVanGenuchten::d_capillaryPressure(double s) {
 }
 
 
+/* ******************************************************************
+ * Batched evaluation.
+ *
+ * Each of these evaluates the closed form on every entry in a branch-free
+ * loop, then patches the (typically few) entries that fall in the
+ * regularized or saturated intervals, giving the same values as the
+ * scalar methods.  Arguments of pow are clamped to where the closed form
+ * is finite, so the entries that are patched, or are at or below residual
+ * saturation, do not produce NaNs.
+ ****************************************************************** */
+void WRMVanGenuchten::k_relative(const double* s, double* kr, int n) {
+  if (function_ == FLOW_WRM_MUALEM) {
+    for (int i=0; i!=n; ++i) {
+      double se = std::min(std::max((s[i] - sr_)/(1-sr_), 0.0), 1.0);
+      kr[i] = pow(se, l_) * pow(1.0 - pow(1.0 - pow(se, 1.0/m_), m_), 2.0);
+    }
+  } else {
+    for (int i=0; i!=n; ++i) {
+      double se = std::min(std::max((s[i] - sr_)/(1-sr_), 0.0), 1.0);
+      kr[i] = se * se * (1.0 - pow(1.0 - pow(se, 1.0/m_), m_));
+    }
+  }
+
+  for (int i=0; i!=n; ++i) {
+    if (s[i] > s0_) kr[i] = s[i] == 1.0 ? 1.0 : fit_kr_(s[i]);
+  }
+}
+
+
+void WRMVanGenuchten::d_k_relative(const double* s, double* dkr, int n) {
+  for (int i=0; i!=n; ++i) {
+    // at residual saturation the derivative tends to 0, but pow(se, l-1) is
+    // infinite, so se is kept positive
+    double se = std::min(std::max((s[i] - sr_)/(1-sr_),
+                                  std::numeric_limits<double>::min()), 1.0);
+
+    double x = pow(se, 1.0 / m_);
+    double y = pow(1.0 - x, m_);
+    double one_minus_x = std::max(1.0 - x, FLOW_WRM_TOLERANCE);
+    double dkdse;
+    if (function_ == FLOW_WRM_MUALEM)
+      dkdse = (1.0 - y) * (l_ * (1.0 - y) + 2 * x * y / one_minus_x) * pow(se, l_ - 1.0);
+    else
+      dkdse = (2 * (1.0 - y) + x / one_minus_x) * se;
+
+    dkr[i] = fabs(1.0 - x) < FLOW_WRM_TOLERANCE ? 0.0 : dkdse / (1 - sr_);
+  }
+
+  for (int i=0; i!=n; ++i) {
+    if (s[i] > s0_) dkr[i] = s[i] == 1.0 ? 0.0 : fit_kr_.Derivative(s[i]);
+  }
+}
+
+
+void WRMVanGenuchten::saturation(const double* pc, double* s, int n) {
+  for (int i=0; i!=n; ++i) {
+    double apc = alpha_ * std::max(pc[i], 0.0);
+    s[i] = std::pow(1.0 + std::pow(apc, n_), -m_) * (1.0 - sr_) + sr_;
+  }
+
+  for (int i=0; i!=n; ++i) {
+    if (pc[i] <= pc0_) s[i] = pc[i] <= 0. ? 1.0 : fit_s_(pc[i]);
+  }
+}
+
+
+void WRMVanGenuchten::d_saturation(const double* pc, double* ds, int n) {
+  for (int i=0; i!=n; ++i) {
+    double apc = alpha_ * std::max(pc[i], 0.0);
+    ds[i] = -m_*n_ * std::pow(1.0 + std::pow(apc, n_), -m_-1.0) * std::pow(apc, n_-1) * alpha_ * (1.0 - sr_);
+  }
+
+  for (int i=0; i!=n; ++i) {
+    if (pc[i] <= pc0_) ds[i] = pc[i] <= 0. ? 0.0 : fit_s_.Derivative(pc[i]);
+  }
+}
+
+
 void WRMVanGenuchten::InitializeFromPlist_() {
   std::string fname = plist_.get<std::string>("Krel function name", "Mualem");
   if (fname == std::string("Mualem")) {
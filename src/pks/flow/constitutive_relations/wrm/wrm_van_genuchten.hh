@@ -61,6 +61,12 @@ class WRMVanGenuchten : public WRM {
 public:
   explicit WRMVanGenuchten(Teuchos::ParameterList& plist);
 
+  // batched versions from WRM, which the scalar overrides would hide
+  using WRM::k_relative;
+  using WRM::d_k_relative;
+  using WRM::saturation;
+  using WRM::d_saturation;
+
   // required methods from the base class
   double k_relative(double saturation);
   double d_k_relative(double saturation);
@@ -70,6 +76,12 @@ public:
   double d_capillaryPressure(double saturation);
   double residualSaturation() { return sr_; }
 
+  // batched versions, vectorizable
+  void k_relative(const double* saturation, double* kr, int n);
+  void d_k_relative(const double* saturation, double* dkr, int n);
+  void saturation(const double* pc, double* s, int n);
+  void d_saturation(const double* pc, double* ds, int n);
+
  private:
   void InitializeFromPlist_();
 
@@ -16,7 +16,7 @@ namespace Flow {
 
 NonlinearSourceFromSubsurfaceEvaluator::NonlinearSourceFromSubsurfaceEvaluator(
         Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   my_key_ = plist_.get<std::string>("source key",
           "overland_source_from_subsurface");
 
@@ -35,7 +35,7 @@ NonlinearSourceFromSubsurfaceEvaluator::NonlinearSourceFromSubsurfaceEvaluator(
 
 NonlinearSourceFromSubsurfaceEvaluator::NonlinearSourceFromSubsurfaceEvaluator(
         const NonlinearSourceFromSubsurfaceEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     height_key_(other.height_key_),
     density_key_(other.density_key_),
     pressure_key_(other.pressure_key_),
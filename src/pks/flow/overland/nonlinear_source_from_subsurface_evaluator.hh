@@ -10,7 +10,7 @@
 #ifndef AMANZI_FLOWRELATIONS_NONLINEAR_SOURCE_FROM_SUBSURFACE_EVALUATOR_HH_
 #define AMANZI_FLOWRELATIONS_NONLINEAR_SOURCE_FROM_SUBSURFACE_EVALUATOR_HH_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 
@@ -20,7 +20,7 @@ namespace Operators { class MatrixMFD; }
 namespace Flow {
 
 class NonlinearSourceFromSubsurfaceEvaluator :
-    public SecondaryVariableFieldEvaluator {
+    public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
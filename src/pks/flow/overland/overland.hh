@@ -69,6 +69,14 @@ public:
   // -- Compute a norm on u-du and return the result.
   virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du);
+
+  // -- Contribute the (already reduced) ErrorNorm() above, not the local
+  //    norm of PK_PhysicalBDF_Default.
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormReduction& enorm) override {
+    PK_BDF_Default::ErrorNormLocal(u, du, enorm);
+  }
   
 protected:
   // setup methods
@@ -14,7 +14,7 @@ namespace Flow {
 
 SurfaceCouplerViaSourceEvaluator::SurfaceCouplerViaSourceEvaluator(
         Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   my_key_ = plist_.get<std::string>("source key",
           "overland_source_from_subsurface");
 
@@ -36,7 +36,7 @@ SurfaceCouplerViaSourceEvaluator::SurfaceCouplerViaSourceEvaluator(
 
 SurfaceCouplerViaSourceEvaluator::SurfaceCouplerViaSourceEvaluator(
         const SurfaceCouplerViaSourceEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pres_key_(other.pres_key_),
     density_key_(other.density_key_),
     surface_density_key_(other.surface_density_key_),
@@ -11,13 +11,13 @@
 #define AMANZI_FLOWRELATIONS_SOURCE_FROM_SUBSURFACE_EVALUATOR_HH_
 
 #include "FieldEvaluator_Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
 
 class SurfaceCouplerViaSourceEvaluator :
-    public SecondaryVariableFieldEvaluator {
+    public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
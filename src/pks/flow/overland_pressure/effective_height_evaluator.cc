@@ -14,7 +14,7 @@ namespace Amanzi {
 namespace Flow {
 
 EffectiveHeightEvaluator::EffectiveHeightEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   // my keys are for saturation and rel perm.
   if (my_key_ == "")
     my_key_ = plist_.get<std::string>("effective height key", "effective_height");
@@ -30,7 +30,7 @@ EffectiveHeightEvaluator::EffectiveHeightEvaluator(Teuchos::ParameterList& plist
 
 
 EffectiveHeightEvaluator::EffectiveHeightEvaluator(const EffectiveHeightEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     height_key_(other.height_key_),
     model_(other.model_) {}
 
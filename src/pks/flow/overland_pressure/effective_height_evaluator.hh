@@ -10,7 +10,7 @@
 #ifndef AMANZI_FLOW_RELATIONS_EFFECTIVE_HEIGHT_EVALUATOR_
 #define AMANZI_FLOW_RELATIONS_EFFECTIVE_HEIGHT_EVALUATOR_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
@@ -18,7 +18,7 @@ namespace Flow {
 
 class EffectiveHeightModel;
 
-class EffectiveHeightEvaluator : public SecondaryVariableFieldEvaluator {
+class EffectiveHeightEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
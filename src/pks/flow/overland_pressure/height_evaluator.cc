@@ -15,7 +15,7 @@ namespace Flow {
 
 
 HeightEvaluator::HeightEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   bar_ = plist_.get<bool>("allow negative ponded depth", false);
   Key domain = Keys::getDomain(my_key_);
 
@@ -36,7 +36,7 @@ HeightEvaluator::HeightEvaluator(Teuchos::ParameterList& plist) :
 
 
 HeightEvaluator::HeightEvaluator(const HeightEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     dens_key_(other.dens_key_),
     pres_key_(other.pres_key_),
     gravity_key_(other.gravity_key_),
@@ -101,6 +101,7 @@ void HeightEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S) {
 // ---------------------------------------------------------------------------
 void HeightEvaluator::UpdateFieldDerivative_(const Teuchos::Ptr<State>& S,
         Key wrt_key) {
+  Teuchos::TimeMonitor monitor(derivative_timer());
 
   Key dmy_key = Keys::getDerivKey(my_key_,wrt_key);
  
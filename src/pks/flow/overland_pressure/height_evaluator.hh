@@ -9,7 +9,7 @@
 #ifndef AMANZI_FLOW_RELATIONS_HEIGHT_EVALUATOR_
 #define AMANZI_FLOW_RELATIONS_HEIGHT_EVALUATOR_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
@@ -17,7 +17,7 @@ namespace Flow {
 
 class HeightModel;
 
-class HeightEvaluator : public SecondaryVariableFieldEvaluator {
+class HeightEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -384,8 +384,8 @@ void OverlandPressureFlow::UpdatePreconditioner(double t, Teuchos::RCP<const Tre
 // -----------------------------------------------------------------------------
 // Default enorm that uses an abs and rel tolerance to monitor convergence.
 // -----------------------------------------------------------------------------
-double OverlandPressureFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
-                               Teuchos::RCP<const TreeVector> res) {
+void OverlandPressureFlow::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                               Teuchos::RCP<const TreeVector> res, ErrorNormReduction& enorm) {
 
   S_inter_->GetFieldEvaluator(conserved_key_)->HasFieldChanged(S_inter_.ptr(), name_);
   const Epetra_MultiVector& conserved = *S_inter_->GetFieldData(conserved_key_)
@@ -394,19 +394,14 @@ double OverlandPressureFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       ->ViewComponent("cell",true);
   
   // VerboseObject stuff.
-  Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-    *vo_->os() << "ENorm (Infnorm) of: " << conserved_key_ << ": " << std::endl;
+    enorm.AddHeader(vo_, "ENorm (Infnorm) of: " + conserved_key_ + ": ");
   
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_next_->time() - S_inter_->time();
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-  
-  double enorm_val = 0.0;
+  enorm.set_comm(mesh_->get_comm());
+
   for (CompositeVector::name_iterator comp=dvec->begin();
        comp!=dvec->end(); ++comp) {
     double enorm_comp = 0.0;
@@ -437,13 +432,12 @@ double OverlandPressureFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       const Epetra_MultiVector& kr_f = *S_next_->GetFieldData(Keys::getKey(domain_,"upwind_overland_conductivity"))
         ->ViewComponent("face",false);
       
+      const std::vector<int>& face_cells = FaceCells_();
       for (unsigned int f=0; f!=nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min = cells.size() == 1 ? cv[0][cells[0]]
-            : std::min(cv[0][cells[0]],cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ? conserved[0][cells[0]]
-            : std::min(conserved[0][cells[0]],conserved[0][cells[1]]);
+        int c0 = face_cells[2*f];
+        int c1 = face_cells[2*f+1];
+        double cv_min = std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min = std::min(conserved[0][c0], conserved[0][c1]);
         
         double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f])
             / (atol_*cv_min + rtol_*std::abs(conserved_min));
@@ -463,29 +457,12 @@ double OverlandPressureFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u,
    
     // Write out Inf norms too.
     if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-      
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr;
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] (" << infnorm << ")" << std::endl;
+      enorm.AddComponent(vo_, *comp, enorm_comp, dvec_v.Map().GID(enorm_loc),
+                         LocalInfNorm_(dvec_v));
     }
     
-    enorm_val = std::max(enorm_val, enorm_comp);
+    enorm.Update(enorm_comp);
   }
-  
-  double enorm_val_l = enorm_val;
-
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
 }
   
 }  // namespace Flow
@@ -13,7 +13,7 @@ namespace Flow {
 
 
 OverlandPressureWaterContentEvaluator::OverlandPressureWaterContentEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
   M_ = plist_.get<double>("molar mass", 0.0180153);
   bar_ = plist_.get<bool>("allow negative water content", false);
   rollover_ = plist_.get<double>("water content rollover", 0.);
@@ -29,7 +29,7 @@ OverlandPressureWaterContentEvaluator::OverlandPressureWaterContentEvaluator(Teu
 
 
 OverlandPressureWaterContentEvaluator::OverlandPressureWaterContentEvaluator(const OverlandPressureWaterContentEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pres_key_(other.pres_key_),
     M_(other.M_),
     bar_(other.bar_),
@@ -24,7 +24,7 @@ namespace Flow {
 
 
 VolumetricHeightEvaluator::VolumetricHeightEvaluator(Teuchos::ParameterList& plist) :
-     SecondaryVariableFieldEvaluator(plist)
+     TimedSecondaryVariableFieldEvaluator(plist)
 {
   Key domain = Keys::getDomain(my_key_);
 
@@ -20,13 +20,13 @@
 #ifndef AMANZI_FLOW_RELATIONS_VOLUMETRIC_HEIGHT_EVALUATOR_
 #define AMANZI_FLOW_RELATIONS_VOLUMETRIC_HEIGHT_EVALUATOR_
 
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class VolumetricHeightEvaluator : public SecondaryVariableFieldEvaluator {
+class VolumetricHeightEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -26,7 +26,7 @@ namespace Flow {
 
 
 VolumetricHeightSubgridEvaluator::VolumetricHeightSubgridEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist),
+    TimedSecondaryVariablesFieldEvaluator(plist),
     compatibility_checked_(false)
 {
   Key a_key = Keys::cleanPListName(plist.name());
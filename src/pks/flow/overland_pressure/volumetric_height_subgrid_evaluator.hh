@@ -22,14 +22,14 @@
 #ifndef AMANZI_FLOW_RELATIONS_VOLUMETRIC_HEIGHT_SUBGRID_EVALUATOR_
 #define AMANZI_FLOW_RELATIONS_VOLUMETRIC_HEIGHT_SUBGRID_EVALUATOR_
 
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
 
-class VolumetricHeightSubgridEvaluator : public SecondaryVariablesFieldEvaluator {
+class VolumetricHeightSubgridEvaluator : public TimedSecondaryVariablesFieldEvaluator {
 
  public:
   // constructor format for all derived classes
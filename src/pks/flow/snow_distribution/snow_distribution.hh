@@ -65,6 +65,14 @@ public:
   virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du);
 
+  // -- Contribute the (already reduced) ErrorNorm() above, not the local
+  //    norm of PK_PhysicalBDF_Default.
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormReduction& enorm) override {
+    PK_BDF_Default::ErrorNormLocal(u, du, enorm);
+  }
+
   virtual bool ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
           Teuchos::RCP<TreeVector> u);
   
@@ -125,8 +125,11 @@ MPCCoupledWater::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
   Solution_to_State(*u_new, S_next_);
 
   // Evaluate the surface flow residual
-  surf_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(1),
-                            u_new->SubVector(1), g->SubVector(1));
+  {
+    Teuchos::TimeMonitor monitor(surf_flow_pk_->timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
+    surf_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(1),
+                              u_new->SubVector(1), g->SubVector(1));
+  }
 
   // The residual of the surface flow equation provides the mass flux from
   // subsurface to surface.
@@ -136,8 +139,11 @@ MPCCoupledWater::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
   source = *g->SubVector(1)->Data()->ViewComponent("cell",false);
 
   // Evaluate the subsurface residual, which uses this flux as a Neumann BC.
-  domain_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(0),
-          u_new->SubVector(0), g->SubVector(0));
+  {
+    Teuchos::TimeMonitor monitor(domain_flow_pk_->timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
+    domain_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(0),
+            u_new->SubVector(0), g->SubVector(0));
+  }
 
   // All surface to subsurface fluxes have been taken by the subsurface.
   g->SubVector(1)->Data()->ViewComponent("cell",false)->PutScalar(0.);
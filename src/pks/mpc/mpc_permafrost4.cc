@@ -218,8 +218,11 @@ MPCPermafrost4::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tree
   Solution_to_State(*u_new, S_next_);
 
   // Evaluate the surface flow residual
-  surf_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(2),
-                            u_new->SubVector(2), g->SubVector(2));
+  {
+    Teuchos::TimeMonitor monitor(surf_flow_pk_->timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
+    surf_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(2),
+                              u_new->SubVector(2), g->SubVector(2));
+  }
 
   // The residual of the surface flow equation provides the mass flux from
   // subsurface to surface.
@@ -228,16 +231,22 @@ MPCPermafrost4::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tree
   mass_exchange_pvfe_->SetFieldAsChanged(S_next_.ptr());
 
   // Evaluate the subsurface residual, which uses this flux as a Neumann BC.
-  domain_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(0),
-          u_new->SubVector(0), g->SubVector(0));
+  {
+    Teuchos::TimeMonitor monitor(domain_flow_pk_->timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
+    domain_flow_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(0),
+            u_new->SubVector(0), g->SubVector(0));
+  }
 
   // All surface to subsurface fluxes have been taken by the subsurface.
   g->SubVector(2)->Data()->ViewComponent("cell",false)->PutScalar(0.);
 
   // Now that mass fluxes are done, do energy.
   // Evaluate the surface energy residual
-  surf_energy_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(3),
-          u_new->SubVector(3), g->SubVector(3));
+  {
+    Teuchos::TimeMonitor monitor(surf_energy_pk_->timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
+    surf_energy_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(3),
+            u_new->SubVector(3), g->SubVector(3));
+  }
 
   // The residual of the surface energy equation provides the diffusive energy
   // flux from subsurface to surface.
@@ -247,8 +256,11 @@ MPCPermafrost4::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tree
   energy_exchange_pvfe_->SetFieldAsChanged(S_next_.ptr());
 
   // Evaluate the subsurface energy residual.
-  domain_energy_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(1),
-          u_new->SubVector(1), g->SubVector(1));
+  {
+    Teuchos::TimeMonitor monitor(domain_energy_pk_->timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
+    domain_energy_pk_->FunctionalResidual(t_old, t_new, u_old->SubVector(1),
+            u_new->SubVector(1), g->SubVector(1));
+  }
 
   // All energy fluxes have been taken by the subsurface.
   g->SubVector(3)->Data()->ViewComponent("cell",false)->PutScalar(0.);
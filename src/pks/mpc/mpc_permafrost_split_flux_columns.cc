@@ -87,6 +87,22 @@ MPCPermafrostSplitFluxColumns::MPCPermafrostSplitFluxColumns(Teuchos::ParameterL
     T_sublist.set("field evaluator type", "primary variable");
   }
 
+  // -- per-column keys
+  for (const auto& col_domain : col_domains_) {
+    ColumnKeys keys;
+    keys.surf_domain = "surface_"+col_domain;
+    keys.snow_domain = "snow_"+col_domain;
+    keys.p_surf = Keys::getKey(keys.surf_domain, p_primary_variable_suffix_);
+    keys.T_surf = Keys::getKey(keys.surf_domain, T_primary_variable_suffix_);
+    keys.p_sub = Keys::getKey(col_domain, p_primary_variable_suffix_);
+    keys.T_sub = Keys::getKey(col_domain, T_primary_variable_suffix_);
+    if (coupling_ != "pressure") {
+      keys.p_lf = Keys::getKey(keys.surf_domain, p_lateral_flow_source_suffix_);
+      keys.T_lf = Keys::getKey(keys.surf_domain, T_lateral_flow_source_suffix_);
+    }
+    col_keys_.push_back(keys);
+  }
+
   // init sub-pks
   plist_->set("PKs order", subpks);
   init_(S);
@@ -114,19 +130,16 @@ void MPCPermafrostSplitFluxColumns::Setup(const Teuchos::Ptr<State>& S)
 
   if (coupling_ != "pressure") {
     // require the coupling sources
-    for (const auto& col_domain : col_domains_) {
-      std::string col_surf_domain = "surface_" + col_domain;
-      Key pkey = Keys::getKey(col_surf_domain, p_lateral_flow_source_suffix_);
-      S->RequireField(pkey, pkey)
-          ->SetMesh(S->GetMesh(col_surf_domain))
+    for (const auto& keys : col_keys_) {
+      S->RequireField(keys.p_lf, keys.p_lf)
+          ->SetMesh(S->GetMesh(keys.surf_domain))
           ->SetComponent("cell", AmanziMesh::CELL, 1);
-      S->RequireFieldEvaluator(pkey);
+      S->RequireFieldEvaluator(keys.p_lf);
 
-      Key Tkey = Keys::getKey(col_surf_domain, T_lateral_flow_source_suffix_);
-      S->RequireField(Tkey, Tkey)
-          ->SetMesh(S->GetMesh(col_surf_domain))
+      S->RequireField(keys.T_lf, keys.T_lf)
+          ->SetMesh(S->GetMesh(keys.surf_domain))
           ->SetComponent("cell", AmanziMesh::CELL, 1);
-      S->RequireFieldEvaluator(Tkey);
+      S->RequireFieldEvaluator(keys.T_lf);
     }
   }
 }
@@ -214,11 +227,11 @@ MPCPermafrostSplitFluxColumns::CopyPrimaryToStar(const Teuchos::Ptr<const State>
                                     const Teuchos::Ptr<State>& S_star)
 {
   // copy p primary variables into star primary variable
+  const ColumnHandles& cols = ConstHandles_(*S);
   auto& p_star = *S_star->GetFieldData(p_primary_variable_star_, S_star->GetField(p_primary_variable_star_)->owner())
                   ->ViewComponent("cell",false);
   for (int c=0; c!=p_star.MyLength(); ++c) {
-    Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
-    const auto& p = *S->GetFieldData(pkey)->ViewComponent("cell",false);
+    const auto& p = *cols.p_surf_const[c]->ViewComponent("cell",false);
     AMANZI_ASSERT(p.MyLength() == 1);
     if (p[0][0] <= 101325.0) {
       p_star[0][c] = 101325.;
@@ -235,8 +248,7 @@ MPCPermafrostSplitFluxColumns::CopyPrimaryToStar(const Teuchos::Ptr<const State>
   auto& T_star = *S_star->GetFieldData(T_primary_variable_star_, S_star->GetField(T_primary_variable_star_)->owner())
                   ->ViewComponent("cell",false);
   for (int c=0; c!=p_star.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
-    const auto& T = *S->GetFieldData(Tkey)->ViewComponent("cell",false);
+    const auto& T = *cols.T_surf_const[c]->ViewComponent("cell",false);
     AMANZI_ASSERT(T.MyLength() == 1);
     T_star[0][c] = T[0][0];
   }
@@ -261,24 +273,19 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimary(double dt) {
 void
 MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
 {
+  ColumnHandles& cols = Handles_(*S_inter_);
+
   // copy p primary variables into star primary variable
   const auto& p_star = *S_next_->GetFieldData(p_primary_variable_star_)
                        ->ViewComponent("cell",false);
   for (int c=0; c!=p_star.MyLength(); ++c) {
     if (p_star[0][c] > 101325.0000001) {
-      Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
-      auto& p = *S_inter_->GetFieldData(pkey, S_inter_->GetField(pkey)->owner())->ViewComponent("cell",false);
+      auto& p = *cols.p_surf[c]->ViewComponent("cell",false);
       AMANZI_ASSERT(p.MyLength() == 1);
       p[0][0] = p_star[0][c];
+      cols.p_surf_eval[c]->SetFieldAsChanged(S_inter_.ptr());
 
-      auto eval_p = S_inter_->GetFieldEvaluator(pkey);
-      auto eval_pv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_p);
-      AMANZI_ASSERT(eval_pv.get());
-      eval_pv->SetFieldAsChanged(S_inter_.ptr());
-
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], p_primary_variable_suffix_),
-                      S_inter_->GetField(Keys::getKey(col_domains_[c], p_primary_variable_suffix_))->owner()).ptr());
+      CopySurfaceToSubsurface(*cols.p_surf[c], cols.p_sub[c].ptr());
     }
   }
 
@@ -286,19 +293,12 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
   const auto& T_star = *S_next_->GetFieldData(T_primary_variable_star_)
                        ->ViewComponent("cell",false);
   for (int c=0; c!=T_star.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
-    auto& T = *S_inter_->GetFieldData(Tkey, S_inter_->GetField(Tkey)->owner())->ViewComponent("cell",false);
+    auto& T = *cols.T_surf[c]->ViewComponent("cell",false);
     AMANZI_ASSERT(T.MyLength() == 1);
     T[0][0] = T_star[0][c];
+    cols.T_surf_eval[c]->SetFieldAsChanged(S_inter_.ptr());
 
-    auto eval_p = S_inter_->GetFieldEvaluator(Tkey);
-    auto eval_pv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_p);
-    AMANZI_ASSERT(eval_pv.get());
-    eval_pv->SetFieldAsChanged(S_inter_.ptr());
-    
-    CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                            S_inter_->GetFieldData(Keys::getKey(col_domains_[c], T_primary_variable_suffix_),
-                                    S_inter_->GetField(Keys::getKey(col_domains_[c], T_primary_variable_suffix_))->owner()).ptr());
+    CopySurfaceToSubsurface(*cols.T_surf[c], cols.T_sub[c].ptr());
   }
 }
 
@@ -309,24 +309,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
 void
 MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
 {
-  // make sure we have the evaluator at the new state timestep
-  if (p_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key p_lf_key = Keys::getKey("surface_"+col_domain, p_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(p_lf_key);
-      p_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(p_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
-
-  if (T_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key T_lf_key = Keys::getKey("surface_"+col_domain, T_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(T_lf_key);
-      T_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(T_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
+  ColumnHandles& cols = Handles_(*S_inter_);
+  ColumnHandles& cols_next = Handles_(*S_next_);
 
   // these updates should do nothing, but you never know
   S_inter_->GetFieldEvaluator(p_conserved_variable_star_)->HasFieldChanged(S_inter_.ptr(), name_);
@@ -366,53 +350,36 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
   for (int c=0; c!=p_star.MyLength(); ++c) {
     if (p_star[0][c] > 101325. && q_div[0][c] < 0.) {
       // use the Dirichlet
-      Key pkey = Keys::getKey("surface_"+col_domains_[c], p_primary_variable_suffix_);
-      auto& p = *S_inter_->GetFieldData(pkey, S_inter_->GetField(pkey)->owner())->ViewComponent("cell",false);
+      auto& p = *cols.p_surf[c]->ViewComponent("cell",false);
       AMANZI_ASSERT(p.MyLength() == 1);
       p[0][0] = p_star[0][c];
 
-      Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_primary_variable_suffix_);
-      auto& T = *S_inter_->GetFieldData(Tkey, S_inter_->GetField(Tkey)->owner())->ViewComponent("cell",false);
+      auto& T = *cols.T_surf[c]->ViewComponent("cell",false);
       AMANZI_ASSERT(T.MyLength() == 1);
       T[0][0] = T_star[0][c];
 
       // tag the evaluators as changed
-      auto eval_p = S_inter_->GetFieldEvaluator(pkey);
-      auto eval_pv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_p);
-      AMANZI_ASSERT(eval_pv.get());
-      eval_pv->SetFieldAsChanged(S_inter_.ptr());
-
-      auto eval_t = S_inter_->GetFieldEvaluator(Tkey);
-      auto eval_tv = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval_t);
-      AMANZI_ASSERT(eval_tv.get());
-      eval_tv->SetFieldAsChanged(S_inter_.ptr());
+      cols.p_surf_eval[c]->SetFieldAsChanged(S_inter_.ptr());
+      cols.T_surf_eval[c]->SetFieldAsChanged(S_inter_.ptr());
 
       // copy from surface to subsurface to ensure consistency
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-                              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], p_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(col_domains_[c], p_primary_variable_suffix_))->owner()).ptr());
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                              S_inter_->GetFieldData(Keys::getKey(col_domains_[c], T_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(col_domains_[c], T_primary_variable_suffix_))->owner()).ptr());
+      CopySurfaceToSubsurface(*cols.p_surf[c], cols.p_sub[c].ptr());
+      CopySurfaceToSubsurface(*cols.T_surf[c], cols.T_sub[c].ptr());
 
       // set the lateral flux to 0
-      Key p_lf_key = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(p_lf_key, p_lf_key)->ViewComponent("cell",false))[0][0] = 0.;
-      p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+      (*cols_next.p_lf[c]->ViewComponent("cell",false))[0][0] = 0.;
+      cols_next.p_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
 
-      Key T_lf_key = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(T_lf_key, T_lf_key)->ViewComponent("cell",false))[0][0] = 0.;
-      T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+      (*cols_next.T_lf[c]->ViewComponent("cell",false))[0][0] = 0.;
+      cols_next.T_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
 
     } else { 
       // use flux
-      Key p_lf_key = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(p_lf_key, p_lf_key)->ViewComponent("cell",false))[0][0] = q_div[0][c];
-      p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+      (*cols_next.p_lf[c]->ViewComponent("cell",false))[0][0] = q_div[0][c];
+      cols_next.p_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
 
-      Key T_lf_key = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
-      (*S_next_->GetFieldData(T_lf_key, T_lf_key)->ViewComponent("cell",false))[0][0] = qE_div[0][c];
-      T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+      (*cols_next.T_lf[c]->ViewComponent("cell",false))[0][0] = qE_div[0][c];
+      cols_next.T_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
     }
   }
 }
@@ -424,24 +391,7 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
 void
 MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
 {
-  // make sure we have the evaluator at the new state timestep
-  if (p_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key pkey = Keys::getKey("surface_"+col_domain, p_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(pkey);
-      p_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(p_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
-  
-  if (T_eval_pvfes_.size() == 0) {
-    for (const auto& col_domain : col_domains_) {
-      Key pkey = Keys::getKey("surface_"+col_domain, T_lateral_flow_source_suffix_);
-      Teuchos::RCP<FieldEvaluator> fe = S_next_->GetFieldEvaluator(pkey);
-      T_eval_pvfes_.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(fe));
-      AMANZI_ASSERT(T_eval_pvfes_.back() != Teuchos::null);
-    }
-  }
+  ColumnHandles& cols_next = Handles_(*S_next_);
 
   // these updates should do nothing, but you never know
   S_inter_->GetFieldEvaluator(p_conserved_variable_star_)->HasFieldChanged(S_inter_.ptr(), name_);
@@ -461,9 +411,8 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
 
   // copy into columns
   for (int c=0; c!=q_div.MyLength(); ++c) {
-    Key pkey = Keys::getKey("surface_"+col_domains_[c], p_lateral_flow_source_suffix_);
-    (*S_next_->GetFieldData(pkey, pkey)->ViewComponent("cell",false))[0][0] = q_div[0][c];
-    p_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+    (*cols_next.p_lf[c]->ViewComponent("cell",false))[0][0] = q_div[0][c];
+    cols_next.p_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
   }
   
   // grab the data, difference
@@ -479,12 +428,67 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryFlux_(double dt)
 
   // copy into columns
   for (int c=0; c!=qE_div.MyLength(); ++c) {
-    Key Tkey = Keys::getKey("surface_"+col_domains_[c], T_lateral_flow_source_suffix_);
-    (*S_next_->GetFieldData(Tkey, Tkey)->ViewComponent("cell",false))[0][0] = qE_div[0][c];
-    T_eval_pvfes_[c]->SetFieldAsChanged(S_next_.ptr());
+    (*cols_next.T_lf[c]->ViewComponent("cell",false))[0][0] = qE_div[0][c];
+    cols_next.T_lf_eval[c]->SetFieldAsChanged(S_next_.ptr());
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Per-column handles into a State, resolved on first use.  Field data and
+// evaluators are fixed once the State is set up, so these are valid for the
+// lifetime of the State.
+// -----------------------------------------------------------------------------
+const MPCPermafrostSplitFluxColumns::ColumnHandles&
+MPCPermafrostSplitFluxColumns::ConstHandles_(const State& S)
+{
+  auto h = const_handles_.find(&S);
+  if (h != const_handles_.end()) return h->second;
+
+  ColumnHandles& cols = const_handles_[&S];
+  for (const auto& keys : col_keys_) {
+    cols.p_surf_const.push_back(S.GetFieldData(keys.p_surf));
+    cols.T_surf_const.push_back(S.GetFieldData(keys.T_surf));
   }
+  return cols;
 }
 
+
+MPCPermafrostSplitFluxColumns::ColumnHandles&
+MPCPermafrostSplitFluxColumns::Handles_(State& S)
+{
+  auto h = handles_.find(&S);
+  if (h != handles_.end()) return h->second;
+
+  ColumnHandles& cols = handles_[&S];
+  for (const auto& keys : col_keys_) {
+    cols.p_surf.push_back(S.GetFieldData(keys.p_surf, S.GetField(keys.p_surf)->owner()));
+    cols.T_surf.push_back(S.GetFieldData(keys.T_surf, S.GetField(keys.T_surf)->owner()));
+    cols.p_sub.push_back(S.GetFieldData(keys.p_sub, S.GetField(keys.p_sub)->owner()));
+    cols.T_sub.push_back(S.GetFieldData(keys.T_sub, S.GetField(keys.T_sub)->owner()));
+
+    cols.p_surf_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(
+        S.GetFieldEvaluator(keys.p_surf)));
+    AMANZI_ASSERT(cols.p_surf_eval.back() != Teuchos::null);
+    cols.T_surf_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(
+        S.GetFieldEvaluator(keys.T_surf)));
+    AMANZI_ASSERT(cols.T_surf_eval.back() != Teuchos::null);
+
+    if (coupling_ != "pressure") {
+      cols.p_lf.push_back(S.GetFieldData(keys.p_lf, keys.p_lf));
+      cols.T_lf.push_back(S.GetFieldData(keys.T_lf, keys.T_lf));
+
+      cols.p_lf_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(
+          S.GetFieldEvaluator(keys.p_lf)));
+      AMANZI_ASSERT(cols.p_lf_eval.back() != Teuchos::null);
+      cols.T_lf_eval.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(
+          S.GetFieldEvaluator(keys.T_lf)));
+      AMANZI_ASSERT(cols.T_lf_eval.back() != Teuchos::null);
+    }
+  }
+  return cols;
+}
+
+
 // protected constructor of subpks
 void MPCPermafrostSplitFluxColumns::init_(const Teuchos::RCP<State>& S)
 {
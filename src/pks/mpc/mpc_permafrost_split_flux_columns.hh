@@ -39,6 +39,8 @@ Kappa grad T |_s = qE_ss
 #ifndef PKS_MPC_PERMAFROST_SPLIT_FLUX_COLUMNS_HH_
 #define PKS_MPC_PERMAFROST_SPLIT_FLUX_COLUMNS_HH_
 
+#include <map>
+
 #include "PK.hh"
 #include "mpc.hh"
 #include "primary_variable_field_evaluator.hh"
@@ -100,10 +102,31 @@ class MPCPermafrostSplitFluxColumns : public MPC<PK> {
   Key T_lateral_flow_source_suffix_;
   
   Key cv_key_;
-  std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_eval_pvfes_;
-  std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > T_eval_pvfes_;
   std::vector<std::string> col_domains_;
 
+  // Per-column keys, built once at construction.
+  struct ColumnKeys {
+    Key surf_domain, snow_domain;
+    Key p_surf, T_surf;           // surface primary variables
+    Key p_sub, T_sub;             // subsurface primary variables
+    Key p_lf, T_lf;               // lateral flow sources, if not pressure coupled
+  };
+  std::vector<ColumnKeys> col_keys_;
+
+  // Per-column data and evaluators in a given State, resolved on first use
+  // so that exchanges with the star system are plain gathers and scatters.
+  struct ColumnHandles {
+    std::vector<Teuchos::RCP<const CompositeVector> > p_surf_const, T_surf_const;
+    std::vector<Teuchos::RCP<CompositeVector> > p_surf, T_surf, p_sub, T_sub, p_lf, T_lf;
+    std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_surf_eval, T_surf_eval;
+    std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_lf_eval, T_lf_eval;
+  };
+  const ColumnHandles& ConstHandles_(const State& S);
+  ColumnHandles& Handles_(State& S);
+
+  std::map<const State*, ColumnHandles> const_handles_;
+  std::map<const State*, ColumnHandles> handles_;
+
   std::string coupling_;
   
  private:
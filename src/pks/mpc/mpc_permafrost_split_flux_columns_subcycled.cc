@@ -43,9 +43,13 @@ bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceStep(double t_old, double t_
   // Copy star's new value into primary's old value
   CopyStarToPrimary(t_new - t_old);
 
-  // Now advance the primary
+  // Now advance the primary.  Columns are advanced one after another: they
+  // share S_next_ and S_inter_, whose time, "dt" and evaluator caches each
+  // column's subcycling overwrites, so they cannot run concurrently until
+  // State gives each column its own.
   for (int i=1; i!=sub_pks_.size(); ++i) {
-    auto col_domain = col_domains_[i-1];
+    const auto& col_domain = col_domains_[i-1];
+    const auto& keys = col_keys_[i-1];
     double t_inner = t_old;
     bool done = false;
     if (vo_->os_OK(Teuchos::VERB_EXTREME))
@@ -71,8 +75,8 @@ bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceStep(double t_old, double t_
       if (fail_inner || !valid_inner) {
         dt_inner = sub_pks_[i]->get_dt();
         S_next_->AssignDomain(*S_inter_, col_domain);
-        S_next_->AssignDomain(*S_inter_, "surface_"+col_domain);
-        S_next_->AssignDomain(*S_inter_, "snow_"+col_domain);
+        S_next_->AssignDomain(*S_inter_, keys.surf_domain);
+        S_next_->AssignDomain(*S_inter_, keys.snow_domain);
         //        S_next_->AssignDomain(*S_inter_, "surface_star");
         S_next_->set_time(S_inter_->time());
         S_next_->set_cycle(S_inter_->cycle());
@@ -89,8 +93,8 @@ bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceStep(double t_old, double t_
         }
 
         S_inter_->AssignDomain(*S_next_, col_domain);
-        S_inter_->AssignDomain(*S_next_, "surface_"+col_domain);
-        S_inter_->AssignDomain(*S_next_, "snow_"+col_domain);
+        S_inter_->AssignDomain(*S_next_, keys.surf_domain);
+        S_inter_->AssignDomain(*S_next_, keys.snow_domain);
         //        S_inter_->AssignDomain(*S_next_, "surface_star");
         S_inter_->set_time(S_next_->time());
         S_inter_->set_cycle(S_next_->cycle());
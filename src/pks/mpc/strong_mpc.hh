@@ -63,6 +63,9 @@ public:
   // -- enorm for the coupled system
   virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du);
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormReduction& enorm);
 
   // StrongMPC's preconditioner is, by default, just the block-diagonal
   // operator formed by placing the sub PK's preconditioners on the diagonal.
@@ -211,6 +214,7 @@ void StrongMPC<PK_t>::FunctionalResidual(double t_old, double t_new, Teuchos::RC
     }
 
     // fill the nonlinear function with each sub-PKs contribution
+    Teuchos::TimeMonitor monitor(sub_pks_[i]->timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
     sub_pks_[i]->FunctionalResidual(t_old, t_new, pk_u_old, pk_u_new, pk_g);
   }
 };
@@ -239,6 +243,7 @@ int StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuch
     }
 
     // Fill the preconditioned u as the block-diagonal product using each sub-PK.
+    Teuchos::TimeMonitor monitor(sub_pks_[i]->timer(PK_BDF_Default::TIMER_APPLY_PRECONDITIONER));
     int icur_err = sub_pks_[i]->ApplyPreconditioner(pk_u, pk_Pu);
     ierr += icur_err;
   }
@@ -252,13 +257,24 @@ int StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuch
 
 // -----------------------------------------------------------------------------
 // Compute a norm on u-du and returns the result.
-// For a Strong MPC, the enorm is just the max of the sub PKs enorms.
+// For a Strong MPC, the enorm is just the max of the sub PKs enorms.  The
+// sub-PK contributions are local, and are reduced here all at once.
 // -----------------------------------------------------------------------------
 template<class PK_t>
 double StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u,
                         Teuchos::RCP<const TreeVector> du){
-  double norm = 0.0;
+  ErrorNormReduction enorm;
+  ErrorNormLocal(u, du, enorm);
+  return enorm.Reduce();
+};
+
 
+// -----------------------------------------------------------------------------
+// Local contributions of each sub-PK to the enorm.
+// -----------------------------------------------------------------------------
+template<class PK_t>
+void StrongMPC<PK_t>::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+        Teuchos::RCP<const TreeVector> du, ErrorNormReduction& enorm) {
   // loop over sub-PKs
   for (unsigned int i=0; i!=sub_pks_.size(); ++i) {
     // pull out the u sub-vector
@@ -276,10 +292,9 @@ double StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     }
 
     // norm is the max of the sub-PK norms
-    double tmp_norm = sub_pks_[i]->ErrorNorm(pk_u, pk_du);
-    norm = std::max(norm, tmp_norm);
+    Teuchos::TimeMonitor monitor(sub_pks_[i]->timer(PK_BDF_Default::TIMER_ERROR_NORM));
+    sub_pks_[i]->ErrorNormLocal(pk_u, pk_du, enorm);
   }
-  return norm;
 };
 
 
@@ -301,6 +316,7 @@ void StrongMPC<PK_t>::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVect
     }
 
     // update precons of each of the sub-PKs
+    Teuchos::TimeMonitor monitor(sub_pks_[i]->timer(PK_BDF_Default::TIMER_UPDATE_PRECONDITIONER));
     sub_pks_[i]->UpdatePreconditioner(t, pk_up, h);
   };
 };
@@ -407,6 +423,7 @@ AmanziSolvers::FnBaseDefs::ModifyCorrectionResult
       Exceptions::amanzi_throw(message);
     }
 
+    Teuchos::TimeMonitor monitor(sub_pks_[i]->timer(PK_BDF_Default::TIMER_MODIFY_CORRECTION));
     modified = std::max(modified, sub_pks_[i]->ModifyCorrection(h, pk_res, pk_u, pk_du));
   }
   return modified;
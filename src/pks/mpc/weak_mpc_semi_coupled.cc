@@ -44,6 +44,25 @@ WeakMPCSemiCoupled::WeakMPCSemiCoupled(Teuchos::ParameterList& pk_tree,
     std::stringstream domain_name_stream;
     domain_name_stream << std::get<0>(col_triple) << "_" << gid;
     subpks.push_back(Keys::getKey(domain_name_stream.str(), std::get<2>(col_triple)));
+
+    // keys used in exchanges with the star system
+    ColumnKeys keys;
+    keys.gid = gid;
+    keys.domain = domain_name_stream.str();
+    keys.surf_domain = "surface_" + keys.domain;
+    keys.pres = Keys::getKey(keys.domain, "pressure");
+    keys.temp = Keys::getKey(keys.domain, "temperature");
+    keys.surf_pres = Keys::getKey(keys.surf_domain, "pressure");
+    keys.surf_temp = Keys::getKey(keys.surf_domain, "temperature");
+    keys.surf_wc = Keys::getKey(keys.surf_domain, "water_content");
+    keys.surf_pd = Keys::getKey(keys.surf_domain, "ponded_depth");
+    keys.surf_cv = Keys::getKey(keys.surf_domain, "cell_volume");
+    keys.surf_mdl = Keys::getKey(keys.surf_domain, "mass_density_liquid");
+    keys.sources.push_back(Keys::getKey(keys.surf_domain, "mass_source_temperature"));
+    keys.sources.push_back(Keys::getKey(keys.surf_domain, "conducted_energy_source"));
+    keys.sources.push_back(Keys::getKey(keys.surf_domain, "mass_source"));
+    keys.sources.push_back(Keys::getKey(keys.domain, "mass_source"));
+    col_keys_.push_back(keys);
   }
   numPKs_ = subpks.size();
 
@@ -122,6 +141,52 @@ WeakMPCSemiCoupled::Setup(const Teuchos::Ptr<State>& S) {
 
 };
 
+
+// -----------------------------------------------------------------------------
+// Set states, and resolve the per-column data and evaluators used in
+// exchanges with the star system.  These are fixed once the States are set
+// up, so are looked up once here rather than per column on every step.
+// -----------------------------------------------------------------------------
+void
+WeakMPCSemiCoupled::set_states(const Teuchos::RCP<const State>& S,
+                               const Teuchos::RCP<State>& S_inter,
+                               const Teuchos::RCP<State>& S_next) {
+  MPC<PK>::set_states(S, S_inter, S_next);
+  if (coupling_key_ != "surface subsurface system: columns") return;
+
+  cols_.clear();
+  cols_.resize(col_keys_.size());
+  for (int c=0; c!=col_keys_.size(); ++c) {
+    const ColumnKeys& keys = col_keys_[c];
+    ColumnHandles& col = cols_[c];
+    col.surf_pres = S_inter_->GetFieldData(keys.surf_pres, S_inter_->GetField(keys.surf_pres)->owner());
+    col.surf_temp = S_inter_->GetFieldData(keys.surf_temp, S_inter_->GetField(keys.surf_temp)->owner());
+    col.pres = S_inter_->GetFieldData(keys.pres, S_inter_->GetField(keys.pres)->owner());
+    col.temp = S_inter_->GetFieldData(keys.temp, S_inter_->GetField(keys.temp)->owner());
+
+    col.next_surf_temp = S_next_->GetFieldData(keys.surf_temp);
+    col.next_surf_wc = S_next_->GetFieldData(keys.surf_wc);
+    if (!sg_model_) {
+      col.next_surf_pres = S_next_->GetFieldData(keys.surf_pres);
+    } else {
+      col.next_surf_pd = S_next_->GetFieldData(keys.surf_pd);
+      col.next_surf_cv = S_next_->GetFieldData(keys.surf_cv);
+      col.next_surf_mdl = S_next_->GetFieldData(keys.surf_mdl);
+    }
+
+    if (subcycle_key_) {
+      for (const auto& key : keys.sources) {
+        col.inter_sources.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(
+            S_inter_->GetFieldEvaluator(key)));
+        AMANZI_ASSERT(col.inter_sources.back() != Teuchos::null);
+        col.next_sources.push_back(Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(
+            S_next_->GetFieldEvaluator(key)));
+        AMANZI_ASSERT(col.next_sources.back() != Teuchos::null);
+      }
+    }
+  }
+}
+
 //-------------------------------------------------------------------------------------
 // Semi coupled thermal hydrology
 bool 
@@ -187,12 +252,7 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
     const Epetra_MultiVector& surfstar_pres = *S_next_->GetFieldData("surface_star-pressure")->ViewComponent("cell", false);
     for (unsigned c=0; c<size_t; c++){
       if(surfstar_pres[0][c] > 101325.00){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	
-	name << "surface_column_" << id;
-	Epetra_MultiVector& surf_pres = *S_inter_->GetFieldData(Keys::getKey(name.str(),"pressure"), 
-								S_inter_->GetField(Keys::getKey(name.str(),"pressure"))->owner())->ViewComponent("cell", false);
+	Epetra_MultiVector& surf_pres = *cols_[c].surf_pres->ViewComponent("cell", false);
 	surf_pres[0][0] = surfstar_pres[0][c];
       }
       else {}
@@ -215,13 +275,7 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
       double pres = vol_pd[0][c]*mdl[0][c]*gz + 101325.0; // convert volumetric head to pressure
     
       if(pres > 101325.0){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	
-	name << "surface_column_" << id;
-	Epetra_MultiVector& surf_pres = *S_inter_->GetFieldData(Keys::getKey(name.str(),"pressure"), 
-								S_inter_->GetField(Keys::getKey(name.str(),"pressure"))->owner())
-	  ->ViewComponent("cell", false);
+	Epetra_MultiVector& surf_pres = *cols_[c].surf_pres->ViewComponent("cell", false);
 	surf_pres[0][0] = pres;
       }
       else {}
@@ -232,22 +286,12 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
   
   //copying temperatures
   for (unsigned c=0; c<size_t; c++){
-    std::stringstream name, name_ss;
-    int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-    name << "surface_column_" << id;
-    name_ss << "column_" << id;
-   
-    Epetra_MultiVector& surf_temp = *S_inter_->GetFieldData(Keys::getKey(name.str(),"temperature"), 
-							    S_inter_->GetField(Keys::getKey(name.str(),"temperature"))->owner())->ViewComponent("cell", false);
-    surf_temp[0][0] = surfstar_temp[0][c];
+    ColumnHandles& col = cols_[c];
+    (*col.surf_temp->ViewComponent("cell", false))[0][0] = surfstar_temp[0][c];
     
-    CopySurfaceToSubsurface(*S_inter_->GetFieldData(Keys::getKey(name.str(),"pressure")),
-			    S_inter_->GetFieldData(Keys::getKey(name_ss.str(),"pressure"), 
-						   S_inter_->GetField(Keys::getKey(name_ss.str(),"pressure"))->owner()).ptr());
+    CopySurfaceToSubsurface(*col.surf_pres, col.pres.ptr());
     
-    CopySurfaceToSubsurface(*S_inter_->GetFieldData(Keys::getKey(name.str(),"temperature")),
-			    S_inter_->GetFieldData(Keys::getKey(name_ss.str(),"temperature"), 
-						   S_inter_->GetField(Keys::getKey(name_ss.str(),"temperature"))->owner()).ptr());
+    CopySurfaceToSubsurface(*col.surf_temp, col.temp.ptr());
   } 
   // NOTE: later do it in the setup --aj
   
@@ -264,6 +308,8 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
   double t0 = S_inter_->time();
   double t1 = S_next_->time();
 
+  // Columns are advanced serially; they share S_next_ and S_inter_, including
+  // the time and "dt" that subcycling resets per column.
   auto sub_pk = sub_pks_.begin();
   ++sub_pk;
   for (auto pk = sub_pk; pk!=sub_pks_.end(); ++pk){
@@ -274,10 +320,8 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
     }
     else
       {
-      std::stringstream name, name_ss;
-      int id = S_->GetMesh("surface")->cell_map(false).GID(count);
-      name << "surface_column_" << id;
-      name_ss << "column_" << id;
+      int id = col_keys_[count].gid;
+      ColumnHandles& col = cols_[count];
       
       double loc_dt =0;//revisit dt;      
           
@@ -315,29 +359,8 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
 
 	    UpdateIntermediateStateParameters(S_next_, S_inter_,id);
 
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe1 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_inter_->GetFieldEvaluator(Keys::getKey(name.str(),"mass_source_temperature")));
-	   
-	   pfe1->SetFieldAsChanged(S_inter_.ptr());
-
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe2 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_inter_->GetFieldEvaluator(Keys::getKey(name.str(),"conducted_energy_source")));
-	   
-	   pfe2->SetFieldAsChanged(S_inter_.ptr());
-
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe3 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_inter_->GetFieldEvaluator(Keys::getKey(name.str(),"mass_source")));
-	   
-	   pfe3->SetFieldAsChanged(S_inter_.ptr());
-
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe4 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_inter_->GetFieldEvaluator(Keys::getKey(name_ss.str(),"mass_source")));
-	   
-	   pfe4->SetFieldAsChanged(S_inter_.ptr());
+	   for (const auto& pfe : col.inter_sources)
+	     pfe->SetFieldAsChanged(S_inter_.ptr());
 	  
 	   Teuchos::RCP<PK_PhysicalBDF_Default> pk_domain =
 	     Teuchos::rcp_dynamic_cast<PK_PhysicalBDF_Default>(sub_pks_[count+1]);
@@ -355,29 +378,8 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
 	  
 	  UpdateNextStateParameters(S_next_, S_inter_, id);
 
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe1 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_next_->GetFieldEvaluator(Keys::getKey(name.str(),"mass_source_temperature")));
-	   
-	   pfe1->SetFieldAsChanged(S_next_.ptr());
-
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe2 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_next_->GetFieldEvaluator(Keys::getKey(name.str(),"conducted_energy_source")));
-	   
-	   pfe2->SetFieldAsChanged(S_next_.ptr());
-
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe3 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_next_->GetFieldEvaluator(Keys::getKey(name.str(),"mass_source")));
-	   
-	   pfe3->SetFieldAsChanged(S_next_.ptr());
-
-	   Teuchos::RCP<PrimaryVariableFieldEvaluator> pfe4 = 
-	     Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>
-	     (S_next_->GetFieldEvaluator(Keys::getKey(name_ss.str(),"mass_source")));
-	   
-	   pfe4->SetFieldAsChanged(S_next_.ptr());
+	   for (const auto& pfe : col.next_sources)
+	     pfe->SetFieldAsChanged(S_next_.ptr());
 
 
 	   Teuchos::RCP<PK_PhysicalBDF_Default> pk_domain =
@@ -416,13 +418,8 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
       ->ViewComponent("cell", false);
     if (!sg_model_){
       for (unsigned c=0; c<size_t; c++){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	name << "surface_column_" << id;
-	const Epetra_MultiVector& surf_p = *S_next_->GetFieldData(Keys::getKey(name.str(),"pressure"))
-	  ->ViewComponent("cell", false);
-	const Epetra_MultiVector& surf_wc = *S_next_->GetFieldData(Keys::getKey(name.str(),"water_content"))
-	  ->ViewComponent("cell", false);
+	const Epetra_MultiVector& surf_p = *cols_[c].next_surf_pres->ViewComponent("cell", false);
+	const Epetra_MultiVector& surf_wc = *cols_[c].next_surf_wc->ViewComponent("cell", false);
 	if(surf_p[0][0] > 101325.00){
 	  surfstar_p[0][c] = surf_p[0][0];
 	  surfstar_wc[0][c] = surf_wc[0][0];
@@ -446,19 +443,11 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
       MPI_Comm_rank(MPI_COMM_WORLD, &rank);
       
       for (unsigned c=0; c<size_t; c++){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	name << "surface_column_" << id;
-	const Epetra_MultiVector& pd = *S_next_->GetFieldData(Keys::getKey(name.str(),"ponded_depth"))
-	  ->ViewComponent("cell", false);
-	const Epetra_MultiVector& surf_wc = *S_next_->GetFieldData(Keys::getKey(name.str(),"water_content"))
-	  ->ViewComponent("cell", false);
-	
-	const Epetra_MultiVector& cv = *S_next_->GetFieldData(Keys::getKey(name.str(),"cell_volume"))
-	  ->ViewComponent("cell", false);
-
-	const Epetra_MultiVector& mdl = *S_next_->GetFieldData(Keys::getKey(name.str(),"mass_density_liquid"))
-	  ->ViewComponent("cell", false);
+	const ColumnHandles& col = cols_[c];
+	const Epetra_MultiVector& pd = *col.next_surf_pd->ViewComponent("cell", false);
+	const Epetra_MultiVector& surf_wc = *col.next_surf_wc->ViewComponent("cell", false);
+	const Epetra_MultiVector& cv = *col.next_surf_cv->ViewComponent("cell", false);
+	const Epetra_MultiVector& mdl = *col.next_surf_mdl->ViewComponent("cell", false);
 	
 	if (pd[0][0] >0){
 	 
@@ -488,10 +477,7 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
     }
 
     for (unsigned c=0; c<size_t; c++){
-      std::stringstream name;
-      int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-      name << "surface_column_" << id;
-      const Epetra_MultiVector& surf_t = *S_next_->GetFieldData(Keys::getKey(name.str(),"temperature"))->ViewComponent("cell", false);
+      const Epetra_MultiVector& surf_t = *cols_[c].next_surf_temp->ViewComponent("cell", false);
       surfstar_t[0][c] = surf_t[0][0];
     }
 
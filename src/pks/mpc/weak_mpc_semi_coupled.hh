@@ -6,6 +6,7 @@
 //#include "weak_mpc.hh"
 #include "mpc.hh"
 #include "PK.hh"
+#include "primary_variable_field_evaluator.hh"
 
 namespace Amanzi {
   
@@ -22,6 +23,9 @@ class WeakMPCSemiCoupled : public MPC<PK> {
 
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit); //virtual bool advance (double dt);
   virtual void Setup(const Teuchos::Ptr<State>& S);
+  virtual void set_states(const Teuchos::RCP<const State>& S,
+                          const Teuchos::RCP<State>& S_inter,
+                          const Teuchos::RCP<State>& S_next);
 
 
   //  void generalize_inputspec(const Teuchos::Ptr<State>& S);
@@ -39,6 +43,28 @@ private :
   static unsigned flag_star, flag_star_surf;
   Key coupling_key_ ;
   bool subcycle_key_ ;
+
+  // per-column keys, built once at construction
+  struct ColumnKeys {
+    int gid;  // of the surface cell
+    Key domain, surf_domain;
+    Key pres, temp;
+    Key surf_pres, surf_temp, surf_wc, surf_pd, surf_cv, surf_mdl;
+    std::vector<Key> sources;  // reset when subcycling
+  };
+  std::vector<ColumnKeys> col_keys_;
+
+  // per-column data and evaluators, resolved in set_states()
+  struct ColumnHandles {
+    // S_inter_, written from the star system before advancing the columns
+    Teuchos::RCP<CompositeVector> surf_pres, surf_temp, pres, temp;
+    // S_next_, read back into the star system
+    Teuchos::RCP<const CompositeVector> next_surf_pres, next_surf_temp, next_surf_wc;
+    Teuchos::RCP<const CompositeVector> next_surf_pd, next_surf_cv, next_surf_mdl;
+    // source evaluators in S_inter_ and S_next_, if subcycling
+    std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > inter_sources, next_sources;
+  };
+  std::vector<ColumnHandles> cols_;
   
 
   bool sg_model_;
@@ -17,6 +17,61 @@ BDF.
 
 namespace Amanzi {
 
+// -----------------------------------------------------------------------------
+// The time integrator's view of a PK, timing each call into the PK.
+// -----------------------------------------------------------------------------
+class TimedBDFFn : public BDFFnBase<TreeVector> {
+ public:
+  explicit TimedBDFFn(PK_BDF_Default& pk) : pk_(pk) {}
+
+  virtual void FunctionalResidual(double t_old, double t_new, Teuchos::RCP<TreeVector> u_old,
+          Teuchos::RCP<TreeVector> u_new, Teuchos::RCP<TreeVector> f) {
+    Teuchos::TimeMonitor monitor(pk_.timer(PK_BDF_Default::TIMER_FUNCTIONAL_RESIDUAL));
+    pk_.FunctionalResidual(t_old, t_new, u_old, u_new, f);
+  }
+
+  virtual int ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu) {
+    Teuchos::TimeMonitor monitor(pk_.timer(PK_BDF_Default::TIMER_APPLY_PRECONDITIONER));
+    return pk_.ApplyPreconditioner(u, Pu);
+  }
+
+  virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) {
+    Teuchos::TimeMonitor monitor(pk_.timer(PK_BDF_Default::TIMER_ERROR_NORM));
+    return pk_.ErrorNorm(u, du);
+  }
+
+  virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h) {
+    Teuchos::TimeMonitor monitor(pk_.timer(PK_BDF_Default::TIMER_UPDATE_PRECONDITIONER));
+    pk_.UpdatePreconditioner(t, up, h);
+  }
+
+  virtual AmanziSolvers::FnBaseDefs::ModifyCorrectionResult
+      ModifyCorrection(double h, Teuchos::RCP<const TreeVector> res,
+                       Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> du) {
+    Teuchos::TimeMonitor monitor(pk_.timer(PK_BDF_Default::TIMER_MODIFY_CORRECTION));
+    return pk_.ModifyCorrection(h, res, u, du);
+  }
+
+  virtual bool IsAdmissible(Teuchos::RCP<const TreeVector> up) {
+    return pk_.IsAdmissible(up);
+  }
+
+  virtual bool ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
+          Teuchos::RCP<TreeVector> u) {
+    return pk_.ModifyPredictor(h, u0, u);
+  }
+
+  virtual void ChangedSolution() { pk_.ChangedSolution(); }
+
+  virtual void UpdateContinuationParameter(double lambda) {
+    pk_.UpdateContinuationParameter(lambda);
+  }
+
+ private:
+  PK_BDF_Default& pk_;
+};
+
+
 
 // -----------------------------------------------------------------------------
 // Setup
@@ -51,7 +106,8 @@ void PK_BDF_Default::Initialize(const Teuchos::Ptr<State>& S) {
     bdf_plist.set("initial time", S->time());
     if (!bdf_plist.isSublist("verbose object"))
       bdf_plist.set("verbose object", plist_->sublist("verbose object"));
-    time_stepper_ = Teuchos::rcp(new BDF1_TI<TreeVector,TreeVectorSpace>(*this, bdf_plist, solution_));
+    timed_fn_ = Teuchos::rcp(new TimedBDFFn(*this));
+    time_stepper_ = Teuchos::rcp(new BDF1_TI<TreeVector,TreeVectorSpace>(*timed_fn_, bdf_plist, solution_));
 
     // initialize continuation parameter if needed.
     if (bdf_plist.isSublist("continuation parameters")) {
@@ -166,4 +222,20 @@ void PK_BDF_Default::UpdateContinuationParameter(double lambda) {
   ChangedSolution();
 }
 
+
+// -----------------------------------------------------------------------------
+// Timers are created on first use, as the PK name is not known to all
+// constructors.
+// -----------------------------------------------------------------------------
+Teuchos::Time& PK_BDF_Default::timer(TimerType type) {
+  if (timers_[type] == Teuchos::null) {
+    static const char* labels[NUM_TIMERS] = { "FunctionalResidual", "UpdatePreconditioner",
+                                              "ApplyPreconditioner", "ErrorNorm",
+                                              "ModifyCorrection" };
+    std::string timer_name = plist_->get<std::string>("timer name", name_);
+    timers_[type] = Teuchos::TimeMonitor::getNewCounter("PK " + timer_name + ": " + labels[type]);
+  }
+  return *timers_[type];
+}
+
 } // namespace
@@ -40,6 +40,11 @@ couples the flow and energy PKs, not to the flow or energy PK itself.
   Note that this is only used if this PK is not strongly coupled to other PKs.
 
   This spec describes how to form the (approximate) inverse of the preconditioner.
+
+* `"timer name`" ``[string]`` **PK name** Name of the timers for this PK's
+  ``FunctionalResidual``, ``UpdatePreconditioner``, ``ApplyPreconditioner``,
+  ``ErrorNorm``, and ``ModifyCorrection``.  PKs sharing a timer name share
+  timers, which keeps the timer count down for e.g. one PK per column.
   
 NOTE: ``PKBDFBase  (v)-->`` PKDefaultBase_
 
@@ -55,6 +60,8 @@ NOTE: ``PKBDFBase  (v)-->`` PKDefaultBase_
 #include "BDF1_TI.hh"
 #include "PK_BDF.hh"
 
+#include "pk_error_norm.hh"
+
 
 
 namespace Amanzi {
@@ -107,6 +114,16 @@ class PK_BDF_Default : public PK_BDF {
   // -- Check the admissibility of a solution.
   virtual bool IsAdmissible(Teuchos::RCP<const TreeVector> up) { return true; }
 
+  // -- Contribute this PK's error norm to a reduction over the PK tree.
+  //    The default contributes the (already reduced) ErrorNorm(); PKs
+  //    overriding this contribute local values only, and ErrorNorm()
+  //    becomes a single reduction.
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormReduction& enorm) {
+    enorm.Update(ErrorNorm(u, du));
+  }
+
   // -- Possibly modify the predictor that is going to be used as a
   //    starting value for the nonlinear solve in the time integrator.
   virtual bool ModifyPredictor(double h, Teuchos::RCP<const TreeVector> up,
@@ -127,6 +144,18 @@ class PK_BDF_Default : public PK_BDF {
   virtual void ChangedSolution() = 0;
   virtual void ChangedSolution(const Teuchos::Ptr<State>& S) = 0;
 
+  // Timers of the BDF interface, started by the time integrator and by MPCs
+  // when they call into this PK.
+  enum TimerType {
+    TIMER_FUNCTIONAL_RESIDUAL = 0,
+    TIMER_UPDATE_PRECONDITIONER,
+    TIMER_APPLY_PRECONDITIONER,
+    TIMER_ERROR_NORM,
+    TIMER_MODIFY_CORRECTION,
+    NUM_TIMERS
+  };
+  Teuchos::Time& timer(TimerType type);
+
  
  protected: // data
   // preconditioner assembly control
@@ -135,9 +164,11 @@ class PK_BDF_Default : public PK_BDF {
   // timestep control
   double dt_;
   Teuchos::RCP<BDF1_TI<TreeVector, TreeVectorSpace> > time_stepper_;
+  Teuchos::RCP<BDFFnBase<TreeVector> > timed_fn_;
 
   // timing
   Teuchos::RCP<Teuchos::Time> step_walltime_;
+  Teuchos::RCP<Teuchos::Time> timers_[NUM_TIMERS];
 
 };
 
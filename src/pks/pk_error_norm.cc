@@ -0,0 +1,97 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/* -------------------------------------------------------------------------
+ATS
+
+License: see $ATS_DIR/COPYRIGHT
+Author: Ethan Coon
+
+Accumulates error norm contributions across a PK tree for a single reduction.
+------------------------------------------------------------------------- */
+
+#include "errors.hh"
+#include "pk_error_norm.hh"
+
+namespace Amanzi {
+
+ErrorNormReduction::ErrorNormReduction() {
+  ENorm_t total;
+  total.value = 0.;
+  total.gid = -1;
+  data_.push_back(total);
+}
+
+
+void ErrorNormReduction::set_comm(const Teuchos::RCP<const Comm_type>& comm) {
+  if (comm_ == Teuchos::null) {
+    comm_ = comm;
+  } else if (comm.get() != comm_.get()) {
+    // a single reduction is only correct if all PKs share the communicator
+    int result;
+    MPI_Comm_compare(Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_)->Comm(),
+                     Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm)->Comm(), &result);
+    if (result != MPI_IDENT && result != MPI_CONGRUENT) {
+      Errors::Message msg("ErrorNormReduction: PKs contributing to one error norm are on different communicators.");
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+}
+
+
+void ErrorNormReduction::AddHeader(const Teuchos::RCP<VerboseObject>& vo,
+        const std::string& line) {
+  Line l;
+  l.vo = vo;
+  l.text = line;
+  l.index = -1;
+  lines_.push_back(l);
+}
+
+
+void ErrorNormReduction::AddComponent(const Teuchos::RCP<VerboseObject>& vo,
+        const std::string& comp, double value, int gid, double infnorm) {
+  Line l;
+  l.vo = vo;
+  l.text = comp;
+  l.index = data_.size();
+  lines_.push_back(l);
+
+  ENorm_t err;
+  err.value = value;
+  err.gid = gid;
+  data_.push_back(err);
+
+  // the inf norm only needs the max, its location is ignored
+  err.value = infnorm;
+  err.gid = 0;
+  data_.push_back(err);
+}
+
+
+double ErrorNormReduction::Reduce() {
+  if (comm_ != Teuchos::null) {
+    Teuchos::RCP<const MpiComm_type> mpi_comm_p =
+      Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_);
+    const MPI_Comm& comm = mpi_comm_p->Comm();
+
+    std::vector<ENorm_t> l_data(data_);
+    int ierr = MPI_Allreduce(&l_data[0], &data_[0], data_.size(),
+                             MPI_DOUBLE_INT, MPI_MAXLOC, comm);
+    AMANZI_ASSERT(!ierr);
+  }
+
+  for (std::vector<Line>::const_iterator l=lines_.begin(); l!=lines_.end(); ++l) {
+    Teuchos::OSTab tab = l->vo->getOSTab();
+    if (l->index < 0) {
+      *l->vo->os() << l->text << std::endl;
+    } else {
+      *l->vo->os() << "  ENorm (" << l->text << ") = " << data_[l->index].value
+                   << "[" << data_[l->index].gid << "] (" << data_[l->index+1].value
+                   << ")" << std::endl;
+    }
+  }
+  lines_.clear();
+  return data_[0].value;
+}
+
+} // namespace
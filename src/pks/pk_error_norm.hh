@@ -0,0 +1,83 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! Accumulates error norm contributions across a PK tree for a single reduction.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+
+/*!
+
+``ErrorNormReduction`` collects the local (on-process) error norms of every
+PK in a tree, along with the value and location of the maximum of each
+vector component that is reported in verbose output.  All values are packed
+into one array of (value, gid) pairs and reduced with a single
+``MPI_Allreduce(MPI_MAXLOC)`` once the whole tree has contributed, after which
+the verbose reports are written.
+
+*/
+
+#ifndef ATS_PK_ERROR_NORM_HH_
+#define ATS_PK_ERROR_NORM_HH_
+
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "VerboseObject.hh"
+
+namespace Amanzi {
+
+class ErrorNormReduction {
+
+ public:
+  ErrorNormReduction();
+
+  // The communicator used for the reduction.  All contributions must be on
+  // the same communicator; the first one set is kept.
+  void set_comm(const Teuchos::RCP<const Comm_type>& comm);
+
+  // Contribute a local norm to the overall norm.
+  void Update(double value) {
+    if (value > data_[0].value) data_[0].value = value;
+  }
+
+  // Verbose output: a header line, and a line per component reporting the
+  // reduced maximum, its global id, and the reduced inf norm.
+  void AddHeader(const Teuchos::RCP<VerboseObject>& vo, const std::string& line);
+  void AddComponent(const Teuchos::RCP<VerboseObject>& vo, const std::string& comp,
+                    double value, int gid, double infnorm);
+
+  // Reduce all values at once, write the verbose output, and return the
+  // global norm.
+  double Reduce();
+
+  double value() const { return data_[0].value; }
+
+ private:
+  // layout matches MPI_DOUBLE_INT
+  typedef struct ENorm_t {
+    double value;
+    int gid;
+  } ENorm_t;
+
+  struct Line {
+    Teuchos::RCP<VerboseObject> vo;
+    std::string text;
+    int index;  // first of two entries in data_, or -1 for a header
+  };
+
+  std::vector<ENorm_t> data_;
+  std::vector<Line> lines_;
+  Teuchos::RCP<const Comm_type> comm_;
+};
+
+} // namespace
+
+#endif
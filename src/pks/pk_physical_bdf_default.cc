@@ -69,6 +69,17 @@ void PK_PhysicalBDF_Default::Initialize(const Teuchos::Ptr<State>& S) {
 // -----------------------------------------------------------------------------
 double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
         Teuchos::RCP<const TreeVector> res) {
+  ErrorNormReduction enorm;
+  ErrorNormLocal(u, res, enorm);
+  return enorm.Reduce();
+};
+
+
+// -----------------------------------------------------------------------------
+// Local contribution to the default enorm, reduced by the caller.
+// -----------------------------------------------------------------------------
+void PK_PhysicalBDF_Default::ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+        Teuchos::RCP<const TreeVector> res, ErrorNormReduction& enorm) {
   // Abs tol based on old conserved quantity -- we know these have been vetted
   // at some level whereas the new quantity is some iterate, and may be
   // anything from negative to overflow.
@@ -79,19 +90,14 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       ->ViewComponent("cell",true);
 
   // VerboseObject stuff.
-  Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-    *vo_->os() << "ENorm (Infnorm) of: " << conserved_key_ << ": " << std::endl;
+    enorm.AddHeader(vo_, "ENorm (Infnorm) of: " + conserved_key_ + ": ");
 
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_next_->time() - S_inter_->time();
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
+  enorm.set_comm(mesh_->get_comm());
 
-  double enorm_val = 0.0;
   for (CompositeVector::name_iterator comp=dvec->begin();
        comp!=dvec->end(); ++comp) {
     double enorm_comp = 0.0;
@@ -114,14 +120,13 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
+      const std::vector<int>& face_cells = FaceCells_();
 
       for (unsigned int f=0; f!=nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min = cells.size() == 1 ? cv[0][cells[0]]
-            : std::min(cv[0][cells[0]],cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ? conserved[0][cells[0]]
-            : std::min(conserved[0][cells[0]],conserved[0][cells[1]]);
+        int c0 = face_cells[2*f];
+        int c1 = face_cells[2*f+1];
+        double cv_min = std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min = std::min(conserved[0][c0], conserved[0][c1]);
       
         double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f])
             / (atol_*cv_min + rtol_*std::abs(conserved_min));
@@ -139,30 +144,41 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
 
     // Write out Inf norms too.
     if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
+      enorm.AddComponent(vo_, *comp, enorm_comp, dvec_v.Map().GID(enorm_loc),
+                         LocalInfNorm_(dvec_v));
+    }
 
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
+    enorm.Update(enorm_comp);
+  }
+};
 
-      int ierr;
 
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] (" << infnorm << ")" << std::endl;
+// -----------------------------------------------------------------------------
+// Owned cells of each owned face, two per face (repeated on the boundary).
+// The mesh topology does not change, so these are computed once.
+// -----------------------------------------------------------------------------
+const std::vector<int>& PK_PhysicalBDF_Default::FaceCells_() {
+  int nfaces = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  if (face_cells_.size() != 2*nfaces) {
+    face_cells_.resize(2*nfaces);
+    AmanziMesh::Entity_ID_List cells;
+    for (int f=0; f!=nfaces; ++f) {
+      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
+      face_cells_[2*f] = cells[0];
+      face_cells_[2*f+1] = cells.size() == 1 ? cells[0] : cells[1];
     }
-
-    enorm_val = std::max(enorm_val, enorm_comp);
   }
+  return face_cells_;
+};
 
-  double enorm_val_l = enorm_val;
 
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
+// -----------------------------------------------------------------------------
+// Inf norm of the first vector on this process only.
+// -----------------------------------------------------------------------------
+double PK_PhysicalBDF_Default::LocalInfNorm_(const Epetra_MultiVector& v) {
+  double infnorm = 0.;
+  for (int i=0; i!=v.MyLength(); ++i) infnorm = std::max(infnorm, std::abs(v[0][i]));
+  return infnorm;
 };
 
 
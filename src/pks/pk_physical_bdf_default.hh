@@ -99,6 +99,11 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default,
   virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
                        Teuchos::RCP<const TreeVector> du) override;
 
+  // -- Local (unreduced) part of the norm, see ErrorNormReduction.
+  virtual void ErrorNormLocal(Teuchos::RCP<const TreeVector> u,
+                              Teuchos::RCP<const TreeVector> du,
+                              ErrorNormReduction& enorm) override;
+
   virtual bool ValidStep() override {
     return PK_Physical_Default::ValidStep() && PK_BDF_Default::ValidStep();
   }
@@ -135,6 +140,11 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default,
   Key cell_vol_key_;
   double atol_, rtol_, fluxtol_;
 
+  // owned cells of each owned face, for flux error norms
+  const std::vector<int>& FaceCells_();
+  static double LocalInfNorm_(const Epetra_MultiVector& v);
+  std::vector<int> face_cells_;
+
 };
 
 
@@ -37,12 +37,12 @@ Channels are: 0 = land/ice/water, 1 = snow.
 #define ALBEDO_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 
-class AlbedoEvaluator : public SecondaryVariablesFieldEvaluator {
+class AlbedoEvaluator : public TimedSecondaryVariablesFieldEvaluator {
  public:
   explicit
   AlbedoEvaluator(Teuchos::ParameterList& plist);
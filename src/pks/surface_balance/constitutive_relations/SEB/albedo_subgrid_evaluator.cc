@@ -43,7 +43,7 @@ namespace Amanzi {
 namespace SurfaceBalance {
 
 AlbedoSubgridEvaluator::AlbedoSubgridEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist)    
+    TimedSecondaryVariablesFieldEvaluator(plist)    
 {
   // determine the domain
   Key a_key = Keys::cleanPListName(plist.name());
@@ -37,12 +37,12 @@ Channels are: 0 = land, 1 = water/ice, 2 = snow.
 #define ALBEDO_SUBGRID_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 
-class AlbedoSubgridEvaluator : public SecondaryVariablesFieldEvaluator {
+class AlbedoSubgridEvaluator : public TimedSecondaryVariablesFieldEvaluator {
  public:
   explicit
   AlbedoSubgridEvaluator(Teuchos::ParameterList& plist);
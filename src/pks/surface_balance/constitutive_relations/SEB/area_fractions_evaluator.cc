@@ -41,7 +41,7 @@ namespace SurfaceBalance {
 
 // Constructor from ParameterList
 AreaFractionsEvaluator::AreaFractionsEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 { 
   //
   // NOTE: this evaluator simplifies the situation by assuming constant
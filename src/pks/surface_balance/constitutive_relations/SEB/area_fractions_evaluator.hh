@@ -18,12 +18,12 @@ Requires the following dependencies:
 #define AMANZI_SURFACE_BALANCE_AREA_FRACTIONS_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 
-class AreaFractionsEvaluator : public SecondaryVariableFieldEvaluator {
+class AreaFractionsEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
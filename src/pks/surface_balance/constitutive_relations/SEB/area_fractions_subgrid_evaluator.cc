@@ -48,7 +48,7 @@ namespace SurfaceBalance {
 
 // Constructor from ParameterList
 AreaFractionsSubgridEvaluator::AreaFractionsSubgridEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 { 
   //
   // NOTE: this evaluator simplifies the situation by assuming constant
@@ -34,12 +34,12 @@ Requires the following dependencies:
 #define AMANZI_SURFACE_BALANCE_AREA_FRACTIONS_SUBGRID_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 
-class AreaFractionsSubgridEvaluator : public SecondaryVariableFieldEvaluator {
+class AreaFractionsSubgridEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -25,7 +25,7 @@ namespace Amanzi {
 namespace SurfaceBalance {
 
 LongwaveEvaluator::LongwaveEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   auto domain = Keys::getDomain(my_key_);
   air_temp_key_ = Keys::readKey(plist, domain, "air temperature", "air_temperature");
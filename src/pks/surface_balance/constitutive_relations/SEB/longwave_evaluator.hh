@@ -19,12 +19,12 @@ Requires the following dependencies:
 #define AMANZI_SURFACE_BALANCE_LONGWAVE_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 
-class LongwaveEvaluator : public SecondaryVariableFieldEvaluator {
+class LongwaveEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -23,12 +23,12 @@ Author: Ethan Coon (coonet @ ornl.gov)
 
 #include "Factory.hh"
 #include "Debugger.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 
-class SEBEvaluator : public SecondaryVariablesFieldEvaluator {
+class SEBEvaluator : public TimedSecondaryVariablesFieldEvaluator {
  public:
   explicit
   SEBEvaluator(Teuchos::ParameterList& plist);
@@ -91,6 +91,8 @@ class SEBEvaluator : public SecondaryVariablesFieldEvaluator {
 
   
   bool diagnostics_, ss_topcell_based_evap_;
+  bool threaded_cell_loop_;
+  bool warm_start_snow_temp_;
   Teuchos::RCP<Debugger> db_;
   Teuchos::ParameterList plist_;
   
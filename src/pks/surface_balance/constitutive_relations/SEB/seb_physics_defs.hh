@@ -12,6 +12,7 @@
 #define SURFACEBALANCE_SEB_PHYSICS_DEFS_HH_
 
 #include <limits>
+#include <string>
 #include "Teuchos_ParameterList.hpp"
 #if 0
 #define MY_LOCAL_NAN std::numeric_limits<double>::signaling_NaN()
@@ -127,7 +128,8 @@ struct ModelParams {
       evap_transition_width(100.), // transition on evaporation from surface to evaporation from subsurface [m]
       gravity(9.807),
       Clapp_Horn_b(1.),          // Clapp and Hornberger "b" [-]
-      R_ideal_gas(461.52)       // ideal gas law R? [Pa m^3 kg^-1 K^-1]
+      R_ideal_gas(461.52),      // ideal gas law R? [Pa m^3 kg^-1 K^-1]
+      snow_temp_method("newton") // "newton", "bisection", or "toms"
   {}         // gravity [kg m / s^2]
   
   ModelParams(Teuchos::ParameterList& plist) :
@@ -135,6 +137,7 @@ struct ModelParams {
     thermalK_freshsnow = plist.get<double>("thermal conductivity of fresh snow [W m^-1 K^-1]", thermalK_freshsnow);
     thermalK_snow_exp = plist.get<double>("thermal conductivity of snow aging exponent [-]", thermalK_snow_exp);
     density_snow_max = plist.get<double>("max density of snow [kg m^-3]", density_snow_max);
+    snow_temp_method = plist.get<std::string>("snow temperature solver", snow_temp_method);
   }
   
   double density_air;
@@ -159,6 +162,8 @@ struct ModelParams {
   double water_ground_transition_depth;
   double gravity;
 
+  // solver used by DetermineSnowTemperature()
+  std::string snow_temp_method;
 };
 
 
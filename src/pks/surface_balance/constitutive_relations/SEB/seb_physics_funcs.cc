@@ -5,9 +5,12 @@
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include <tuple>
 #include "boost/math/tools/roots.hpp"
 
 #include "dbc.hh"
+#include "errors.hh"
 
 #include "seb_physics_funcs.hh"
 
@@ -17,6 +20,8 @@ namespace SEBPhysics {
 
 #define SWE_EPS 1.e-12
 #define ENERGY_BALANCE_TOL 1.e-8
+#define SNOW_TEMP_MAX_ITS 100
+#define SNOW_TEMP_MAX_STEP 10.0
 
 
 double CalcAlbedoSnow(double density_snow) {
@@ -86,6 +91,21 @@ double StabilityFunction(double air_temp, double skin_temp, double Us,
 }
 
 
+double DStabilityFunctionDSkinTemp(double air_temp, double skin_temp, double Us,
+        double Z_Us, double c_gravity)
+{
+  double dRi = -c_gravity * Z_Us / (air_temp * std::pow(Us,2));
+  double Ri  = dRi * (skin_temp - air_temp);
+  if (Ri >= 0.) {
+    // stable condition
+    return -10 * dRi / std::pow(1 + 10*Ri, 2);
+  } else {
+    // Unstable condition
+    return -10 * dRi;
+  }
+}
+
+
 double SaturatedVaporPressure(double temp)
 {
   // Sat vap. press o/water Dingman D-7 (Bolton, 1980)
@@ -94,6 +114,12 @@ double SaturatedVaporPressure(double temp)
   return 0.6112 * std::exp(17.67 * tempC / (tempC + 243.5));
 }
 
+double DSaturatedVaporPressureDTemp(double temp)
+{
+  double tempC = temp - 273.15;
+  return SaturatedVaporPressure(temp) * 17.67 * 243.5 / std::pow(tempC + 243.5, 2);
+}
+
 double VaporPressureAir(double air_temp, double relative_humidity)
 {
   return SaturatedVaporPressure(air_temp) * relative_humidity;
@@ -158,16 +184,21 @@ double LatentHeat(double resistance_coef,
       * (vapor_pressure_air - vapor_pressure_skin) / Apa;
 }
 
-double ConductedHeatIfSnow(double ground_temp,
-                           const SnowProperties& snow, const ModelParams& params)
+double SnowThermalConductivity(const SnowProperties& snow, const ModelParams& params)
 {
-  // Calculate heat conducted to ground, if snow
   double density = snow.density;
   if (density > 150) {
     // adjust for frost hoar
     density = 1. / ((0.90/density) + (0.10/150));
   }
-  double Ks = params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+  return params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+}
+
+double ConductedHeatIfSnow(double ground_temp,
+                           const SnowProperties& snow, const ModelParams& params)
+{
+  // Calculate heat conducted to ground, if snow
+  double Ks = SnowThermalConductivity(snow, params);
   return Ks * (snow.temp - ground_temp) / snow.height;
 }
 
@@ -201,6 +232,34 @@ void UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
   eb.fQm = eb.fQswIn + eb.fQlwIn - eb.fQlwOut + eb.fQh - eb.fQc + eb.fQe;
 }
 
+double DEnergyBalanceWithSnowDTemp_Inner(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params)
+{
+  // outgoing radiation
+  double dQlwOut = 4 * snow.emissivity * params.stephB * std::pow(snow.temp,3);
+
+  // sensible and latent heat both scale with the stability function
+  double Dhe = WindFactor(met.Us, met.Z_Us, CalcRoughnessFactor(snow.height, surf.roughness, snow.roughness), params.VKc);
+  double Sqig = StabilityFunction(met.air_temp, snow.temp, met.Us, met.Z_Us, params.gravity);
+  double dSqig = DStabilityFunctionDSkinTemp(met.air_temp, snow.temp, met.Us, met.Z_Us, params.gravity);
+  double dQh = Dhe * params.density_air * params.Cp_air
+               * (dSqig * (met.air_temp - snow.temp) - Sqig);
+
+  double vapor_pressure_air = VaporPressureAir(met.air_temp, met.relative_humidity);
+  double vapor_pressure_skin = SaturatedVaporPressure(snow.temp);
+  double dQe = Dhe * params.density_air * params.Ls * 0.622 / params.Apa
+               * (dSqig * (vapor_pressure_air - vapor_pressure_skin)
+                  - Sqig * DSaturatedVaporPressureDTemp(snow.temp));
+
+  // conducted heat
+  double dQc = SnowThermalConductivity(snow, params) / snow.height;
+
+  return -dQlwOut + dQh - dQc + dQe;
+}
+
+
 EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
         const MetData& met,
         const ModelParams& params,
@@ -210,7 +269,7 @@ EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
   
   // snow on the ground, solve for snow temperature
   std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
-  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb);
+  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb, params.snow_temp_method);
 
   if (snow.temp > 273.15) {
     // limit snow temp to 0, then melt with the remaining energy
@@ -274,26 +333,23 @@ EnergyBalance UpdateEnergyBalanceWithoutSnow(const GroundProperties& surf,
   return eb;
 }
 
-// Snow temperature calculation.
-double DetermineSnowTemperature(const GroundProperties& surf,
-        const MetData& met,
-        const ModelParams& params, 
-        SnowProperties& snow,
-        EnergyBalance& eb,
-        std::string method)
+// Snow temperature calculation, bracketing the root by stepping away from
+// T_start and then calling a boost bracketed solver.
+static double
+DetermineSnowTemperatureBracketed_(SnowTemperatureFunctor_& func, double T_start,
+        const std::string& method)
 {
-  SnowTemperatureFunctor_ func(&surf, &snow, &met, &params, &eb);
   Tol_ tol(ENERGY_BALANCE_TOL);
-  boost::uintmax_t max_it(100);
+  boost::uintmax_t max_it(SNOW_TEMP_MAX_ITS);
   double left, right;
   double res_left, res_right;
 
-  double res_init = func(surf.temp);
+  double res_init = func(T_start);
   if (res_init < 0.) {
-    right = surf.temp;
+    right = T_start;
     res_right = res_init;
 
-    left = surf.temp - 1.;
+    left = T_start - 1.;
     res_left = func(left);
     while (res_left < 0.) {
       right = left;
@@ -302,10 +358,10 @@ double DetermineSnowTemperature(const GroundProperties& surf,
       res_left = func(left);
     }
   } else {
-    left = surf.temp;
+    left = T_start;
     res_left = res_init;
 
-    right = surf.temp + 1.;
+    right = T_start + 1.;
     res_right = func(right);
     while (res_right > 0.) {
       left = right;
@@ -323,6 +379,10 @@ double DetermineSnowTemperature(const GroundProperties& surf,
     result = boost::math::tools::bisect(func, left, right, tol, max_it);
   } else if (method == "toms") {
     result = boost::math::tools::toms748_solve(func, left, right, res_left, res_right, tol, max_it);
+  } else {
+    Errors::Message msg;
+    msg << "SEB: unknown snow temperature method \"" << method << "\"";
+    Exceptions::amanzi_throw(msg);
   }
 
   if (max_it >= my_max_it) throw("Nonconverged Surface Energy Balance");
@@ -337,6 +397,72 @@ double DetermineSnowTemperature(const GroundProperties& surf,
 }
 
 
+// Snow temperature calculation via Newton's method.  The residual decreases
+// with temperature, so each evaluation tightens a bracket [left, right] on
+// the root; steps leaving the bracket, or uphill steps, are replaced by
+// bisection once the bracket is closed and by a limited step otherwise.
+// Returns false if not converged.
+static bool
+DetermineSnowTemperatureNewton_(SnowTemperatureFunctor_& func, double T_start,
+        double& solution)
+{
+  double left = -std::numeric_limits<double>::infinity();
+  double right = std::numeric_limits<double>::infinity();
+  double T = T_start;
+
+  for (int it=0; it!=SNOW_TEMP_MAX_ITS; ++it) {
+    double res, dres;
+    std::tie(res, dres) = func.ValueAndDerivative(T);
+    if (!std::isfinite(res)) return false;
+    if (res == 0.) {
+      solution = T;
+      return true;
+    }
+    if (res > 0.) left = T;
+    else right = T;
+
+    double T_new = T - res / dres;
+    if (!(dres < 0.) || !(T_new > left && T_new < right)) {
+      if (std::isfinite(left) && std::isfinite(right)) {
+        T_new = (left + right) / 2.;
+      } else {
+        T_new = res > 0. ? T + SNOW_TEMP_MAX_STEP : T - SNOW_TEMP_MAX_STEP;
+      }
+    } else if (std::abs(T_new - T) > SNOW_TEMP_MAX_STEP) {
+      T_new = T_new > T ? T + SNOW_TEMP_MAX_STEP : T - SNOW_TEMP_MAX_STEP;
+    }
+
+    if (std::abs(T_new - T) <= ENERGY_BALANCE_TOL || right - left <= ENERGY_BALANCE_TOL) {
+      solution = T_new;
+      return true;
+    }
+    T = T_new;
+  }
+  return false;
+}
+
+
+// Snow temperature calculation.
+double DetermineSnowTemperature(const GroundProperties& surf,
+        const MetData& met,
+        const ModelParams& params, 
+        SnowProperties& snow,
+        EnergyBalance& eb,
+        const std::string& method)
+{
+  // start from the provided snow temperature, if any
+  double T_start = std::isfinite(snow.temp) && snow.temp > 0. ? snow.temp : surf.temp;
+  SnowTemperatureFunctor_ func(&surf, &snow, &met, &params, &eb);
+
+  if (method == "newton") {
+    double solution;
+    if (DetermineSnowTemperatureNewton_(func, T_start, solution)) return solution;
+    return DetermineSnowTemperatureBracketed_(func, surf.temp, "toms");
+  }
+  return DetermineSnowTemperatureBracketed_(func, T_start, method);
+}
+
+
 MassBalance UpdateMassBalanceWithSnow(const GroundProperties& surf,
         const ModelParams& params, const EnergyBalance& eb)
 {
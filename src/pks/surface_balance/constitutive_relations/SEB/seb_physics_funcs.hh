@@ -7,6 +7,7 @@
 
 #include <cmath>
 #include <string>
+#include <utility>
 
 #include "VerboseObject.hh"
 #include "seb_physics_defs.hh"
@@ -56,6 +57,13 @@ double StabilityFunction(double air_temp, double skin_temp, double Us,
                          double Z_Us, double c_gravity);
 
 
+// 
+// Derivative of the stability function with respect to skin temperature.
+// ------------------------------------------------------------------------------------------
+double DStabilityFunctionDSkinTemp(double air_temp, double skin_temp, double Us,
+        double Z_Us, double c_gravity);
+
+
 // 
 // Partial pressure of water vapor in air, saturated.
 // After Dingman D-7 (Bolton, 1980).
@@ -63,6 +71,12 @@ double StabilityFunction(double air_temp, double skin_temp, double Us,
 // ------------------------------------------------------------------------------------------
 double SaturatedVaporPressure(double temp);
 
+// 
+// Derivative of saturated vapor pressure with respect to temperature.
+// In [kPa K^-1]
+// ------------------------------------------------------------------------------------------
+double DSaturatedVaporPressureDTemp(double temp);
+
 // 
 // Partial pressure of water vapor in air.
 // In [kPa]
@@ -106,11 +120,16 @@ double LatentHeat(double resistance_coef,
                   double vapor_pressure_skin,
                   double Apa);
 
+// 
+// Thermal conductivity of snow, as a function of density.
+// ------------------------------------------------------------------------------------------
+double SnowThermalConductivity(const SnowProperties& snow, const ModelParams& params);
+
 // 
 // Heat conducted to ground via simple diffusion model between snow and skin surface.
 // ------------------------------------------------------------------------------------------
 double ConductedHeatIfSnow(double ground_temp,
-                           const SnowProperties& snow);
+                           const SnowProperties& snow, const ModelParams& params);
 
 // 
 // Update the energy balance, solving for the amount of heat available to melt snow.
@@ -124,17 +143,32 @@ void UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
         const ModelParams& params,
         EnergyBalance& eb);
 
+// 
+// Derivative of the energy available for melting, as computed by
+// UpdateEnergyBalanceWithSnow_Inner(), with respect to snow temperature.
+// ------------------------------------------------------------------------------------------
+double DEnergyBalanceWithSnowDTemp_Inner(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params);
+
 // 
 // Determine the snow temperature by solving for energy balance, i.e. the snow
 // temp at equilibrium.  Assumes no melting (and therefore T_snow calculated
 // can be greater than 0 C.
+//
+// Methods are "newton" (the default), "bisection", and "toms".  The Newton
+// solve starts from snow.temp if it is a valid temperature (e.g. the previous
+// solution in this cell), otherwise from the surface temperature, and is
+// safeguarded by bisection once the root is bracketed.  If it fails to
+// converge, the bracketing TOMS 748 solve is used.
 // ------------------------------------------------------------------------------------------
 double DetermineSnowTemperature(const GroundProperties& surf,
         const MetData& met,
         const ModelParams& params,
         SnowProperties& snow,
         EnergyBalance& eb,
-        std::string method="toms");
+        const std::string& method="newton");
 
 
 // 
@@ -212,6 +246,12 @@ class SnowTemperatureFunctor_ {
     return eb_->fQm;
   }
 
+  // residual and its derivative, for Newton's method
+  std::pair<double,double> ValueAndDerivative(double temp) {
+    double res = (*this)(temp);
+    return std::make_pair(res, DEnergyBalanceWithSnowDTemp_Inner(*surf_, *snow_, *met_, *params_));
+  }
+
  private:
   GroundProperties const * const surf_;
   ModelParams const * const params_;
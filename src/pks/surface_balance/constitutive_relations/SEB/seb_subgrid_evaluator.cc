@@ -26,7 +26,11 @@ respectively.
 
 */
 
+#include <exception>
+#include <vector>
+
 #include "boost/algorithm/string/predicate.hpp"
+#include "Teuchos_Time.hpp"
 
 #include "VerboseObject.hh"
 #include "seb_subgrid_evaluator.hh"
@@ -37,7 +41,7 @@ namespace Amanzi {
 namespace SurfaceBalance {
 
 SubgridEvaluator::SubgridEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariablesFieldEvaluator(plist),
+    TimedSecondaryVariablesFieldEvaluator(plist),
     plist_(plist)
 {
   // determine the domain
@@ -92,13 +96,22 @@ SubgridEvaluator::SubgridEvaluator(Teuchos::ParameterList& plist) :
     albedo_key_ = Keys::readKey(plist, domain_, "albedo", "albedo");
     melt_key_ = Keys::readKey(plist, domain_, "snowmelt", "snowmelt");
     evap_key_ = Keys::readKey(plist, domain_, "evaporation", "evaporative_flux");
-    snow_temp_key_ = Keys::readKey(plist, domain_snow_, "snow temperature", "temperature");
     qE_sh_key_ = Keys::readKey(plist, domain_, "sensible heat flux", "qE_sensible_heat");
     qE_lh_key_ = Keys::readKey(plist, domain_, "latent heat of evaporation", "qE_latent_heat");
     qE_sm_key_ = Keys::readKey(plist, domain_, "latent heat of snowmelt", "qE_snowmelt");
     qE_lw_out_key_ = Keys::readKey(plist, domain_, "outgoing longwave radiation", "qE_lw_out");
     qE_cond_key_ = Keys::readKey(plist, domain_, "conducted energy flux", "qE_conducted");
   }
+
+  // snow temperature is a diagnostic, and, if requested, also the initial
+  // guess for the snow temperature solve in the next evaluation
+  warm_start_snow_temp_ = plist.get<bool>("warm start snow temperature", false);
+  if (diagnostics_ || warm_start_snow_temp_) {
+    snow_temp_key_ = Keys::readKey(plist, domain_snow_, "snow temperature", "temperature");
+  }
+
+  // If true and built with OpenMP, the cell loop is threaded.
+  threaded_cell_loop_ = plist.get<bool>("threaded cell loop", false);
   
   // dependencies  
   // -- met data
@@ -167,7 +180,8 @@ void
 SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
                              const std::vector<Teuchos::Ptr<CompositeVector> >& results)
 {
-  const SEBPhysics::ModelParams params;
+  SEBPhysics::ModelParams params;
+  params.snow_temp_method = plist_.get<std::string>("snow temperature solver", params.snow_temp_method);
 
   // collect met data
   const auto& qSW_in = *S->GetFieldData(met_sw_key_)->ViewComponent("cell",false);
@@ -223,8 +237,6 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     melt_rate->PutScalar(0.);
     evap_rate = S->GetFieldData(evap_key_, evap_key_)->ViewComponent("cell",false).get();
     evap_rate->PutScalar(0.);
-    snow_temp = S->GetFieldData(snow_temp_key_, snow_temp_key_)->ViewComponent("cell",false).get();
-    snow_temp->PutScalar(273.15);
     qE_sh = S->GetFieldData(qE_sh_key_, qE_sh_key_)->ViewComponent("cell",false).get();
     qE_sh->PutScalar(0.);
     qE_lh = S->GetFieldData(qE_lh_key_, qE_lh_key_)->ViewComponent("cell",false).get();
@@ -236,219 +248,261 @@ SubgridEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     qE_cond = S->GetFieldData(qE_cond_key_, qE_cond_key_)->ViewComponent("cell",false).get();
     qE_cond->PutScalar(0.);
   }
+  if (!snow_temp_key_.empty()) {
+    snow_temp = S->GetFieldData(snow_temp_key_, snow_temp_key_)->ViewComponent("cell",false).get();
+  }
   
-  unsigned int ncells = mass_source.MyLength();
-  for (unsigned int c=0; c!=ncells; ++c) {
-    // get the top cell
+  // Gather the subsurface cell below each surface cell and the area to
+  // volume ratio first, as mesh queries are not thread-safe.
+  int ncells = mass_source.MyLength();
+  std::vector<AmanziMesh::Entity_ID> top_cells(ncells);
+  std::vector<double> area_to_volume(ncells);
+  for (int c=0; c!=ncells; ++c) {
     AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, c);
     AmanziMesh::Entity_ID_List cells;
     mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
     AMANZI_ASSERT(cells.size() == 1);
+    top_cells[c] = cells[0];
+    area_to_volume[c] = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
+  }
 
-    // met data structure
-    SEBPhysics::MetData met;
-    met.Z_Us = wind_speed_ref_ht_;
-    met.Us = std::max(wind_speed[0][c], min_wind_speed_);
-    met.QswIn = qSW_in[0][c];
-    met.QlwIn = qLW_in[0][c];
-    met.air_temp = air_temp[0][c];
-    met.relative_humidity = rel_hum[0][c];
-    met.Pr = Prain[0][c];
+  // Subsurface sources are accumulated per surface cell and scattered after
+  // the loop, so every write in the loop is to the cell's own entries and
+  // the loop may be threaded.  Exceptions cannot leave a parallel region, so
+  // the first is kept and rethrown after the loop.
+  std::vector<double> ss_mass(ncells, 0.), ss_energy(ncells, 0.);
+  std::exception_ptr error;
+  double t_start = Teuchos::Time::wallTime();
+
+#ifdef _OPENMP
+#pragma omp parallel for if(threaded_cell_loop_) schedule(dynamic, 64)
+#endif
+  for (int c=0; c<ncells; ++c) {
+    try {
+      // met data structure
+      SEBPhysics::MetData met;
+      met.Z_Us = wind_speed_ref_ht_;
+      met.Us = std::max(wind_speed[0][c], min_wind_speed_);
+      met.QswIn = qSW_in[0][c];
+      met.QlwIn = qLW_in[0][c];
+      met.air_temp = air_temp[0][c];
+      met.relative_humidity = rel_hum[0][c];
+      met.Pr = Prain[0][c];
     
-    // bare ground column
-    if (area_fracs[0][c] > 0.) {
-      SEBPhysics::GroundProperties surf;
-      surf.temp = surf_temp[0][c];
-      surf.pressure = surf_pres[0][c];
-      surf.roughness = roughness_bare_ground_;
-      surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
-      surf.dz = dessicated_zone_thickness_;
-      surf.albedo = sg_albedo[0][c];
-      surf.emissivity = emissivity[0][c];
-
-      if (area_fracs[1][c] == 0) {
+      // bare ground column
+      if (area_fracs[0][c] > 0.) {
+        SEBPhysics::GroundProperties surf;
+        surf.temp = surf_temp[0][c];
+        surf.pressure = surf_pres[0][c];
+        surf.roughness = roughness_bare_ground_;
+        surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
+        surf.dz = dessicated_zone_thickness_;
+        surf.albedo = sg_albedo[0][c];
+        surf.emissivity = emissivity[0][c];
+
+        if (area_fracs[1][c] == 0) {
+          if (ponded_depth[0][c] > params.water_ground_transition_depth) {
+            surf.porosity = 1.;
+            surf.saturation_gas = 0.;
+            surf.ponded_depth = ponded_depth[0][c];
+          } else {
+            double factor = std::max(ponded_depth[0][c],0.)/params.water_ground_transition_depth;
+            surf.porosity = 1. * factor + poro[0][top_cells[c]] * (1-factor);
+            surf.saturation_gas = (1-factor) * sat_gas[0][top_cells[c]];
+            surf.ponded_depth = ponded_depth[0][c];
+          }
+        } else {
+          surf.porosity = poro[0][top_cells[c]];
+          surf.saturation_gas = sat_gas[0][top_cells[c]];
+          surf.ponded_depth = 0.;
+        }
+        surf.unfrozen_fraction = unfrozen_fraction[0][c];
+
+        // must ensure that energy is put into melting snow precip, even if it
+        // all melts so there is no snow column
+        if (area_fracs[2][c] == 0.) {
+          met.Ps = Psnow[0][c];
+          surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
+        } else {
+          met.Ps = 0.;
+          surf.snow_death_rate = 0.;
+        }
+
+        // calculate the surface balance
+        const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithoutSnow(surf, met, params);
+        SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithoutSnow(surf, params, eb);
+        SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithoutSnow(surf, met, params, eb, mb);
+
+        // fQe, Me positive is condensation, water flux positive to surface
+        mass_source[0][c] += area_fracs[0][c] * flux.M_surf;
+        energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
+
+        ss_mass[c] += area_fracs[0][c] * flux.M_subsurf * area_to_volume[c] * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
+        ss_energy[c] += area_fracs[0][c] * flux.E_subsurf * area_to_volume[c] * 1.e-6; // convert from W/m^2 to MW/m^3
+
+        snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
+        new_snow[0][c] += area_fracs[0][c] * met.Ps;
+
+        // diagnostics
+        if (diagnostics_) {
+          (*evap_rate)[0][c] -= area_fracs[0][c] * mb.Me;
+          (*qE_sh)[0][c] += area_fracs[0][c] * eb.fQh;
+          (*qE_lh)[0][c] += area_fracs[0][c] * eb.fQe;
+          (*qE_lw_out)[0][c] += area_fracs[0][c] * eb.fQlwOut;
+          (*qE_cond)[0][c] += area_fracs[0][c] * eb.fQc;
+          (*albedo)[0][c] += area_fracs[0][c] * surf.albedo;
+        
+          if (area_fracs[2][c] == 0.) {
+            (*qE_sm)[0][c] += area_fracs[0][c] * eb.fQm;
+            (*melt_rate)[0][c] += area_fracs[0][c] * mb.Mm;
+          }          
+        }
+      }
+
+      // water column
+      if (area_fracs[1][c] > 0.) {
+        SEBPhysics::GroundProperties surf;
+        surf.temp = surf_temp[0][c];
+        surf.pressure = surf_pres[0][c];
+        surf.roughness = roughness_bare_ground_;
+        surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
+        surf.dz = dessicated_zone_thickness_;
+        surf.emissivity = emissivity[1][c];
+        surf.albedo = sg_albedo[1][c];
+
         if (ponded_depth[0][c] > params.water_ground_transition_depth) {
           surf.porosity = 1.;
           surf.saturation_gas = 0.;
-          surf.ponded_depth = ponded_depth[0][c];
         } else {
           double factor = std::max(ponded_depth[0][c],0.)/params.water_ground_transition_depth;
-          surf.porosity = 1. * factor + poro[0][cells[0]] * (1-factor);
-          surf.saturation_gas = (1-factor) * sat_gas[0][cells[0]];
-          surf.ponded_depth = ponded_depth[0][c];
+          surf.porosity = 1. * factor + poro[0][top_cells[c]] * (1-factor);
+          surf.saturation_gas = (1-factor) * sat_gas[0][top_cells[c]];
         }
-      } else {
-        surf.porosity = poro[0][cells[0]];
-        surf.saturation_gas = sat_gas[0][cells[0]];
-        surf.ponded_depth = 0.;
-      }
-      surf.unfrozen_fraction = unfrozen_fraction[0][c];
-
-      // must ensure that energy is put into melting snow precip, even if it
-      // all melts so there is no snow column
-      if (area_fracs[2][c] == 0.) {
-        met.Ps = Psnow[0][c];
-        surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
-      } else {
-        met.Ps = 0.;
-        surf.snow_death_rate = 0.;
-      }
+        surf.ponded_depth = ponded_depth[0][c];
+        surf.unfrozen_fraction = unfrozen_fraction[0][c];
 
-      // calculate the surface balance
-      const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithoutSnow(surf, met, params);
-      SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithoutSnow(surf, params, eb);
-      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithoutSnow(surf, met, params, eb, mb);
-
-      // fQe, Me positive is condensation, water flux positive to surface
-      mass_source[0][c] += area_fracs[0][c] * flux.M_surf;
-      energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
-
-      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
-      ss_mass_source[0][cells[0]] += area_fracs[0][c] * flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
-      ss_energy_source[0][cells[0]] += area_fracs[0][c] * flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-
-      snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
-      new_snow[0][c] += area_fracs[0][c] * met.Ps;
-
-      // diagnostics
-      if (diagnostics_) {
-        (*evap_rate)[0][c] -= area_fracs[0][c] * mb.Me;
-        (*qE_sh)[0][c] += area_fracs[0][c] * eb.fQh;
-        (*qE_lh)[0][c] += area_fracs[0][c] * eb.fQe;
-        (*qE_lw_out)[0][c] += area_fracs[0][c] * eb.fQlwOut;
-        (*qE_cond)[0][c] += area_fracs[0][c] * eb.fQc;
-        (*albedo)[0][c] += area_fracs[0][c] * surf.albedo;
-        
+        // must ensure that energy is put into melting snow precip, even if it
+        // all melts so there is no snow column
         if (area_fracs[2][c] == 0.) {
-          (*qE_sm)[0][c] += area_fracs[0][c] * eb.fQm;
-          (*melt_rate)[0][c] += area_fracs[0][c] * mb.Mm;
-          (*snow_temp)[0][c] = 273.15;
-        }          
+          met.Ps = Psnow[0][c];
+          surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
+        } else {
+          met.Ps = 0.;
+          surf.snow_death_rate = 0.;
+        }
+
+        // calculate the surface balance
+        const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithoutSnow(surf, met, params);
+        const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithoutSnow(surf, params, eb);
+        SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithoutSnow(surf, met, params, eb, mb);
+
+        // fQe, Me positive is condensation, water flux positive to surface
+        mass_source[0][c] += area_fracs[1][c] * flux.M_surf;
+        energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6;
+
+        ss_mass[c] += area_fracs[1][c] * flux.M_subsurf * area_to_volume[c] * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
+        ss_energy[c] += area_fracs[1][c] * flux.E_subsurf * area_to_volume[c] * 1.e-6; // convert from W/m^2 to MW/m^3
+
+        snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
+        new_snow[0][c] += area_fracs[1][c] * met.Ps;
+
+        // diagnostics
+        if (diagnostics_) {
+          (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
+          (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
+          (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
+          (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
+          (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
+          (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
+        
+          if (area_fracs[2][c] == 0.) {
+            (*qE_sm)[0][c] += area_fracs[1][c] * eb.fQm;
+            (*melt_rate)[0][c] += area_fracs[1][c] * mb.Mm;
+          }          
+        }
       }
-    }
 
-    // water column
-    if (area_fracs[1][c] > 0.) {
-      SEBPhysics::GroundProperties surf;
-      surf.temp = surf_temp[0][c];
-      surf.pressure = surf_pres[0][c];
-      surf.roughness = roughness_bare_ground_;
-      surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
-      surf.dz = dessicated_zone_thickness_;
-      surf.emissivity = emissivity[1][c];
-      surf.albedo = sg_albedo[1][c];
-
-      if (ponded_depth[0][c] > params.water_ground_transition_depth) {
-        surf.porosity = 1.;
+      // snow column
+      if (area_fracs[2][c] > 0.) {
+        SEBPhysics::GroundProperties surf;
+        surf.temp = surf_temp[0][c];
+        surf.pressure = surf_pres[0][c];
+        surf.roughness = roughness_bare_ground_;
+        surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
+        surf.dz = dessicated_zone_thickness_;
+        surf.emissivity = emissivity[2][c];
+        surf.albedo = sg_albedo[2][c];
+
         surf.saturation_gas = 0.;
-      } else {
-        double factor = std::max(ponded_depth[0][c],0.)/params.water_ground_transition_depth;
-        surf.porosity = 1. * factor + poro[0][cells[0]] * (1-factor);
-        surf.saturation_gas = (1-factor) * sat_gas[0][cells[0]];
-      }
-      surf.ponded_depth = ponded_depth[0][c];
-      surf.unfrozen_fraction = unfrozen_fraction[0][c];
-
-      // must ensure that energy is put into melting snow precip, even if it
-      // all melts so there is no snow column
-      if (area_fracs[2][c] == 0.) {
-        met.Ps = Psnow[0][c];
-        surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
-      } else {
-        met.Ps = 0.;
-        surf.snow_death_rate = 0.;
-      }
+        surf.porosity = 1.;
+        surf.ponded_depth = 0.;
+        surf.unfrozen_fraction = unfrozen_fraction[0][c];
 
-      // calculate the surface balance
-      const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithoutSnow(surf, met, params);
-      const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithoutSnow(surf, params, eb);
-      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithoutSnow(surf, met, params, eb, mb);
-
-      // fQe, Me positive is condensation, water flux positive to surface
-      mass_source[0][c] += area_fracs[1][c] * flux.M_surf;
-      energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6;
-
-      double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
-      ss_mass_source[0][cells[0]] += area_fracs[1][c] * flux.M_subsurf * area_to_volume * params.density_water / 0.0180153; // convert from m/m^2/s to mol/m^3/s
-      ss_energy_source[0][cells[0]] += area_fracs[1][c] * flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-
-      snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
-      new_snow[0][c] += area_fracs[1][c] * met.Ps;
-
-      // diagnostics
-      if (diagnostics_) {
-        (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
-        (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
-        (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
-        (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
-        (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
-        (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
-        
-        if (area_fracs[2][c] == 0.) {
-          (*qE_sm)[0][c] += area_fracs[1][c] * eb.fQm;
-          (*melt_rate)[0][c] += area_fracs[1][c] * mb.Mm;
-          (*snow_temp)[0][c] = 273.15;
+        met.Ps = Psnow[0][c] / area_fracs[2][c];
+      
+        SEBPhysics::SnowProperties snow;
+        // take the snow height to be some measure of average thickness -- use
+        // volumetric snow depth divided by the area fraction of snow
+        snow.height = snow_volumetric_depth[0][c] / area_fracs[2][c];
+
+        AMANZI_ASSERT(snow.height >= snow_ground_trans_ - 1.e-6);
+         // area_fracs may have been set to 1 for snow depth < snow_ground_trans
+         // due to min fractional area option in area_fractions evaluator.
+         // Decreasing the tol by 1e-6 is about equivalent to a min fractional
+         // area of 1e-5 (the default)
+        snow.density = snow_dens[0][c];
+        snow.albedo = surf.albedo;
+        snow.emissivity = surf.emissivity;
+        snow.roughness = roughness_snow_covered_ground_;
+
+        if (warm_start_snow_temp_) snow.temp = (*snow_temp)[0][c];
+
+        const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
+        const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithSnow(surf, params, eb);
+        SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
+
+        // fQe, Me positive is condensation, water flux positive to surface.  Subsurf is 0 because of snow
+        mass_source[0][c] += area_fracs[2][c] * flux.M_surf;
+        energy_source[0][c] += area_fracs[2][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
+        snow_source[0][c] += area_fracs[2][c] * flux.M_snow;
+        new_snow[0][c] += (met.Ps + std::max(mb.Me, 0.)) * area_fracs[2][c];
+
+        // diagnostics
+        if (diagnostics_) {
+          (*evap_rate)[0][c] -= area_fracs[2][c] * mb.Me;
+          (*qE_sh)[0][c] += area_fracs[2][c] * eb.fQh;
+          (*qE_lh)[0][c] += area_fracs[2][c] * eb.fQe;
+          (*qE_lw_out)[0][c] += area_fracs[2][c] * eb.fQlwOut;
+          (*qE_cond)[0][c] += area_fracs[2][c] * eb.fQc;
+
+          (*qE_sm)[0][c] = area_fracs[2][c] * eb.fQm;
+          (*melt_rate)[0][c] = area_fracs[2][c] * mb.Mm;
+          (*albedo)[0][c] += area_fracs[2][c] * surf.albedo;
         }          
+
+        if (snow_temp) (*snow_temp)[0][c] = snow.temp;
+      } else if (snow_temp) {
+        (*snow_temp)[0][c] = 273.15;
       }
+    } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(seb_error)
+#endif
+      if (!error) error = std::current_exception();
     }
+  }
+  if (error) std::rethrow_exception(error);
 
-    // snow column
-    if (area_fracs[2][c] > 0.) {
-      SEBPhysics::GroundProperties surf;
-      surf.temp = surf_temp[0][c];
-      surf.pressure = surf_pres[0][c];
-      surf.roughness = roughness_bare_ground_;
-      surf.density_w = params.density_water; // NOTE: could update this to use true density! --etc
-      surf.dz = dessicated_zone_thickness_;
-      surf.emissivity = emissivity[2][c];
-      surf.albedo = sg_albedo[2][c];
-
-      surf.saturation_gas = 0.;
-      surf.porosity = 1.;
-      surf.ponded_depth = 0.;
-      surf.unfrozen_fraction = unfrozen_fraction[0][c];
-
-      met.Ps = Psnow[0][c] / area_fracs[2][c];
-      
-      SEBPhysics::SnowProperties snow;
-      // take the snow height to be some measure of average thickness -- use
-      // volumetric snow depth divided by the area fraction of snow
-      snow.height = snow_volumetric_depth[0][c] / area_fracs[2][c];
-
-      AMANZI_ASSERT(snow.height >= snow_ground_trans_ - 1.e-6);
-       // area_fracs may have been set to 1 for snow depth < snow_ground_trans
-       // due to min fractional area option in area_fractions evaluator.
-       // Decreasing the tol by 1e-6 is about equivalent to a min fractional
-       // area of 1e-5 (the default)
-      snow.density = snow_dens[0][c];
-      snow.albedo = surf.albedo;
-      snow.emissivity = surf.emissivity;
-      snow.roughness = roughness_snow_covered_ground_;
-
-      const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
-      const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithSnow(surf, params, eb);
-      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
-
-      // fQe, Me positive is condensation, water flux positive to surface.  Subsurf is 0 because of snow
-      mass_source[0][c] += area_fracs[2][c] * flux.M_surf;
-      energy_source[0][c] += area_fracs[2][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
-      snow_source[0][c] += area_fracs[2][c] * flux.M_snow;
-      new_snow[0][c] += (met.Ps + std::max(mb.Me, 0.)) * area_fracs[2][c];
-
-      // diagnostics
-      if (diagnostics_) {
-        (*evap_rate)[0][c] -= area_fracs[2][c] * mb.Me;
-        (*qE_sh)[0][c] += area_fracs[2][c] * eb.fQh;
-        (*qE_lh)[0][c] += area_fracs[2][c] * eb.fQe;
-        (*qE_lw_out)[0][c] += area_fracs[2][c] * eb.fQlwOut;
-        (*qE_cond)[0][c] += area_fracs[2][c] * eb.fQc;
-
-        (*qE_sm)[0][c] = area_fracs[2][c] * eb.fQm;
-        (*melt_rate)[0][c] = area_fracs[2][c] * mb.Mm;
-        (*snow_temp)[0][c] = snow.temp;
-        (*albedo)[0][c] += area_fracs[2][c] * surf.albedo;
-      }          
-    }
+  for (int c=0; c!=ncells; ++c) {
+    ss_mass_source[0][top_cells[c]] += ss_mass[c];
+    ss_energy_source[0][top_cells[c]] += ss_energy[c];
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "SubgridEvaluator: " << ncells << " cells in "
+               << Teuchos::Time::wallTime() - t_start << " s"
+               << (threaded_cell_loop_ ? " (threaded)" : "") << std::endl;
   }
 
   // debugging
@@ -633,7 +687,6 @@ SubgridEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
     S->RequireField(albedo_key_, albedo_key_)->Update(domain_fac_owned);
     S->RequireField(melt_key_, melt_key_)->Update(domain_fac_owned);
     S->RequireField(evap_key_, evap_key_)->Update(domain_fac_owned);
-    S->RequireField(snow_temp_key_, snow_temp_key_)->Update(domain_fac_owned_snow);
     S->RequireField(qE_sh_key_, qE_sh_key_)->Update(domain_fac_owned);
     S->RequireField(qE_lh_key_, qE_lh_key_)->Update(domain_fac_owned);
     S->RequireField(qE_sm_key_, qE_sm_key_)->Update(domain_fac_owned);
@@ -642,13 +695,16 @@ SubgridEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
     S->GetField(albedo_key_, albedo_key_)->set_initialized(true);
     S->GetField(melt_key_, melt_key_)->set_initialized(true);
     S->GetField(evap_key_, evap_key_)->set_initialized(true);
-    S->GetField(snow_temp_key_, snow_temp_key_)->set_initialized(true);
     S->GetField(qE_sh_key_, qE_sh_key_)->set_initialized(true);
     S->GetField(qE_lh_key_, qE_lh_key_)->set_initialized(true);
     S->GetField(qE_sm_key_, qE_sm_key_)->set_initialized(true);
     S->GetField(qE_lw_out_key_, qE_lw_out_key_)->set_initialized(true);
     S->GetField(qE_cond_key_, qE_cond_key_)->set_initialized(true);
   }
+  if (!snow_temp_key_.empty()) {
+    S->RequireField(snow_temp_key_, snow_temp_key_)->Update(domain_fac_owned_snow);
+    S->GetField(snow_temp_key_, snow_temp_key_)->set_initialized(true);
+  }
   
   for (auto dep_key : dependencies_) {
     auto fac = S->RequireField(dep_key);
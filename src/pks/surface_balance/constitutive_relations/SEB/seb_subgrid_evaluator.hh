@@ -32,12 +32,12 @@ respectively.
 
 #include "Factory.hh"
 #include "Debugger.hh"
-#include "secondary_variables_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 
-class SubgridEvaluator : public SecondaryVariablesFieldEvaluator {
+class SubgridEvaluator : public TimedSecondaryVariablesFieldEvaluator {
  public:
   explicit
   SubgridEvaluator(Teuchos::ParameterList& plist);
@@ -99,6 +99,8 @@ class SubgridEvaluator : public SecondaryVariablesFieldEvaluator {
                                      // table drops below the surface.
 
   bool diagnostics_;
+  bool threaded_cell_loop_;
+  bool warm_start_snow_temp_;
   Teuchos::RCP<Debugger> db_;
   Teuchos::ParameterList plist_;
   
@@ -0,0 +1,135 @@
+#include <cmath>
+#include <tuple>
+
+#include "UnitTest++.h"
+
+#include "seb_physics_defs.hh"
+#include "seb_physics_funcs.hh"
+
+using namespace Amanzi::SurfaceBalance::SEBPhysics;
+
+// The snow temperature solve over a range of forcings: cold and warm air,
+// calm and windy, night and day, thin and deep snow, over frozen and thawed
+// ground.
+struct seb_snow {
+  GroundProperties surf;
+  SnowProperties snow;
+  MetData met;
+  ModelParams params;
+
+  seb_snow() {
+    surf.temp = 270.15;
+    surf.roughness = 0.04;
+
+    snow.height = 0.3;
+    snow.density = 200.;
+    snow.albedo = 0.8;
+    snow.emissivity = 0.98;
+    snow.roughness = 0.005;
+
+    met.Us = 3.;
+    met.Z_Us = 2.;
+    met.QswIn = 100.;
+    met.QlwIn = 250.;
+    met.Ps = 0.;
+    met.Pr = 0.;
+    met.air_temp = 265.15;
+    met.relative_humidity = 0.8;
+  }
+
+  // calls f() for each combination of forcings
+  template<class F>
+  void forEachForcing(F f) {
+    const double air_temps[] = { 243.15, 258.15, 268.15, 272.15, 276.15 };
+    const double winds[] = { 0.5, 3., 12. };
+    const double sws[] = { 0., 150., 600. };
+    const double heights[] = { 0.02, 0.3, 1.5 };
+    const double ground_temps[] = { 263.15, 273.15, 275.15 };
+    for (double air_temp : air_temps) {
+      for (double Us : winds) {
+        for (double QswIn : sws) {
+          for (double ht : heights) {
+            for (double ground_temp : ground_temps) {
+              met.air_temp = air_temp;
+              met.Us = Us;
+              met.QswIn = QswIn;
+              met.QlwIn = 4. * air_temp - 800.;
+              snow.height = ht;
+              surf.temp = ground_temp;
+              f();
+            }
+          }
+        }
+      }
+    }
+  }
+
+  double solve(const std::string& method, double T_start) {
+    EnergyBalance eb;
+    std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
+    SnowProperties s(snow);
+    s.temp = T_start;
+    return DetermineSnowTemperature(surf, met, params, s, eb, method);
+  }
+
+  double residual(double T) {
+    EnergyBalance eb;
+    std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
+    SnowProperties s(snow);
+    s.temp = T;
+    UpdateEnergyBalanceWithSnow_Inner(surf, s, met, params, eb);
+    return eb.fQm;
+  }
+
+  double dresidual(double T) {
+    SnowProperties s(snow);
+    s.temp = T;
+    return DEnergyBalanceWithSnowDTemp_Inner(surf, s, met, params);
+  }
+};
+
+
+// Newton, cold or warm started, finds the root TOMS 748 finds.
+TEST_FIXTURE(seb_snow, SnowTemperatureNewtonMatchesTOMS) {
+  forEachForcing([this]() {
+    double T_toms = solve("toms", MY_LOCAL_NAN);
+    double T_newton = solve("newton", MY_LOCAL_NAN);
+    CHECK_CLOSE(T_toms, T_newton, 1.e-6);
+
+    // warm started, from near and far
+    CHECK_CLOSE(T_toms, solve("newton", T_toms + 0.5), 1.e-6);
+    CHECK_CLOSE(T_toms, solve("newton", T_toms - 20.), 1.e-6);
+
+    // bisection agrees too
+    CHECK_CLOSE(T_toms, solve("bisection", MY_LOCAL_NAN), 1.e-6);
+  });
+}
+
+
+// The analytic derivative of the residual matches a centered difference.
+// Neutral stability, air temperature equal to snow temperature, is a kink
+// in the stability function, so is not sampled.
+TEST_FIXTURE(seb_snow, SnowTemperatureDerivative) {
+  const double h = 1.e-4;
+  forEachForcing([this,h]() {
+    for (double dT = -30.; dT <= 30.; dT += 2.5) {
+      double T = met.air_temp + dT;
+      if (std::abs(dT) < 10*h) continue;
+      double dres_fd = (residual(T + h) - residual(T - h)) / (2*h);
+      double dres = dresidual(T);
+      CHECK_CLOSE(dres_fd, dres, 1.e-5 * (1. + std::abs(dres_fd)));
+    }
+  });
+}
+
+
+// An unknown method is an error.
+TEST_FIXTURE(seb_snow, SnowTemperatureUnknownMethod) {
+  bool thrown = false;
+  try {
+    solve("secant", MY_LOCAL_NAN);
+  } catch (...) {
+    thrown = true;
+  }
+  CHECK(thrown);
+}
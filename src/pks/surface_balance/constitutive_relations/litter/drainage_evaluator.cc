@@ -12,7 +12,7 @@ namespace SurfaceBalance {
 namespace Relations {
 
 DrainageEvaluator::DrainageEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist) {
+    TimedSecondaryVariableFieldEvaluator(plist) {
 
   std::string domain = plist_.get<std::string>("layer name");
   
@@ -52,7 +52,7 @@ DrainageEvaluator::DrainageEvaluator(Teuchos::ParameterList& plist) :
 
 
 DrainageEvaluator::DrainageEvaluator(const DrainageEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     wc_key_(other.wc_key_),
     ai_key_(other.ai_key_),
     pd_key_(other.pd_key_),
@@ -30,13 +30,13 @@
 #define AMANZI_RELATIONS_DRAINAGE_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
 
-class DrainageEvaluator : public SecondaryVariableFieldEvaluator {
+class DrainageEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
 
@@ -22,7 +22,7 @@
 #define AMANZI_SURFACEBALANCE_EVAPORATIVE_FLUX_RELAXATION_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -30,7 +30,7 @@ namespace Relations {
 
 class EvaporativeFluxRelaxationModel;
 
-class EvaporativeFluxRelaxationEvaluator : public SecondaryVariableFieldEvaluator {
+class EvaporativeFluxRelaxationEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -29,13 +29,13 @@
 #define AMANZI_RELATIONS_INTERCEPTION_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
 
-class InterceptionEvaluator : public SecondaryVariableFieldEvaluator {
+class InterceptionEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
 
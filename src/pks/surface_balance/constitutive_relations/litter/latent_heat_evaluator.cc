@@ -33,7 +33,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 LatentHeatEvaluator::LatentHeatEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("latent_heat parameters");
   model_ = Teuchos::rcp(new LatentHeatModel(sublist));
@@ -43,7 +43,7 @@ LatentHeatEvaluator::LatentHeatEvaluator(Teuchos::ParameterList& plist) :
 
 // Copy constructor
 LatentHeatEvaluator::LatentHeatEvaluator(const LatentHeatEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     qe_key_(other.qe_key_),    
     model_(other.model_) {}
 
@@ -28,7 +28,7 @@
 #define AMANZI_SURFACEBALANCE_LATENT_HEAT_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -36,7 +36,7 @@ namespace Relations {
 
 class LatentHeatModel;
 
-class LatentHeatEvaluator : public SecondaryVariableFieldEvaluator {
+class LatentHeatEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -22,7 +22,7 @@
 #define AMANZI_SURFACEBALANCE_MACROPORE_SURFACE_FLUX_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -30,7 +30,7 @@ namespace Relations {
 
 class MacroporeSurfaceFluxModel;
 
-class MacroporeSurfaceFluxEvaluator : public SecondaryVariableFieldEvaluator {
+class MacroporeSurfaceFluxEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
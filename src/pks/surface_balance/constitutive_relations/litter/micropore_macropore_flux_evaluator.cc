@@ -27,7 +27,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 MicroporeMacroporeFluxEvaluator::MicroporeMacroporeFluxEvaluator(Teuchos::ParameterList& plist) :
-    SecondaryVariableFieldEvaluator(plist)
+    TimedSecondaryVariableFieldEvaluator(plist)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("micropore_macropore_flux parameters");
   model_ = Teuchos::rcp(new MicroporeMacroporeFluxModel(sublist));
@@ -37,7 +37,7 @@ MicroporeMacroporeFluxEvaluator::MicroporeMacroporeFluxEvaluator(Teuchos::Parame
 
 // Copy constructor
 MicroporeMacroporeFluxEvaluator::MicroporeMacroporeFluxEvaluator(const MicroporeMacroporeFluxEvaluator& other) :
-    SecondaryVariableFieldEvaluator(other),
+    TimedSecondaryVariableFieldEvaluator(other),
     pm_key_(other.pm_key_),
     pM_key_(other.pM_key_),
     krM_key_(other.krM_key_),
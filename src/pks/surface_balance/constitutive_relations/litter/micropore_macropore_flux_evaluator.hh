@@ -22,7 +22,7 @@
 #define AMANZI_SURFACEBALANCE_MICROPORE_MACROPORE_FLUX_EVALUATOR_HH_
 
 #include "Factory.hh"
-#include "secondary_variable_field_evaluator.hh"
+#include "TimedEvaluator.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -30,7 +30,7 @@ namespace Relations {
 
 class MicroporeMacroporeFluxModel;
 
-class MicroporeMacroporeFluxEvaluator : public SecondaryVariableFieldEvaluator {
+class MicroporeMacroporeFluxEvaluator : public TimedSecondaryVariableFieldEvaluator {
 
  public:
   explicit
@@ -36,11 +36,23 @@ void Transport_PK_ATS::InitializeAll_()
   // global transport parameters
   cfl_ = tp_list_->get<double>("cfl", 1.0);
 
+  // local (multirate) time stepping of the first-order scheme
+  local_time_stepping_ = tp_list_->get<bool>("local time stepping", false);
+  lts_max_levels_ = tp_list_->get<int>("local time stepping levels", 4);
+  if (lts_max_levels_ < 0) lts_max_levels_ = 0;
+
   spatial_disc_order = tp_list_->get<int>("spatial discretization order", 1);
   if (spatial_disc_order < 1 || spatial_disc_order > 2) spatial_disc_order = 1;
   temporal_disc_order = tp_list_->get<int>("temporal discretization order", 1);
   if (temporal_disc_order < 1 || temporal_disc_order > 2) temporal_disc_order = 1;
 
+  if (local_time_stepping_ && spatial_disc_order != 1) {
+    local_time_stepping_ = false;
+    if (vo_->getVerbLevel() >= Teuchos::VERB_LOW) {
+      *vo_->os() << "Local time stepping requires the first-order scheme, it is disabled.\n";
+    }
+  }
+
   num_aqueous = tp_list_->get<int>("number of aqueous components", component_names_.size());
   num_gaseous = tp_list_->get<int>("number of gaseous components", 0);
 
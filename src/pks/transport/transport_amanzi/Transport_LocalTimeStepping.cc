@@ -0,0 +1,287 @@
+/*
+  Transport PK
+
+  Copyright 2010-201x held jointly by LANS/LANL, LBNL, and PNNL.
+  Amanzi is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Author: Konstantin Lipnikov (lipnikov@lanl.gov)
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Epetra_Import.h"
+
+#include "Transport_PK_ATS.hh"
+
+namespace Amanzi {
+namespace Transport {
+
+/* *******************************************************************
+* First-order upwind scheme with local (multirate) time stepping.
+*
+* The MPC step is split into nsteps substeps of size dt_sub, where
+* nsteps is a multiple of 2^L. A cell of level k <= L advances with
+* the step dt_sub * 2^k, which is the largest such step that does not
+* exceed its own stable step. A face is updated with the level of the
+* finer of its two cells, and the flux is added to both cells at once,
+* so that the scheme is conservative. Concentrations are recovered
+* from the conservative state using saturation and molar density
+* interpolated to the time of the update.
+*
+* As in AdvanceDonorUpwind(), concentrations are the cell-major tcc_cm_,
+* whose owned cells are current on entry and are current on exit.
+*
+* Returns the number of substeps of the finest level.
+******************************************************************* */
+int Transport_PK_ATS::AdvanceDonorUpwindLocal(
+    double t_old, double dt_MPC, double dt_shift, double dt_global, double dt_stable)
+{
+  mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
+  mass_solutes_bc_.assign(num_aqueous + num_gaseous, 0.0);
+
+  // We advect only aqueous components.
+  int num_advect = num_aqueous;
+
+  // number of levels and substeps; these are identical on all processors
+  int nfine = std::max(1, (int)std::ceil(dt_MPC / dt_stable - 1e-10));
+  int nlevels = 0;
+  while (nlevels < lts_max_levels_ && (2 << nlevels) <= nfine) nlevels++;
+
+  int nblock = 1 << nlevels;
+  int nsteps = nblock * ((nfine + nblock - 1) / nblock);
+  double dt_sub = dt_MPC / nsteps;
+
+  // assign levels to owned cells and distribute them to ghost cells
+  const Epetra_Map& cmap_owned = mesh_->cell_map(false);
+  const Epetra_Map& cmap_wghost = mesh_->cell_map(true);
+  if (cell_importer == Teuchos::null) {
+    cell_importer = Teuchos::rcp(new Epetra_Import(cmap_wghost, cmap_owned));
+  }
+
+  Epetra_IntVector level_owned(cmap_owned);
+  for (int c = 0; c < ncells_owned; c++) {
+    double dt_c = cfl_ * std::min(dt_cell_[c], dt_debug_);
+    int k = 0;
+    while (k < nlevels && dt_sub * (2 << k) <= dt_c) k++;
+    level_owned[c] = k;
+  }
+
+  Epetra_IntVector level(cmap_wghost);
+  level.Import(level_owned, *cell_importer, Insert);
+
+  // group faces by level; a face belongs to the finer of its cells
+  std::vector<std::vector<int> > faces(nlevels + 1);
+  std::vector<int> cell_level(ncells_owned, nlevels + 1);
+
+  for (int f = 0; f < nfaces_wghost; f++) {
+    int c1 = (*upwind_cell_)[f];
+    int c2 = (*downwind_cell_)[f];
+    if (c1 < 0) continue;  // inflow faces are treated as boundary faces
+    if (c1 >= ncells_owned && (c2 < 0 || c2 >= ncells_owned)) continue;
+    if ((*flux_)[0][f] == 0.0) continue;
+
+    int k = (c2 >= 0) ? std::min(level[c1], level[c2]) : level[c1];
+    faces[k].push_back(f);
+    if (c1 < ncells_owned) cell_level[c1] = std::min(cell_level[c1], k);
+  }
+
+  // group upwind cells by the finest level of their outflow faces
+  std::vector<std::vector<int> > cells(nlevels + 1);
+  for (int c = 0; c < ncells_owned; c++) {
+    if (cell_level[c] <= nlevels) cells[cell_level[c]].push_back(c);
+  }
+
+  // prepare conservative state in master cells
+  int nc = num_advect;
+  conserve_cm_.resize(ncells_wghost * nc);
+
+  double a = dt_shift / dt_global;
+  double mass_start = 0., tmp1;
+
+  for (int c = 0; c < ncells_owned; c++) {
+    double ws = (1.0 - a) * (*ws_prev_)[0][c] + a * (*ws_)[0][c];
+    double den = (1.0 - a) * (*mol_dens_prev_)[0][c] + a * (*mol_dens_)[0][c];
+    double vol_phi_ws_den = mesh_->cell_volume(c) * (*phi_)[0][c] * ws * den;
+    const double* tcc_c = &tcc_cm_[c * nc];
+    double* qty_c = &conserve_cm_[c * nc];
+    for (int i = 0; i < num_advect; i++) {
+      qty_c[i] = tcc_c[i] * vol_phi_ws_den;
+      if ((vol_phi_ws_den > water_tolerance_) && ((*solid_qty_)[i][c] > 0 )) {   // Desolve solid residual into liquid
+        double add_mass = std::min((*solid_qty_)[i][c], max_tcc_* vol_phi_ws_den - qty_c[i]);
+        (*solid_qty_)[i][c] -= add_mass;
+        qty_c[i] += add_mass;
+      }
+      mass_start += qty_c[i];
+    }
+  }
+
+  tmp1 = mass_start;
+  mesh_->get_comm()->SumAll(&tmp1, &mass_start, 1);
+
+  // cells with sources, the step in a cell is zero when it is not updated
+  std::vector<double> dt_src;
+  if (srcs_.size() != 0) dt_src.assign(ncells_owned, 0.0);
+
+  std::vector<double> dt_level(nlevels + 1);
+  for (int k = 0; k <= nlevels; k++) dt_level[k] = dt_sub * (1 << k);
+
+  double tcc_flux;
+  long int nupdates = 0;
+
+  for (int n = 0; n < nsteps; n++) {
+    double t_n = t_old + n * dt_sub;
+
+    // levels 0, ..., kmax start a new step at substep n
+    int kmax = 0;
+    while (kmax < nlevels && ((n >> kmax) & 1) == 0) kmax++;
+
+    // concentrations in upwind cells at time t_n
+    a = (dt_shift + n * dt_sub) / dt_global;
+    for (int k = 0; k <= kmax; k++) {
+      for (int m = 0; m < cells[k].size(); m++) {
+        int c = cells[k][m];
+        double ws = (1.0 - a) * (*ws_prev_)[0][c] + a * (*ws_)[0][c];
+        double den = (1.0 - a) * (*mol_dens_prev_)[0][c] + a * (*mol_dens_)[0][c];
+        double vol_phi_ws_den = mesh_->cell_volume(c) * (*phi_)[0][c] * ws * den;
+        const double* qty_c = &conserve_cm_[c * nc];
+        double* tcc_c = &tcc_cm_[c * nc];
+        for (int i = 0; i < num_advect; i++) {
+          if (vol_phi_ws_den > water_tolerance_ && qty_c[i] > 0) {
+            tcc_c[i] = qty_c[i] / vol_phi_ws_den;
+          } else {
+            tcc_c[i] = 0.;
+          }
+        }
+      }
+    }
+    ScatterCellMajorToGhosted_(tcc_cm_, nc);
+
+    // advance all components at once
+    for (int k = 0; k <= kmax; k++) {
+      double dt_k = dt_level[k];
+      for (int m = 0; m < faces[k].size(); m++) {
+        int f = faces[k][m];
+        int c1 = (*upwind_cell_)[f];
+        int c2 = (*downwind_cell_)[f];
+        double dtu = dt_k * fabs((*flux_)[0][f]);
+        const double* tcc_c1 = &tcc_cm_[c1 * nc];
+
+        if (c1 < ncells_owned) {
+          double* qty_c1 = &conserve_cm_[c1 * nc];
+          for (int i = 0; i < nc; i++) qty_c1[i] -= dtu * tcc_c1[i];
+        }
+        if (c2 >= 0 && c2 < ncells_owned) {
+          double* qty_c2 = &conserve_cm_[c2 * nc];
+          for (int i = 0; i < nc; i++) qty_c2[i] += dtu * tcc_c1[i];
+        } else if (c2 < 0) {
+          for (int i = 0; i < nc; i++) mass_solutes_bc_[i] -= dtu * tcc_c1[i];
+        }
+      }
+      nupdates += faces[k].size();
+    }
+
+    // loop over exterior boundary sets
+    double time = t_n + dt_sub / 2;
+    for (int m = 0; m < bcs_.size(); m++) {
+      bcs_[m]->Compute(time, time);
+
+      std::vector<int>& tcc_index = bcs_[m]->tcc_index();
+      int ncomp = tcc_index.size();
+
+      for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
+        int f = it->first;
+        std::vector<double>& values = it->second;
+        int c2 = (*downwind_cell_)[f];
+        if (c2 >= 0 && level[c2] <= kmax) {
+          double u = fabs((*flux_)[0][f]);
+          for (int i = 0; i < ncomp; i++) {
+            int k = tcc_index[i];
+            if (k < num_advect) {
+              tcc_flux = dt_level[level[c2]] * u * values[i];
+              conserve_cm_[c2 * nc + k] += tcc_flux;
+              mass_solutes_bc_[k] += tcc_flux;
+            }
+          }
+        }
+      }
+    }
+
+    // process external sources
+    if (srcs_.size() != 0) {
+      for (int m = 0; m < srcs_.size(); m++) {
+        for (auto it = srcs_[m]->begin(); it != srcs_[m]->end(); ++it) {
+          int c = it->first;
+          if (c < ncells_owned) dt_src[c] = (level[c] <= kmax) ? dt_level[level[c]] : 0.0;
+        }
+      }
+      ComputeAddSourceTerms(t_n + dt_sub, dt_sub, conserve_cm_, nc, &dt_src);
+    }
+  }
+
+  // recover concentration from new conservative state
+  a = (dt_shift + dt_MPC) / dt_global;
+  for (int c = 0; c < ncells_owned; c++) {
+    double ws = (1.0 - a) * (*ws_prev_)[0][c] + a * (*ws_)[0][c];
+    double den = (1.0 - a) * (*mol_dens_prev_)[0][c] + a * (*mol_dens_)[0][c];
+    double vol_phi_ws_den = mesh_->cell_volume(c) * (*phi_)[0][c] * ws * den;
+    const double* qty_c = &conserve_cm_[c * nc];
+    double* tcc_c = &tcc_cm_[c * nc];
+    for (int i = 0; i < num_advect; i++) {
+      if (vol_phi_ws_den > water_tolerance_ && qty_c[i] > 0) {
+        tcc_c[i] = qty_c[i] / vol_phi_ws_den;
+      } else {
+        (*solid_qty_)[i][c] += std::max(qty_c[i], 0.);
+        tcc_c[i] = 0.;
+      }
+    }
+  }
+
+  t_physics_ += dt_MPC;
+  dt_ = dt_MPC;
+
+  // sources were accumulated as rates times dt_sub
+  for (int i = 0; i < mass_solutes_source_.size(); i++) {
+    mass_solutes_source_[i] *= dt_sub / dt_MPC;
+  }
+
+  // update mass balance
+  for (int i = 0; i < mass_solutes_exact_.size(); i++) {
+    mass_solutes_exact_[i] += mass_solutes_source_[i] * dt_;
+  }
+
+  if (internal_tests) {
+    CopyFromCellMajor_(*tcc_tmp->ViewComponent("cell", false), nc);
+    VV_CheckGEDproperty(*tcc_tmp->ViewComponent("cell"));
+  }
+
+  if (vo_->getVerbLevel() >= Teuchos::VERB_HIGH) {
+    double mass_final = 0.;
+    for (int c = 0; c < ncells_owned * nc; c++) mass_final += conserve_cm_[c];
+    tmp1 = mass_final;
+    mesh_->get_comm()->SumAll(&tmp1, &mass_final, 1);
+
+    double mass_bc(0.), mass_src(0.);
+    if (num_advect > 0) {
+      mesh_->get_comm()->SumAll(&mass_solutes_bc_[0], &mass_bc, 1);
+      mesh_->get_comm()->SumAll(&mass_solutes_source_[0], &mass_src, 1);
+    }
+
+    double nfaces_tmp = nupdates, nfaces_sum;
+    mesh_->get_comm()->SumAll(&nfaces_tmp, &nfaces_sum, 1);
+
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "local time stepping: " << nlevels + 1 << " levels, " << nsteps
+               << " substeps, " << nfaces_sum << " face updates" << std::endl
+               << "mass start " << mass_start << ", final " << mass_final
+               << ", error " << std::abs(mass_final - (mass_start + mass_bc + mass_src * dt_)) << std::endl;
+  }
+
+  return nsteps;
+}
+
+}  // namespace Transport
+}  // namespace Amanzi
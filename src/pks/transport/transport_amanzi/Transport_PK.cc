@@ -18,6 +18,7 @@
 #include "Epetra_MultiVector.h"
 #include "Epetra_Import.h"
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_Time.hpp"
 
 #include "BCs.hh"
 #include "errors.hh"
@@ -365,17 +366,15 @@ void Transport_PK_ATS::Initialize(const Teuchos::Ptr<State>& S)
   //flux_ = S_next_->GetFieldData(flux_key_)->ViewComponent("face", true);
   solid_qty_ = S->GetFieldData(solid_residue_mass_key_, passwd_)->ViewComponent("cell", false);
 
-  //create vector of conserved quatities
-  conserve_qty_ = Teuchos::rcp(new Epetra_MultiVector(*(S->GetFieldData(tcc_key_)->ViewComponent("cell", true))));
-
   // memory for new components
   // tcc_tmp = Teuchos::rcp(new CompositeVector(*(S->GetFieldData(tcc_key_))));
   // *tcc_tmp = *tcc;
 
-  // upwind 
-  const Epetra_Map& fmap_wghost = mesh_->face_map(true);
-  upwind_cell_ = Teuchos::rcp(new Epetra_IntVector(fmap_wghost));
-  downwind_cell_ = Teuchos::rcp(new Epetra_IntVector(fmap_wghost));
+  // upwind, recomputed only on faces whose flux changes sign
+  upwind_cells_ = Teuchos::rcp(new Operators::UpwindCellCache(mesh_,
+          Operators::UpwindCellCache::ZERO_FLUX_OUTWARD_UPWIND));
+  upwind_cell_ = upwind_cells_->upwind_cell();
+  downwind_cell_ = upwind_cells_->downwind_cell();
 
   IdentifyUpwindCells();
 
@@ -737,11 +736,13 @@ double Transport_PK_ATS::StableTimeStep()
   vol=0;
   dt_ = dt_cell = TRANSPORT_LARGE_TIME_STEP;
   int cmin_dt = 0;
+  dt_cell_.assign(ncells_owned, TRANSPORT_LARGE_TIME_STEP);
   for (int c = 0; c < ncells_owned; c++) {
     outflux = total_outflux[c];
     if ( (outflux > 0) && ((*ws_prev_)[0][c]>0) && ((*ws_)[0][c]>0 ) && ((*phi_)[0][c] > 0) ) {
       vol = mesh_->cell_volume(c);
       dt_cell = vol * (*mol_dens_)[0][c] * (*phi_)[0][c] * std::min( (*ws_prev_)[0][c], (*ws_)[0][c] ) / outflux;
+      dt_cell_[c] = dt_cell;
     }
     if (dt_cell < dt_) {
       // *vo_->os()<<"Stable step: "<<flux_key_<<" cell "<<c<<" out "<<outflux<<"  dt= "<<dt_cell<<"\n";
@@ -891,6 +892,15 @@ bool Transport_PK_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
 
   int ncycles = 0, swap = 1;
 
+  // the first-order schemes advance cell-major copies of the advected
+  // components, which are copied back once after all subcycles
+  if (spatial_disc_order == 1) CopyToCellMajor_(tcc_prev, num_aqueous);
+
+  // local time stepping replaces the subcycling loop below
+  if (local_time_stepping_ && spatial_disc_order == 1 && !multiscale_porosity_) {
+    ncycles = AdvanceDonorUpwindLocal(t_old, dt_MPC, dt_shift, dt_global, dt_stable);
+    dt_sum = dt_MPC;
+  }
   
   while (dt_sum < dt_MPC - 1e-5) {
     // update boundary conditions
@@ -953,10 +963,14 @@ bool Transport_PK_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
     if (multiscale_porosity_) {
       double t_int1 = t_old + dt_sum - dt_cycle;
       double t_int2 = t_old + dt_sum;
+      if (spatial_disc_order == 1) CopyFromCellMajor_(*tcc_tmp->ViewComponent("cell", false), num_aqueous);
       AddMultiscalePorosity_(t_old, t_new, t_int1, t_int2);
+      if (spatial_disc_order == 1) CopyToCellMajor_(*tcc_tmp->ViewComponent("cell", false), num_aqueous);
     }
 
-    if (! final_cycle) {  // rotate concentrations (we need new memory for tcc)
+    // rotate concentrations (we need new memory for tcc); the first-order
+    // scheme reads only tcc_cm_
+    if (! final_cycle && spatial_disc_order != 1) {
       tcc = Teuchos::RCP<CompositeVector>(new CompositeVector(*tcc_tmp));
     }
 
@@ -965,6 +979,10 @@ bool Transport_PK_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
  
   //if (ncycles > 1) exit(0);
 
+  if (spatial_disc_order == 1 && ncycles > 0) {
+    CopyFromCellMajor_(*tcc_tmp->ViewComponent("cell", false), num_aqueous);
+  }
+
   dt_ = dt_stable;  // restore the original time step (just in case)
 
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", false);
@@ -1049,9 +1067,15 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
     }
 
     int phase, num_itrs(0);
-    bool flag_op1(true);
+    bool flag_op1(true), flag_symbolic(true);
     double md_change, md_old(0.0), md_new, residual(0.0);
 
+    // The sparsity pattern is built once per step. The matrix and
+    // preconditioner are rebuilt only when the tensors or boundary
+    // conditions change between components.
+    int num_assembles(0);
+    double t_assemble(0.0), t_solve(0.0), t0;
+
     // Disperse and diffuse aqueous components
     for (int i = 0; i < num_aqueous; i++) {
       FindDiffusionValue(component_names_[i], &md_new, &phase);
@@ -1072,6 +1096,7 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
         sol.ViewComponent("face")->PutScalar(0.0);
       }
 
+      t0 = Teuchos::Time::wallTime();
       if (flag_op1) {
         op->Init();
         Teuchos::RCP<std::vector<WhetStone::Tensor> > Dptr = Teuchos::rcpFromRef(D_);
@@ -1086,9 +1111,14 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
         op2->AddAccumulationDelta(sol, factor, factor, dt_MPC, "cell");
  
         op1->ApplyBCs(true, true, true);
-        op->SymbolicAssembleMatrix();
+        if (flag_symbolic) {
+          op->SymbolicAssembleMatrix();
+          flag_symbolic = false;
+        }
         op->AssembleMatrix();
         op->InitPreconditioner(dispersion_preconditioner, *preconditioner_list_);
+        num_assembles++;
+        flag_op1 = false;
       } else {
         Epetra_MultiVector& rhs_cell = *op->rhs()->ViewComponent("cell");
         for (int c = 0; c < ncells_owned; c++) {
@@ -1098,7 +1128,11 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
       }
   
       CompositeVector& rhs = *op->rhs();
+      t_assemble += Teuchos::Time::wallTime() - t0;
+
+      t0 = Teuchos::Time::wallTime();
       int ierr = solver->ApplyInverse(rhs, sol);
+      t_solve += Teuchos::Time::wallTime() - t0;
 
       if (ierr < 0) {
         Errors::Message msg;
@@ -1119,6 +1153,7 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
     // are treated with a hack of the accumulation term.
     D_.clear();
     md_old = 0.0;
+    std::vector<int> bc_model_prev;
     for (int i = num_aqueous; i < num_components; i++) {
       FindDiffusionValue(component_names_[i], &md_new, &phase);
       md_change = md_new - md_old;
@@ -1126,6 +1161,7 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
 
       if (md_change != 0.0 || i == num_aqueous) {
         CalculateDiffusionTensor_(md_change, phase, *phi_, *ws_, *mol_dens_);
+        flag_op1 = true;
       }
 
       // set initial guess
@@ -1137,6 +1173,7 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
         sol.ViewComponent("face")->PutScalar(0.0);
       }
 
+      t0 = Teuchos::Time::wallTime();
       op->Init();
       Teuchos::RCP<std::vector<WhetStone::Tensor> > Dptr = Teuchos::rcpFromRef(D_);
       op1->Setup(Dptr, Teuchos::null, Teuchos::null);
@@ -1144,6 +1181,10 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
 
       // add boundary conditions and sources for gaseous components
       PopulateBoundaryData(bc_model, bc_value, i);
+      if (bc_model != bc_model_prev) {
+        bc_model_prev = bc_model;
+        flag_op1 = true;
+      }
 
       Epetra_MultiVector& rhs_cell = *op->rhs()->ViewComponent("cell");
       ComputeAddSourceTerms(t_new, 1.0, rhs_cell, i, i);
@@ -1159,13 +1200,26 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
         if ((*ws_)[0][c] == 1.0) fac1[0][c] = 1.0 * (*mol_dens_)[0][c];  // hack so far
       }
       op2->AddAccumulationDelta(sol, factor0, factor, dt_MPC, "cell");
- 
-      op->SymbolicAssembleMatrix();
-      op->AssembleMatrix();
-      op->InitPreconditioner(dispersion_preconditioner, *preconditioner_list_);
+
+      // local matrices and the right-hand side are always rebuilt, the
+      // assembled matrix only when the operator has changed
+      if (flag_op1) {
+        if (flag_symbolic) {
+          op->SymbolicAssembleMatrix();
+          flag_symbolic = false;
+        }
+        op->AssembleMatrix();
+        op->InitPreconditioner(dispersion_preconditioner, *preconditioner_list_);
+        num_assembles++;
+        flag_op1 = false;
+      }
   
       CompositeVector& rhs = *op->rhs();
+      t_assemble += Teuchos::Time::wallTime() - t0;
+
+      t0 = Teuchos::Time::wallTime();
       int ierr = solver->ApplyInverse(rhs, sol);
+      t_solve += Teuchos::Time::wallTime() - t0;
 
       if (ierr < 0) {
         Errors::Message msg;
@@ -1186,6 +1240,8 @@ void Transport_PK_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new
       *vo_->os() << "dispersion solver (" << solver->name() 
                  << ") ||r||=" << residual / num_components
                  << " itrs=" << num_itrs / num_components << std::endl;
+      *vo_->os() << "dispersion: " << num_assembles << " assemblies for " << num_components
+                 << " components, assembly " << t_assemble << " [s], solve " << t_solve << " [s]" << std::endl;
     }
   }
 
@@ -1289,6 +1345,53 @@ void Transport_PK_ATS::CommitStep(double t_old, double t_new, const Teuchos::RCP
 }
 
 
+/* ******************************************************************* 
+* Copy the owned cells of the first n components of tcc_c into the
+* cell-major array tcc_cm_, whose ghost cells are set by scatter.
+******************************************************************* */
+void Transport_PK_ATS::CopyToCellMajor_(const Epetra_MultiVector& tcc_c, int n)
+{
+  tcc_cm_.resize(ncells_wghost * n);
+  for (int c = 0; c < ncells_owned; c++) {
+    double* tcc_cm_c = &tcc_cm_[c * n];
+    for (int i = 0; i < n; i++) tcc_cm_c[i] = tcc_c[i][c];
+  }
+}
+
+
+void Transport_PK_ATS::CopyFromCellMajor_(Epetra_MultiVector& tcc_c, int n) const
+{
+  for (int c = 0; c < ncells_owned; c++) {
+    const double* tcc_cm_c = &tcc_cm_[c * n];
+    for (int i = 0; i < n; i++) tcc_c[i][c] = tcc_cm_c[i];
+  }
+}
+
+
+/* ******************************************************************* 
+* Scatter a cell-major array with n values per cell from owned to ghost
+* cells.  Owned cells are the first ncells_owned cells of the ghosted map,
+* so both vectors are views of v.
+******************************************************************* */
+void Transport_PK_ATS::ScatterCellMajorToGhosted_(std::vector<double>& v, int n)
+{
+  if (n == 0) return;
+  if (cm_importer_ == Teuchos::null || cm_map_owned_->ElementSize() != n) {
+    const Epetra_Map& cmap_owned = mesh_->cell_map(false);
+    const Epetra_Map& cmap_wghost = mesh_->cell_map(true);
+    cm_map_owned_ = Teuchos::rcp(new Epetra_BlockMap(-1, cmap_owned.NumMyElements(),
+            cmap_owned.MyGlobalElements(), n, cmap_owned.IndexBase(), cmap_owned.Comm()));
+    cm_map_wghost_ = Teuchos::rcp(new Epetra_BlockMap(-1, cmap_wghost.NumMyElements(),
+            cmap_wghost.MyGlobalElements(), n, cmap_wghost.IndexBase(), cmap_wghost.Comm()));
+    cm_importer_ = Teuchos::rcp(new Epetra_Import(*cm_map_wghost_, *cm_map_owned_));
+  }
+
+  Epetra_Vector v_owned(View, *cm_map_owned_, &v[0]);
+  Epetra_Vector v_wghost(View, *cm_map_wghost_, &v[0]);
+  v_wghost.Import(v_owned, *cm_importer_, Insert);
+}
+
+
 /* ******************************************************************* 
  * A simple first-order transport method 
  ****************************************************************** */
@@ -1298,11 +1401,6 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
   mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
   mass_solutes_bc_.assign(num_aqueous + num_gaseous, 0.0);
 
-  // populating next state of concentrations
-  tcc->ScatterMasterToGhosted("cell");
-  Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell", true);
-  Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
-
   // prepare conservative state in master and slave cells
   double vol_phi_ws_den, tcc_flux;
   double mass_start = 0., tmp1, mass;
@@ -1310,16 +1408,26 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
   // We advect only aqueous components.
   int num_advect = num_aqueous;
 
+  // Advection works on the cell-major (species-interleaved) concentrations
+  // tcc_cm_, which are kept over all subcycles, and conservative state, so
+  // that a face update reads and writes contiguous blocks of num_advect
+  // values.  Owned concentrations are current on entry.
+  int n = num_advect;
+  ScatterCellMajorToGhosted_(tcc_cm_, n);
+  conserve_cm_.resize(ncells_wghost * n);
+
   for (int c = 0; c < ncells_owned; c++) {
     vol_phi_ws_den = mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_start)[0][c] * (*mol_dens_start)[0][c];
+    const double* tcc_c = &tcc_cm_[c * n];
+    double* qty_c = &conserve_cm_[c * n];
     for (int i = 0; i < num_advect; i++){
-      (*conserve_qty_)[i][c] = tcc_prev[i][c] * vol_phi_ws_den;
+      qty_c[i] = tcc_c[i] * vol_phi_ws_den;
       if ((vol_phi_ws_den > water_tolerance_) && ((*solid_qty_)[i][c] > 0 )){   // Desolve solid residual into liquid
-        double add_mass = std::min((*solid_qty_)[i][c], max_tcc_* vol_phi_ws_den - (*conserve_qty_)[i][c]);
+        double add_mass = std::min((*solid_qty_)[i][c], max_tcc_* vol_phi_ws_den - qty_c[i]);
         (*solid_qty_)[i][c] -= add_mass;
-        (*conserve_qty_)[i][c] += add_mass;
+        qty_c[i] += add_mass;
       }
-      mass_start += (*conserve_qty_)[i][c];
+      mass_start += qty_c[i];
     }
   }
 
@@ -1338,30 +1446,31 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
     int c2 = (*downwind_cell_)[f];
 
     double u = fabs((*flux_)[0][f]);
+    double dtu = dt_ * u;
 
     if (c1 >=0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        (*conserve_qty_)[i][c2] += tcc_flux;
+      const double* tcc_c1 = &tcc_cm_[c1 * n];
+      double* qty_c1 = &conserve_cm_[c1 * n];
+      double* qty_c2 = &conserve_cm_[c2 * n];
+      for (int i = 0; i < n; i++) {
+        tcc_flux = dtu * tcc_c1[i];
+        qty_c1[i] -= tcc_flux;
+        qty_c2[i] += tcc_flux;
       }
 
     }
     else if (c1 >=0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
-      for (int i = 0; i < num_advect; i++) {
-        tcc_flux = dt_ * u * tcc_prev[i][c1];
-        // if ((c2 < 0) && fabs(tcc_flux) >1e-17) std::cout <<MyPID<<":u "<<u<<" cell "<<c1<<" "<<c2<<" face "<<f<<
-        //                                          " tcc "<<tcc_prev[i][c1]<<" tcc_flux "<<tcc_flux<<" cntr "<<mesh_->face_centroid(f)<<"\n";
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
-        //AmanziGeometry::Point normal = mesh_->face_normal(f);
+      const double* tcc_c1 = &tcc_cm_[c1 * n];
+      double* qty_c1 = &conserve_cm_[c1 * n];
+      for (int i = 0; i < n; i++) qty_c1[i] -= dtu * tcc_c1[i];
+      if (c2 < 0) {
+        for (int i = 0; i < n; i++) mass_solutes_bc_[i] -= dtu * tcc_c1[i];
       }
 
     } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c2] += tcc_flux;
-      }
+      const double* tcc_c1 = &tcc_cm_[c1 * n];
+      double* qty_c2 = &conserve_cm_[c2 * n];
+      for (int i = 0; i < n; i++) qty_c2[i] += dtu * tcc_c1[i];
     }
   }
 
@@ -1381,7 +1490,7 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
           int k = tcc_index[i];
           if (k < num_advect) {
             tcc_flux = dt_ * u * values[i];
-            (*conserve_qty_)[k][c2] += tcc_flux;
+            conserve_cm_[c2 * n + k] += tcc_flux;
             mass_solutes_bc_[k] += tcc_flux;
           }
         }
@@ -1389,11 +1498,10 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
     }
   }
 
-
   // process external sources
   if (srcs_.size() != 0) {
     double time = t_physics_;
-    ComputeAddSourceTerms(time, dt_, *conserve_qty_, 0, num_advect - 1);
+    ComputeAddSourceTerms(time, dt_, conserve_cm_, n);
   }
 
   // if (domain_name_ == "surface") {
@@ -1403,22 +1511,22 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
   // recover concentration from new conservative state
   for (int c = 0; c < ncells_owned; c++) {
     vol_phi_ws_den = mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_end)[0][c] * (*mol_dens_end)[0][c];
+    const double* qty_c = &conserve_cm_[c * n];
+    double* tcc_c = &tcc_cm_[c * n];
     for (int i = 0; i < num_advect; i++) {
-      if (vol_phi_ws_den > water_tolerance_ && (*conserve_qty_)[i][c] > 0) {
-        tcc_next[i][c] = (*conserve_qty_)[i][c] / vol_phi_ws_den;
+      if (vol_phi_ws_den > water_tolerance_ && qty_c[i] > 0) {
+        tcc_c[i] = qty_c[i] / vol_phi_ws_den;
       }
       else  {
-        (*solid_qty_)[i][c] += std::max((*conserve_qty_)[i][c], 0.);
-        tcc_next[i][c] = 0.;
+        (*solid_qty_)[i][c] += std::max(qty_c[i], 0.);
+        tcc_c[i] = 0.;
       }
     }
   }
 
   double mass_final = 0;
-  for (int c = 0; c < ncells_owned; c++) {
-    for (int i = 0; i < num_advect; i++){        
-      mass_final += (*conserve_qty_)[i][c];
-    }    
+  for (int c = 0; c < ncells_owned * n; c++) {
+    mass_final += conserve_cm_[c];
   }
 
   tmp1 = mass_final;
@@ -1443,6 +1551,7 @@ void Transport_PK_ATS::AdvanceDonorUpwind(double dt_cycle)
   }
 
   if (internal_tests) {
+    CopyFromCellMajor_(*tcc_tmp->ViewComponent("cell", false), n);
     VV_CheckGEDproperty(*tcc_tmp->ViewComponent("cell"));
   }
 
@@ -1671,9 +1780,29 @@ void Transport_PK_ATS::AdvanceSecondOrderUpwindRK2(double dt_cycle)
 * The routine treats two cases of tcc with one and all components.
 ****************************************************************** */
 void Transport_PK_ATS::ComputeAddSourceTerms(double tp, double dtp, 
-                                         Epetra_MultiVector& tcc, int n0, int n1)
+                                         Epetra_MultiVector& tcc, int n0, int n1,
+                                         const std::vector<double>* dt_cell)
+{
+  AMANZI_ASSERT(tcc.ConstantStride());
+  AddSourceTerms_(tp, dtp, tcc.Values(), tcc.NumVectors(), 1, tcc.Stride(), n0, n1, dt_cell);
+}
+
+
+void Transport_PK_ATS::ComputeAddSourceTerms(double tp, double dtp,
+                                         std::vector<double>& tcc_cm, int n,
+                                         const std::vector<double>* dt_cell)
+{
+  if (n > 0) AddSourceTerms_(tp, dtp, &tcc_cm[0], n, n, 1, 0, n - 1, dt_cell);
+}
+
+
+/* ******************************************************************
+* Entry (i,c) of tcc is tcc[i * vec_stride + c * cell_stride].
+****************************************************************** */
+void Transport_PK_ATS::AddSourceTerms_(double tp, double dtp, double* tcc,
+                                       int num_vectors, int cell_stride, int vec_stride,
+                                       int n0, int n1, const std::vector<double>* dt_cell)
 {
-  int num_vectors = tcc.NumVectors();
   int nsrcs = srcs_.size();
 
   double mass1 = 0., mass2 = 0., add_mass =0., tmp1;
@@ -1699,6 +1828,9 @@ void Transport_PK_ATS::ComputeAddSourceTerms(double tp, double dtp,
       //      std::cout<<c<<": "<<ncells_owned<<" "<<values[0]<<"\n";
       if (c >= ncells_owned) continue;
 
+      double dtc = (dt_cell == NULL) ? dtp : (*dt_cell)[c];
+      if (dtc == 0.0) continue;
+
       for (int k = 0; k < tcc_index.size(); ++k) {
         int i = tcc_index[k];
         if (i < n0 || i > n1) continue;
@@ -1717,8 +1849,8 @@ void Transport_PK_ATS::ComputeAddSourceTerms(double tp, double dtp,
         }
 
         //add_mass += dtp * value; 
-        tcc[imap][c] += dtp * value;
-        mass_solutes_source_[i] += value;
+        tcc[imap * vec_stride + c * cell_stride] += dtc * value;
+        mass_solutes_source_[i] += (dt_cell == NULL) ? value : value * dtc / dtp;
 
         // if ((mesh_->cell_centroid(c)[0]>9.5)&&(mesh_->cell_centroid(c)[0]<10.5)){
 
@@ -1835,35 +1967,13 @@ bool Transport_PK_ATS::PopulateBoundaryData(
 
 /* *******************************************************************
 * Identify flux direction based on orientation of the face normal 
-* and sign of the  Darcy velocity.                               
+* and sign of the  Darcy velocity.  Only faces whose flux changed
+* sign since the last call are updated.
 ******************************************************************* */
 void Transport_PK_ATS::IdentifyUpwindCells()
 {
-  for (int f = 0; f < nfaces_wghost; f++) {
-    (*upwind_cell_)[f] = -1;  // negative value indicates boundary
-    (*downwind_cell_)[f] = -1;
-
-    }
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
-
-  for (int c = 0; c < ncells_wghost; c++) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
-
-    for (int i = 0; i < faces.size(); i++) {
-      int f = faces[i];
-      double tmp = (*flux_)[0][f] * dirs[i];
-      if (tmp > 0.0) {
-        (*upwind_cell_)[f] = c;
-      } else if (tmp < 0.0) {
-        (*downwind_cell_)[f] = c;
-      } else if (dirs[i] > 0) {
-        (*upwind_cell_)[f] = c;
-      } else {
-        (*downwind_cell_)[f] = c;
-      }
-    }
-  }
+  AMANZI_ASSERT(flux_->MyLength() == nfaces_wghost);
+  upwind_cells_->Update(*flux_);
 }
 
 void Transport_PK_ATS::ComputeVolumeDarcyFlux(Teuchos::RCP<const Epetra_MultiVector> flux,
@@ -15,6 +15,7 @@
 // TPLs
 #include "Epetra_Vector.h"
 #include "Epetra_IntVector.h"
+#include "Epetra_BlockMap.h"
 #include "Epetra_Import.h"
 #include "Teuchos_RCP.hpp"
 
@@ -46,6 +47,7 @@
 #include "MultiscaleTransportPorosityPartition.hh"
 #include "TransportDomainFunction.hh"
 #include "TransportDefs.hh"
+#include "upwind_cell_cache.hh"
 
 
 /* ******************************************************************
@@ -131,8 +133,17 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
   void CalculateLpErrors(AnalyticFunction f, double t, Epetra_Vector* sol, double* L1, double* L2);
 
   // -- sources and sinks for components from n0 to n1 including
+  // -- optional dt_cell overrides the step in each cell; zero skips the cell
   void ComputeAddSourceTerms(double tp, double dtp, 
-                             Epetra_MultiVector& tcc, int n0, int n1);
+                             Epetra_MultiVector& tcc, int n0, int n1,
+                             const std::vector<double>* dt_cell = NULL);
+  // -- as above, for components 0 to n-1 of a cell-major array
+  void ComputeAddSourceTerms(double tp, double dtp,
+                             std::vector<double>& tcc_cm, int n,
+                             const std::vector<double>* dt_cell = NULL);
+  void AddSourceTerms_(double tp, double dtp, double* tcc, int num_vectors,
+                       int cell_stride, int vec_stride, int n0, int n1,
+                       const std::vector<double>* dt_cell);
 
   bool PopulateBoundaryData(std::vector<int>& bc_model,
                             std::vector<double>& bc_value, int component);
@@ -152,7 +163,15 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
 
   // advection members
   void AdvanceDonorUpwind(double dT);
+  int AdvanceDonorUpwindLocal(double t_old, double dT_MPC, double dT_shift,
+                              double dT_global, double dT_stable);
   void AdvanceSecondOrderUpwindRKn(double dT);
+
+  // -- the first-order schemes keep the advected components cell-major
+  // -- (species-interleaved) in tcc_cm_ over all subcycles of a step
+  void CopyToCellMajor_(const Epetra_MultiVector& tcc_c, int n);
+  void CopyFromCellMajor_(Epetra_MultiVector& tcc_c, int n) const;
+  void ScatterCellMajorToGhosted_(std::vector<double>& v, int n);
   void AdvanceSecondOrderUpwindRK1(double dT);
   void AdvanceSecondOrderUpwindRK2(double dT);
   void Advance_Dispersion_Diffusion(double t_old, double t_new);
@@ -258,7 +277,8 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
 
   Teuchos::RCP<CompositeVector> tcc_tmp;  // next tcc
   Teuchos::RCP<CompositeVector> tcc;  // smart mirrow of tcc 
-  Teuchos::RCP<Epetra_MultiVector> conserve_qty_, solid_qty_;
+  Teuchos::RCP<Epetra_MultiVector> solid_qty_;
+  std::vector<double> tcc_cm_, conserve_cm_;  // cell-major state of the first-order schemes
   Teuchos::RCP<const Epetra_MultiVector> flux_;
   Teuchos::RCP<const Epetra_MultiVector> ws_, ws_prev_, phi_, mol_dens_, mol_dens_prev_;
   Teuchos::RCP<Epetra_MultiVector> flux_copy_;
@@ -268,7 +288,8 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
   Teuchos::RCP<AmanziChemistry::ChemistryEngine> chem_engine_;
 #endif
 
-  Teuchos::RCP<Epetra_IntVector> upwind_cell_;
+  Teuchos::RCP<Operators::UpwindCellCache> upwind_cells_;
+  Teuchos::RCP<Epetra_IntVector> upwind_cell_;  // views of upwind_cells_
   Teuchos::RCP<Epetra_IntVector> downwind_cell_;
 
   Teuchos::RCP<const Epetra_MultiVector> ws_start, ws_end;  // data for subcycling 
@@ -286,6 +307,8 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
   Teuchos::RCP<Epetra_Vector> Kxy;  // absolute permeability in plane xy
 
   Teuchos::RCP<Epetra_Import> cell_importer;  // parallel communicators
+  Teuchos::RCP<Epetra_BlockMap> cm_map_owned_, cm_map_wghost_;  // for tcc_cm_
+  Teuchos::RCP<Epetra_Import> cm_importer_;
   Teuchos::RCP<Epetra_Import> face_importer;
 
   // mechanical dispersion and molecual diffusion
@@ -310,6 +333,11 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
 
   double cfl_, dt_, dt_debug_, t_physics_;  
 
+  // local time stepping: cells advance with dt_stable * 2^level
+  bool local_time_stepping_;
+  int lts_max_levels_;
+  std::vector<double> dt_cell_;  // stable step in owned cells, before CFL
+
   std::vector<double> mass_solutes_exact_, mass_solutes_source_;  // mass for all solutes
   std::vector<double> mass_solutes_bc_, mass_solutes_stepstart_;
   std::vector<std::string> runtime_solutes_;  // names of trached solutes
@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+
+"""Reads aggregated visualization output of a domain set.
+
+Usage: aggregated_vis.py BASE CYCLE
+
+Aggregated vis, set with "aggregate subdomains" for a domain set such as
+"column_*", writes all subdomains into one file per dump:
+BASE_index.txt, BASE_mesh.bin, and BASE_CYCLE.bin.  This prints the
+time of a dump and the range of each field.
+"""
+
+import sys,os
+import numpy as np
+
+def read_index(base, directory="."):
+    """Returns (mesh field names, field names, list of (subdomain, offset, ncells))"""
+    with open(os.path.join(directory, base+"_index.txt"),'r') as fid:
+        lines = [l.strip() for l in fid if not l.startswith('#')]
+
+    n_mesh = int(lines[0].split()[-1])
+    mesh_fields = lines[1:1+n_mesh]
+    i = 1+n_mesh
+    n_fields = int(lines[i].split()[-1])
+    fields = lines[i+1:i+1+n_fields]
+    i = i+1+n_fields+2  # skip the "cells" and "subdomains" lines
+    subdomains = []
+    for l in lines[i:]:
+        name, offset, ncells = l.split()
+        subdomains.append((name, int(offset), int(ncells)))
+    return mesh_fields, fields, subdomains
+
+def read_dump(filename, directory="."):
+    """Returns (cycle, time, data of shape (n_fields, n_cells))"""
+    with open(os.path.join(directory, filename),'rb') as fid:
+        header = fid.read(64)
+        if header[0:8] != b'ATSAGGV1':
+            raise RuntimeError("%s is not an aggregated vis file"%filename)
+        cycle, = np.frombuffer(header[8:16], dtype=np.int64)
+        time, = np.frombuffer(header[16:24], dtype=np.float64)
+        n_fields, n_cells = np.frombuffer(header[24:40], dtype=np.int64)
+        data = np.fromfile(fid, dtype=np.float64, count=n_fields*n_cells)
+    return cycle, time, data.reshape((n_fields, n_cells))
+
+def subdomain_data(data, subdomains, name):
+    """Returns the slice of data, of shape (n_fields, ncells), for one subdomain"""
+    for sd, offset, ncells in subdomains:
+        if sd == name:
+            return data[:,offset:offset+ncells]
+    raise KeyError(name)
+
+def mesh(base, directory="."):
+    """Returns (mesh field names, data) for the cell volumes and centroids"""
+    mesh_fields, fields, subdomains = read_index(base, directory)
+    cycle, time, data = read_dump(base+"_mesh.bin", directory)
+    return mesh_fields, data
+
+def dump(base, cycle, directory="."):
+    """Returns (time, field names, data, subdomains) for one cycle"""
+    mesh_fields, fields, subdomains = read_index(base, directory)
+    c, time, data = read_dump("%s_%05d.bin"%(base, cycle), directory)
+    return time, fields, data, subdomains
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    time, fields, data, subdomains = dump(sys.argv[1], int(sys.argv[2]))
+    print("time = %g, %d subdomains, %d cells"%(time, len(subdomains), data.shape[1]))
+    for name, vals in zip(fields, data):
+        print("  %s: min = %g, max = %g"%(name, np.nanmin(vals), np.nanmax(vals)))